@@ -115,8 +115,8 @@ void BoomerangCallback::EmitOnMetadata(napi_env env, std::string metadata, napi_
 void BoomerangCallback::EmitOnEncodeImage(napi_env env, std::shared_ptr<Media::PixelMap> pixelMap,
     napi_deferred deferred)
 {
-    if (env == nullptr || pixelMap == nullptr) {
-        FI_HILOGI("EmitOnEncodeImage pixelMap is nullptr");
+    if (env == nullptr) {
+        FI_HILOGI("EmitOnEncodeImage env is nullptr");
         return;
     }
     BoomerangNapi *boomerangNapi = BoomerangNapi::GetDeviceStatusNapi();
@@ -159,8 +159,14 @@ void BoomerangNapi::OnEncodeImage(napi_env env, std::shared_ptr<Media::PixelMap>
 {
     CALL_DEBUG_ENTER;
     std::lock_guard<std::mutex> guard(encodeMutex_);
-    CHKPV(pixelMap);
     CHKPV(deferred);
+    if (pixelMap == nullptr) {
+        napi_value errCode;
+        napi_create_int32(env, ENCODE_FAILED, &errCode);
+        FI_HILOGE("Encoding failed, reject with:%{public}d", ENCODE_FAILED);
+        napi_reject_deferred(env, deferred, errCode);
+        return;
+    }
 
     napi_value pixelMapNapi = Media::PixelMapNapi::CreatePixelMap(env, pixelMap);
     CHKPV(pixelMapNapi);
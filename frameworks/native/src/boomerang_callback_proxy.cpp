@@ -66,7 +66,12 @@ void BoomerangCallbackProxy::OnEncodeImageResult(std::shared_ptr<Media::PixelMap
         FI_HILOGE("Write descriptor failed");
         return;
     }
-    pixelMap->Marshalling(data);
+    // A null pixel map reports that encoding failed.
+    WRITEINT32(data, ((pixelMap != nullptr) ? RET_OK : RET_ERR));
+    if ((pixelMap != nullptr) && !pixelMap->Marshalling(data)) {
+        FI_HILOGE("Failed to marshal pixel map");
+        return;
+    }
     int32_t ret = remote->SendRequest(static_cast<int32_t>(IRemoteBoomerangCallback::ENCODE_IMAGE),
         data, reply, option);
     if (ret != RET_OK) {
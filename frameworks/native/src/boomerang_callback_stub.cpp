@@ -72,6 +72,13 @@ int32_t BoomerangCallbackStub::OnScreenshotStub(MessageParcel &data)
 int32_t BoomerangCallbackStub::OnEncodeImageStub(MessageParcel &data)
 {
     CALL_DEBUG_ENTER;
+    int32_t result = RET_ERR;
+    READINT32(data, result, E_DEVICESTATUS_READ_PARCEL_ERROR);
+    if (result != RET_OK) {
+        FI_HILOGE("Failed to encode image, result:%{public}d", result);
+        OnEncodeImageResult(nullptr);
+        return RET_OK;
+    }
     Media::PixelMap *rawPixelMap = OHOS::Media::PixelMap::Unmarshalling(data);
     CHKPF(rawPixelMap);
     std::shared_ptr<OHOS::Media::PixelMap> pixelMap = std::shared_ptr<Media::PixelMap>(rawPixelMap);
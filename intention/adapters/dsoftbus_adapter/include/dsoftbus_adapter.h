@@ -40,6 +40,7 @@ public:
     void CloseAllSessions() override;
     void StartHeartBeat(const std::string &networkId) override;
     void StopHeartBeat(const std::string &networkId) override;
+    int32_t GetLinkState(const std::string &networkId, DSoftbusLinkState &state) override;
     int32_t CheckDeviceOnline(const std::string &networkId) override;
 
     int32_t SendPacket(const std::string &networkId, NetPacket &packet) override;
@@ -19,6 +19,8 @@
 #include <atomic>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "event_handler.h"
 #include "nocopyable.h"
@@ -26,8 +28,11 @@
 #include "socket.h"
 
 #include "circle_stream_buffer.h"
+#include "dsoftbus_heart_beat.h"
+#include "dsoftbus_send_queue.h"
 #include "i_dsoftbus_adapter.h"
 #include "net_packet.h"
+#include "net_packet_view.h"
 #include <shared_mutex>
 
 namespace OHOS {
@@ -58,16 +63,40 @@ class DSoftbusAdapterImpl final : public IDSoftbusAdapter {
     };
 
     struct Session {
-        Session(int32_t socket) : socket_(socket) {}
-        Session(const Session &other) : socket_(other.socket_) {}
+        Session(int32_t socket, std::shared_ptr<DSoftbusSendQueue> sendQueue,
+            std::shared_ptr<DSoftbusHeartBeat::Traffic> traffic)
+            : socket_(socket), sendQueue_(sendQueue), traffic_(traffic) {}
+        Session(const Session &other)
+            : socket_(other.socket_), sendQueue_(other.sendQueue_), traffic_(other.traffic_) {}
         DISALLOW_MOVE(Session);
 
         Session& operator=(const Session &other) = delete;
 
         int32_t socket_;
+        std::shared_ptr<DSoftbusSendQueue> sendQueue_;
+        std::shared_ptr<DSoftbusHeartBeat::Traffic> traffic_;
         CircleStreamBuffer buffer_;
     };
 
+    using Sessions = std::map<std::string, Session>;
+    // Observers registered at the time of the last AddObserver/RemoveObserver. Dispatch
+    // walks this list as is; registering or removing an observer replaces it, so an
+    // observer stays referenced until it is removed.
+    using Observers = std::vector<std::shared_ptr<IDSoftbusObserver>>;
+
+    // Send queues of closed sessions. Their workers are joined when the list goes
+    // out of scope, which callers arrange to happen after @lock_ is released.
+    using SendQueues = std::vector<std::shared_ptr<DSoftbusSendQueue>>;
+
+    // Sessions closed by us and taken out of @sessions_. Their queues are drained and their
+    // sockets shut down by ShutdownSessions(), which callers run after @lock_ is released.
+    struct ClosedSession {
+        std::string networkId;
+        int32_t socket { -1 };
+        std::shared_ptr<DSoftbusSendQueue> sendQueue;
+    };
+    using ClosedSessions = std::vector<ClosedSession>;
+
 public:
     DSoftbusAdapterImpl() = default;
     ~DSoftbusAdapterImpl();
@@ -89,9 +118,13 @@ public:
     int32_t BroadcastPacket(NetPacket &packet) override;
     void StartHeartBeat(const std::string &networkId) override;
     void StopHeartBeat(const std::string &networkId) override;
+    int32_t GetLinkState(const std::string &networkId, DSoftbusLinkState &state) override;
 
     bool HasSessionExisted(const std::string &networkId) override;
 
+    void SetSendQueueOptions(const SendQueueOptions &options);
+    int32_t GetSendQueueMetrics(const std::string &networkId, SendQueueMetrics &metrics);
+
     void OnBind(int32_t socket, PeerSocketInfo info);
     void OnShutdown(int32_t socket, ShutdownReason reason);
     void OnBytes(int32_t socket, const void *data, uint32_t dataLen);
@@ -102,19 +135,28 @@ public:
 private:
     int32_t InitSocket(SocketInfo info, int32_t socketType, int32_t &socket);
     int32_t SetupServer();
-    void ShutdownServer();
+    void ShutdownServer(ClosedSessions &closed);
     int32_t OpenSessionLocked(const std::string &networkId);
-    void CloseAllSessionsLocked();
+    void CloseAllSessionsLocked(ClosedSessions &closed);
+    void AddSessionLocked(const std::string &networkId, int32_t socket);
+    void EraseSessionLocked(Sessions::iterator iter);
+    void UpdateObserverSnapshotLocked();
+    std::shared_ptr<DSoftbusSendQueue> MakeSendQueue(const std::string &networkId, int32_t socket);
+    void RetireSendQueue(Session &session, SendQueues &retired);
+    void CloseSessionLocked(Sessions::iterator iter, ClosedSessions &closed);
+    static void ShutdownSessions(ClosedSessions &closed);
     void OnConnectedLocked(const std::string &networkId);
     void ConfigTcpAlive(int32_t socket);
     int32_t FindConnection(const std::string &networkId);
     void HandleSessionData(const std::string &networkId, CircleStreamBuffer &circleBuffer);
-    void HandlePacket(const std::string &networkId, NetPacket &packet);
+    void HandlePacket(const std::string &networkId, NetPacketView &packet);
+    void AcceptLargePackets(const std::string &networkId);
     void HandleRawData(const std::string &networkId, const void *data, uint32_t dataLen);
     void InitHeartBeat();
-    int32_t KeepHeartBeating(const std::string &networkId);
-    void UpdateHeartBeatState(const std::string &networkId, bool state);
-    bool GetHeartBeatState(const std::string &networkId);
+    void ScheduleHeartBeat(int32_t delayMs);
+    void OnHeartBeatTick();
+    void ReplyHeartBeat(const std::string &networkId, const NetPacketView &packet);
+    void OnApplicationTraffic(const Session &session, SendPriority priority);
     bool CheckDeviceOsType(const std::string &networkId);
     void SetSocketOpt(int32_t socket);
 
@@ -124,16 +166,24 @@ private:
         SendParcel
         BroadcastPacket
         OnBytes
+    The first three only queue data on the send queue of the session, ::SendBytes is called
+    by the worker of that queue without holding this lock.
     */
     std::shared_mutex lock_;
     int32_t socketFd_ { -1 };
     std::string localSessionName_;
     std::set<Observer> observers_;
-    std::map<std::string, Session> sessions_;
+    std::shared_ptr<const Observers> observerSnapshot_ { std::make_shared<const Observers>() };
+    Sessions sessions_;
+    // Indexes @sessions_ by socket for the receiving path.
+    std::unordered_map<int32_t, Sessions::iterator> socketIndex_;
+    SendQueueOptions sendQueueOptions_;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
-    NetPacket heartBeatPacket_ { MessageId::DSOFTBUS_HEART_BEAT_PACKET };
-    std::unordered_map<std::string, bool> heartBeatStates_;
-    std::shared_mutex heartBeatLock_;
+    DSoftbusHeartBeat heartBeat_ {
+        [this](const std::string &networkId, NetPacket &packet) {
+            return this->SendPacket(networkId, packet);
+        }
+    };
 
     static std::mutex mutex_;
     static std::shared_ptr<DSoftbusAdapterImpl> instance_;
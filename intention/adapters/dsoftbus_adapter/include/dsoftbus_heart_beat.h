@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DSOFTBUS_HEART_BEAT_H
+#define DSOFTBUS_HEART_BEAT_H
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "nocopyable.h"
+
+#include "i_dsoftbus_adapter.h"
+#include "net_packet_view.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+inline constexpr int32_t DEFAULT_HEART_BEAT_INTERVAL_MS { 64 };
+inline constexpr int32_t MIN_HEART_BEAT_INTERVAL_MS { 32 };
+inline constexpr int32_t MAX_HEART_BEAT_INTERVAL_MS { 128 };
+
+// Heart beats of all peers, driven by one timer. Each tick sends a probe to every
+// peer whose interval has elapsed, unless application traffic went to that peer
+// within the interval. Peers that echo probes back get an RTT estimate, and their
+// interval widens while probes come back and narrows when they go missing.
+class DSoftbusHeartBeat final {
+public:
+    // Traffic timestamps of one peer, in microseconds of Now(). The send and receive
+    // paths update them without taking the scheduler lock.
+    struct Traffic {
+        std::atomic<int64_t> lastSendTime { 0 };
+        std::atomic<int64_t> lastReceiveTime { 0 };
+    };
+
+    using Sender = std::function<int32_t(const std::string &networkId, NetPacket &packet)>;
+
+    explicit DSoftbusHeartBeat(Sender sender);
+    ~DSoftbusHeartBeat() = default;
+    DISALLOW_COPY_AND_MOVE(DSoftbusHeartBeat);
+
+    std::shared_ptr<Traffic> GetTraffic(const std::string &networkId);
+    // Returns true if no tick was pending, in which case the caller schedules one now.
+    bool Start(const std::string &networkId);
+    void Stop(const std::string &networkId);
+    bool IsRunning(const std::string &networkId) const;
+
+    // Sends due probes. Returns the delay in milliseconds until the next tick, or -1
+    // once no peer needs heart beats any more.
+    int32_t Tick(int64_t now);
+    // Called when the next tick could not be scheduled, so that Start() asks again.
+    void OnTickCancelled();
+    void OnAck(const std::string &networkId, const NetPacketView &packet, int64_t now);
+    int32_t GetLinkState(const std::string &networkId, int64_t now, DSoftbusLinkState &state) const;
+
+    // Builds the reply to a probe of the peer. Returns false for heart beats that
+    // carry no probe, such as those of older peers.
+    static bool MakeAck(const NetPacketView &probe, NetPacket &ack);
+    static int64_t Now();
+
+private:
+    struct Peer {
+        std::shared_ptr<Traffic> traffic { std::make_shared<Traffic>() };
+        bool running { false };
+        int32_t intervalMs { DEFAULT_HEART_BEAT_INTERVAL_MS };
+        int64_t nextProbeTime { 0 };
+        uint32_t seq { 0 };
+        // Oldest probe not answered yet; an answer to it or to any later probe clears it.
+        bool awaitingAck { false };
+        uint32_t ackSeq { 0 };
+        int64_t probeTime { 0 };
+        int64_t lastAckTime { 0 };
+        int64_t srttUs { -1 };
+        int64_t rttVarUs { 0 };
+        uint32_t nLost { 0 };
+    };
+
+    bool IsDueLocked(Peer &peer, int64_t now);
+    void OnProbeLostLocked(Peer &peer);
+    static int64_t GetAckTimeout(const Peer &peer);
+
+private:
+    Sender sender_;
+    mutable std::mutex mutex_;
+    std::map<std::string, Peer> peers_;
+    bool ticking_ { false };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DSOFTBUS_HEART_BEAT_H
\ No newline at end of file
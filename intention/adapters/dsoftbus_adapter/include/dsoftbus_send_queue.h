@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DSOFTBUS_SEND_QUEUE_H
+#define DSOFTBUS_SEND_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "net_packet.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+inline constexpr size_t DEFAULT_SEND_QUEUE_CAPACITY { 256 };
+
+// Frames waiting in a send queue are sent in this order; frames of the same
+// priority keep their order.
+enum class SendPriority : int32_t {
+    INPUT_EVENT = 0,
+    HEART_BEAT,
+    BULK,
+    MAX_SEND_PRIORITY,
+};
+
+// What to do with a frame that arrives when the queue is full.
+enum class SendDropPolicy : int32_t {
+    // Evict the oldest frame of the lowest non-empty priority, unless every
+    // queued frame is more important than the new one. Input frames are never
+    // evicted, since a compact or batched pointer frame is a delta on the one
+    // before and a key or button transition must not get lost; a new frame
+    // with nothing to evict is rejected instead, so its producer learns of it.
+    DROP_OLDEST,
+    // Keep everything already queued and reject the new frame.
+    DROP_NEWEST,
+};
+
+struct SendQueueOptions {
+    size_t capacity { DEFAULT_SEND_QUEUE_CAPACITY };
+    SendDropPolicy dropPolicy { SendDropPolicy::DROP_OLDEST };
+};
+
+struct SendQueueMetrics {
+    size_t depth { 0 };
+    size_t peakDepth { 0 };
+    uint64_t nQueued { 0 };
+    uint64_t nSent { 0 };
+    uint64_t nFailed { 0 };
+    uint64_t nDropped { 0 };
+    // Time from queueing a frame until the send call for it returns.
+    int64_t lastLatencyUs { 0 };
+    int64_t maxLatencyUs { 0 };
+    int64_t avgLatencyUs { 0 };
+};
+
+// Outbound frames of one peer. Producers only copy the frame in; a dedicated
+// worker hands frames to @sender one at a time, so a peer whose link is slow
+// holds up nobody but itself.
+class DSoftbusSendQueue final {
+public:
+    using Sender = std::function<int32_t(const void *data, uint32_t dataLen)>;
+
+    DSoftbusSendQueue(const std::string &name, Sender sender, const SendQueueOptions &options = {});
+    ~DSoftbusSendQueue();
+    DISALLOW_COPY_AND_MOVE(DSoftbusSendQueue);
+
+    int32_t Push(const NetPacket &packet);
+    int32_t Push(SendPriority priority, const void *data, size_t dataLen);
+    // Discards pending frames and stops the worker once the frame in flight,
+    // if any, has been handed over. Does not wait for the worker.
+    void Stop();
+    // Waits up to @timeout for every queued frame to be handed over, then stops
+    // as Stop() does. Returns false if frames were still left at the deadline.
+    bool Drain(std::chrono::milliseconds timeout);
+    void SetOptions(const SendQueueOptions &options);
+    // Largest packet, header included, the peer is known to take. Starts at the legacy
+    // MAX_PACKET_BUF_SIZE, since older peers drop the session on anything larger.
+    void SetMaxPacketSize(size_t maxPacketSize);
+    SendQueueMetrics GetMetrics() const;
+
+    static SendPriority GetPriority(MessageId msgId);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Frame {
+        std::vector<char> data;
+        Clock::time_point queueTime;
+    };
+
+    template<typename Fill>
+    int32_t PushFrame(SendPriority priority, size_t frameSize, Fill &&fill);
+    bool MakeRoomLocked(SendPriority priority);
+    bool PopLocked(Frame &frame);
+    void ReclaimLocked(Frame &frame);
+    void OnSent(Frame &frame, int32_t ret);
+    void Run();
+
+private:
+    const std::string name_;
+    Sender sender_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idleCv_;
+    SendQueueOptions options_;
+    std::array<std::deque<Frame>, static_cast<size_t>(SendPriority::MAX_SEND_PRIORITY)> frames_;
+    std::vector<std::vector<char>> spare_;
+    size_t depth_ { 0 };
+    bool stopping_ { false };
+    bool sending_ { false };
+    std::atomic<size_t> maxPacketSize_ { MAX_PACKET_BUF_SIZE };
+    SendQueueMetrics metrics_;
+    int64_t sumLatencyUs_ { 0 };
+    std::thread worker_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DSOFTBUS_SEND_QUEUE_H
\ No newline at end of file
@@ -69,6 +69,11 @@ void DSoftbusAdapter::StopHeartBeat(const std::string &networkId)
     DSoftbusAdapterImpl::GetInstance()->StopHeartBeat(networkId);
 }
 
+int32_t DSoftbusAdapter::GetLinkState(const std::string &networkId, DSoftbusLinkState &state)
+{
+    return DSoftbusAdapterImpl::GetInstance()->GetLinkState(networkId, state);
+}
+
 void DSoftbusAdapter::CloseAllSessions()
 {
     DSoftbusAdapterImpl::GetInstance()->CloseAllSessions();
@@ -19,6 +19,7 @@
 #include <chrono>
 #endif // ENABLE_PERFORMANCE_CHECK
 
+#include <algorithm>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include "device_manager.h"
@@ -50,12 +51,13 @@ constexpr int32_t LATENCY { 3000 };
 constexpr int32_t SOCKET_SERVER { 0 };
 constexpr int32_t SOCKET_CLIENT { 1 };
 constexpr int32_t INVALID_SOCKET { -1 };
-constexpr int32_t HEART_BEAT_INTERVAL_MS { 64 };
-constexpr int32_t HEART_BEAT_SIZE_BYTE { 28 }; // Ensure size of heartBeat packet is 64Bytes.
 const std::string HEART_BEAT_THREAD_NAME { "OS_Cooperate_Heart_Beat" };
 const char* PARAM_KEY_OS_TYPE = "OS_TYPE";
 constexpr int32_t OS_TYPE_OH { 10 };
 constexpr int32_t OPT_TYPE_FLOW_INFO { 10005 };
+// How long closing a session waits for frames already queued, such as the
+// stop message of cooperation, to go out before the socket is shut down.
+constexpr std::chrono::milliseconds SEND_QUEUE_DRAIN_TIMEOUT { 500 };
 }
 
 std::mutex DSoftbusAdapterImpl::mutex_;
@@ -97,8 +99,12 @@ void DSoftbusAdapterImpl::Disable()
 {
     // LCOV_EXCL_START
     CALL_DEBUG_ENTER;
-    std::unique_lock<std::shared_mutex> lock(lock_);
-    ShutdownServer();
+    ClosedSessions closed;
+    {
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        ShutdownServer(closed);
+    }
+    ShutdownSessions(closed);
     // LCOV_EXCL_STOP
 }
 
@@ -110,6 +116,7 @@ void DSoftbusAdapterImpl::AddObserver(std::shared_ptr<IDSoftbusObserver> observe
     CHKPV(observer);
     observers_.erase(Observer());
     observers_.emplace(observer);
+    UpdateObserverSnapshotLocked();
     // LCOV_EXCL_STOP
 }
 
@@ -122,6 +129,7 @@ void DSoftbusAdapterImpl::RemoveObserver(std::shared_ptr<IDSoftbusObserver> obse
         observers_.erase(iter);
     }
     observers_.erase(Observer());
+    UpdateObserverSnapshotLocked();
     // LCOV_EXCL_STOP
 }
 
@@ -164,21 +172,27 @@ int32_t DSoftbusAdapterImpl::OpenSession(const std::string &networkId)
 void DSoftbusAdapterImpl::CloseSession(const std::string &networkId)
 {
     CALL_INFO_TRACE;
-    std::unique_lock<std::shared_mutex> lock(lock_);
-    if (auto iter = sessions_.find(networkId); iter != sessions_.end()) {
-        ::Shutdown(iter->second.socket_);
-        sessions_.erase(iter);
-        FI_HILOGI("Shutdown session(%{public}d, %{public}s)", iter->second.socket_,
-            Utility::Anonymize(networkId).c_str());
+    ClosedSessions closed;
+    {
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        if (auto iter = sessions_.find(networkId); iter != sessions_.end()) {
+            CloseSessionLocked(iter, closed);
+            EraseSessionLocked(iter);
+        }
     }
+    ShutdownSessions(closed);
 }
 
 void DSoftbusAdapterImpl::CloseAllSessions()
 {
     // LCOV_EXCL_START
     CALL_INFO_TRACE;
-    std::unique_lock<std::shared_mutex> lock(lock_);
-    CloseAllSessionsLocked();
+    ClosedSessions closed;
+    {
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        CloseAllSessionsLocked(closed);
+    }
+    ShutdownSessions(closed);
     // LCOV_EXCL_STOP
 }
 
@@ -193,25 +207,16 @@ int32_t DSoftbusAdapterImpl::SendPacket(const std::string &networkId, NetPacket
 {
     CALL_DEBUG_ENTER;
     std::shared_lock<std::shared_mutex> lock(lock_);
-    int32_t socket = FindConnection(networkId);
-    if (socket < 0) {
+    auto iter = sessions_.find(networkId);
+    if ((iter == sessions_.end()) || (iter->second.socket_ < 0) || (iter->second.sendQueue_ == nullptr)) {
         FI_HILOGE("Node \'%{public}s\' is not connected", Utility::Anonymize(networkId).c_str());
         return RET_ERR;
     }
-    StreamBuffer buffer;
-    if (!packet.MakeData(buffer)) {
-        FI_HILOGE("Failed to buffer packet");
-        return RET_ERR;
-    }
-    if (buffer.Size() > MAX_PACKET_BUF_SIZE) {
-        FI_HILOGE("Packet is too large");
-        return RET_ERR;
-    }
-    int32_t ret = ::SendBytes(socket, buffer.Data(), buffer.Size());
-    if (ret != SOFTBUS_OK) {
-        FI_HILOGE("DSOFTBUS::SendBytes fail (%{public}d)", ret);
+    SendPriority priority = DSoftbusSendQueue::GetPriority(packet.GetMsgId());
+    if (iter->second.sendQueue_->Push(packet) != RET_OK) {
         return RET_ERR;
     }
+    OnApplicationTraffic(iter->second, priority);
     return RET_OK;
 }
 
@@ -219,16 +224,16 @@ int32_t DSoftbusAdapterImpl::SendParcel(const std::string &networkId, Parcel &pa
 {
     CALL_DEBUG_ENTER;
     std::shared_lock<std::shared_mutex> lock(lock_);
-    int32_t socket = FindConnection(networkId);
-    if (socket < 0) {
+    auto iter = sessions_.find(networkId);
+    if ((iter == sessions_.end()) || (iter->second.socket_ < 0) || (iter->second.sendQueue_ == nullptr)) {
         FI_HILOGE("Node \'%{public}s\' is not connected", Utility::Anonymize(networkId).c_str());
         return RET_ERR;
     }
-    int32_t ret = ::SendBytes(socket, reinterpret_cast<const void*>(parcel.GetData()), parcel.GetDataSize());
-    if (ret != SOFTBUS_OK) {
-        FI_HILOGE("DSOFTBUS::SendBytes fail, error:%{public}d", ret);
+    if (iter->second.sendQueue_->Push(SendPriority::BULK,
+        reinterpret_cast<const void*>(parcel.GetData()), parcel.GetDataSize()) != RET_OK) {
         return RET_ERR;
     }
+    OnApplicationTraffic(iter->second, SendPriority::BULK);
     return RET_OK;
 }
 
@@ -240,25 +245,16 @@ int32_t DSoftbusAdapterImpl::BroadcastPacket(NetPacket &packet)
         FI_HILOGE("No session connected");
         return RET_ERR;
     }
-    StreamBuffer buffer;
-    if (!packet.MakeData(buffer)) {
-        FI_HILOGE("Failed to buffer packet");
-        return RET_ERR;
-    }
-    if (buffer.Size() > MAX_PACKET_BUF_SIZE) {
-        FI_HILOGE("Packet is too large");
-        return RET_ERR;
-    }
     for (const auto &elem : sessions_) {
-        int32_t socket = elem.second.socket_;
-        if (socket < 0) {
+        if ((elem.second.socket_ < 0) || (elem.second.sendQueue_ == nullptr)) {
             FI_HILOGE("Node \'%{public}s\' is not connected", Utility::Anonymize(elem.first).c_str());
             continue;
         }
-        if (int32_t ret = ::SendBytes(socket, buffer.Data(), buffer.Size()); ret != SOFTBUS_OK) {
-            FI_HILOGE("DSOFTBUS::SendBytes fail (%{public}d)", ret);
+        if (elem.second.sendQueue_->Push(packet) != RET_OK) {
+            FI_HILOGE("Failed to queue packet to networkId:%{public}s", Utility::Anonymize(elem.first).c_str());
             continue;
         }
+        OnApplicationTraffic(elem.second, DSoftbusSendQueue::GetPriority(packet.GetMsgId()));
         FI_HILOGI("BroadcastPacket to networkId:%{public}s success", Utility::Anonymize(elem.first).c_str());
     }
     return RET_OK;
@@ -271,6 +267,31 @@ bool DSoftbusAdapterImpl::HasSessionExisted(const std::string &networkId)
     return (iter != sessions_.end() && iter->second.socket_ != INVALID_SOCKET);
 }
 
+void DSoftbusAdapterImpl::SetSendQueueOptions(const SendQueueOptions &options)
+{
+    CALL_INFO_TRACE;
+    std::unique_lock<std::shared_mutex> lock(lock_);
+    sendQueueOptions_ = options;
+    for (const auto &elem : sessions_) {
+        if (elem.second.sendQueue_ != nullptr) {
+            elem.second.sendQueue_->SetOptions(options);
+        }
+    }
+}
+
+int32_t DSoftbusAdapterImpl::GetSendQueueMetrics(const std::string &networkId, SendQueueMetrics &metrics)
+{
+    CALL_DEBUG_ENTER;
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    auto iter = sessions_.find(networkId);
+    if ((iter == sessions_.end()) || (iter->second.sendQueue_ == nullptr)) {
+        FI_HILOGE("Node \'%{public}s\' is not connected", Utility::Anonymize(networkId).c_str());
+        return RET_ERR;
+    }
+    metrics = iter->second.sendQueue_->GetMetrics();
+    return RET_OK;
+}
+
 static void OnBindLink(int32_t socket, PeerSocketInfo info)
 {
     DSoftbusAdapterImpl::GetInstance()->OnBind(socket, info);
@@ -289,6 +310,7 @@ static void OnBytesAvailable(int32_t socket, const void *data, uint32_t dataLen)
 void DSoftbusAdapterImpl::OnBind(int32_t socket, PeerSocketInfo info)
 {
     CALL_INFO_TRACE;
+    SendQueues retired;
     std::unique_lock<std::shared_mutex> lock(lock_);
     std::string networkId = info.networkId;
     FI_HILOGI("Bind session(%{public}d, %{public}s)", socket, Utility::Anonymize(networkId).c_str());
@@ -303,43 +325,38 @@ void DSoftbusAdapterImpl::OnBind(int32_t socket, PeerSocketInfo info)
             return;
         }
         FI_HILOGI("(%{public}d, %{public}s) need erase", iter->second.socket_, Utility::Anonymize(networkId).c_str());
-        sessions_.erase(iter);
+        RetireSendQueue(iter->second, retired);
+        EraseSessionLocked(iter);
     }
     ConfigTcpAlive(socket);
-    sessions_.emplace(networkId, Session(socket));
+    AddSessionLocked(networkId, socket);
 
-    for (const auto &item : observers_) {
-        std::shared_ptr<IDSoftbusObserver> observer = item.Lock();
-        if (observer != nullptr) {
-            FI_HILOGD("Notify binding (%{public}d, %{public}s)", socket, Utility::Anonymize(networkId).c_str());
-            observer->OnBind(networkId);
-        }
+    for (const auto &observer : *observerSnapshot_) {
+        FI_HILOGD("Notify binding (%{public}d, %{public}s)", socket, Utility::Anonymize(networkId).c_str());
+        observer->OnBind(networkId);
     }
 }
 
 void DSoftbusAdapterImpl::OnShutdown(int32_t socket, ShutdownReason reason)
 {
     CALL_INFO_TRACE;
+    SendQueues retired;
     std::unique_lock<std::shared_mutex> lock(lock_);
-    auto iter = std::find_if(sessions_.cbegin(), sessions_.cend(),
-        [socket](const auto &item) {
-            return (item.second.socket_ == socket);
-        });
-    if (iter == sessions_.cend()) {
+    auto index = socketIndex_.find(socket);
+    if (index == socketIndex_.end()) {
         FI_HILOGD("Session(%{public}d) is not bound", socket);
         return;
     }
+    auto iter = index->second;
     std::string networkId = iter->first;
-    sessions_.erase(iter);
+    RetireSendQueue(iter->second, retired);
+    EraseSessionLocked(iter);
     FI_HILOGI("Shutdown session(%{public}d, %{public}s)", socket, Utility::Anonymize(networkId).c_str());
 
-    for (const auto &item : observers_) {
-        std::shared_ptr<IDSoftbusObserver> observer = item.Lock();
-        if (observer != nullptr) {
-            FI_HILOGD("Notify shutdown of session(%{public}d, %{public}s)",
-                socket, Utility::Anonymize(networkId).c_str());
-            observer->OnShutdown(networkId);
-        }
+    for (const auto &observer : *observerSnapshot_) {
+        FI_HILOGD("Notify shutdown of session(%{public}d, %{public}s)",
+            socket, Utility::Anonymize(networkId).c_str());
+        observer->OnShutdown(networkId);
     }
 }
 
@@ -347,15 +364,16 @@ void DSoftbusAdapterImpl::OnBytes(int32_t socket, const void *data, uint32_t dat
 {
     CALL_DEBUG_ENTER;
     std::shared_lock<std::shared_mutex> lock(lock_);
-    auto iter = std::find_if(sessions_.begin(), sessions_.end(),
-        [socket](const auto &item) {
-            return (item.second.socket_ == socket);
-        });
-    if (iter == sessions_.end()) {
+    auto index = socketIndex_.find(socket);
+    if (index == socketIndex_.end()) {
         FI_HILOGE("Invalid socket: %{public}d", socket);
         return;
     }
-    const std::string networkId = iter->first;
+    auto iter = index->second;
+    const std::string &networkId = iter->first;
+    if (iter->second.traffic_ != nullptr) {
+        iter->second.traffic_->lastReceiveTime.store(DSoftbusHeartBeat::Now(), std::memory_order_relaxed);
+    }
 
     if (*reinterpret_cast<const uint32_t*>(data) < static_cast<uint32_t>(MessageId::MAX_MESSAGE_ID)) {
         CircleStreamBuffer &circleBuffer = iter->second.buffer_;
@@ -452,11 +470,11 @@ int32_t DSoftbusAdapterImpl::SetupServer()
     // LCOV_EXCL_STOP
 }
 
-void DSoftbusAdapterImpl::ShutdownServer()
+void DSoftbusAdapterImpl::ShutdownServer(ClosedSessions &closed)
 {
     // LCOV_EXCL_START
     CALL_INFO_TRACE;
-    CloseAllSessionsLocked();
+    CloseAllSessionsLocked(closed);
     if (socketFd_ > 0) {
         ::Shutdown(socketFd_);
         socketFd_ = -1;
@@ -504,7 +522,7 @@ int32_t DSoftbusAdapterImpl::OpenSessionLocked(const std::string &networkId)
     }
     ConfigTcpAlive(socket);
     FI_HILOGI("Connected to (%{public}s,%{public}d)", Utility::Anonymize(networkId).c_str(), socket);
-    sessions_.emplace(networkId, Session(socket));
+    AddSessionLocked(networkId, socket);
     OnConnectedLocked(networkId);
     return RET_OK;
 }
@@ -512,26 +530,101 @@ int32_t DSoftbusAdapterImpl::OpenSessionLocked(const std::string &networkId)
 void DSoftbusAdapterImpl::OnConnectedLocked(const std::string &networkId)
 {
     CALL_INFO_TRACE;
-    for (const auto &item : observers_) {
-        std::shared_ptr<IDSoftbusObserver> observer = item.Lock();
-        CHKPC(observer);
+    for (const auto &observer : *observerSnapshot_) {
         FI_HILOGI("Notify connected to networkId:%{public}s", Utility::Anonymize(networkId).c_str());
         observer->OnConnected(networkId);
     }
 }
 
-void DSoftbusAdapterImpl::CloseAllSessionsLocked()
+void DSoftbusAdapterImpl::CloseAllSessionsLocked(ClosedSessions &closed)
 {
     // LCOV_EXCL_START
-    std::for_each(sessions_.begin(), sessions_.end(), [](const auto &item) {
-        ::Shutdown(item.second.socket_);
-        FI_HILOGI("Shutdown connection with (%{public}s,%{public}d)",
-            Utility::Anonymize(item.first).c_str(), item.second.socket_);
-    });
+    for (auto iter = sessions_.begin(); iter != sessions_.end(); ++iter) {
+        CloseSessionLocked(iter, closed);
+    }
     sessions_.clear();
+    socketIndex_.clear();
     // LCOV_EXCL_STOP
 }
 
+void DSoftbusAdapterImpl::AddSessionLocked(const std::string &networkId, int32_t socket)
+{
+    auto [iter, inserted] = sessions_.emplace(networkId,
+        Session(socket, MakeSendQueue(networkId, socket), heartBeat_.GetTraffic(networkId)));
+    if (inserted) {
+        socketIndex_.insert_or_assign(socket, iter);
+    }
+}
+
+void DSoftbusAdapterImpl::EraseSessionLocked(Sessions::iterator iter)
+{
+    if (auto index = socketIndex_.find(iter->second.socket_);
+        (index != socketIndex_.end()) && (index->second == iter)) {
+        socketIndex_.erase(index);
+    }
+    sessions_.erase(iter);
+}
+
+void DSoftbusAdapterImpl::UpdateObserverSnapshotLocked()
+{
+    auto observers = std::make_shared<Observers>();
+    for (const auto &item : observers_) {
+        if (std::shared_ptr<IDSoftbusObserver> observer = item.Lock(); observer != nullptr) {
+            observers->push_back(observer);
+        }
+    }
+    observerSnapshot_ = observers;
+}
+
+std::shared_ptr<DSoftbusSendQueue> DSoftbusAdapterImpl::MakeSendQueue(const std::string &networkId, int32_t socket)
+{
+    return std::make_shared<DSoftbusSendQueue>(Utility::Anonymize(networkId),
+        [socket](const void *data, uint32_t dataLen) {
+            if (int32_t ret = ::SendBytes(socket, data, dataLen); ret != SOFTBUS_OK) {
+                FI_HILOGE("DSOFTBUS::SendBytes fail (%{public}d)", ret);
+                return RET_ERR;
+            }
+            return RET_OK;
+        }, sendQueueOptions_);
+}
+
+void DSoftbusAdapterImpl::RetireSendQueue(Session &session, SendQueues &retired)
+{
+    if (session.sendQueue_ != nullptr) {
+        session.sendQueue_->Stop();
+        retired.push_back(session.sendQueue_);
+        session.sendQueue_.reset();
+    }
+}
+
+void DSoftbusAdapterImpl::CloseSessionLocked(Sessions::iterator iter, ClosedSessions &closed)
+{
+    closed.push_back(ClosedSession {
+        .networkId = iter->first,
+        .socket = iter->second.socket_,
+        .sendQueue = iter->second.sendQueue_,
+    });
+    iter->second.sendQueue_.reset();
+}
+
+// Frames already queued get a bounded chance to go out before the socket is shut down.
+// The queues keep sending side by side, so all of them share one drain deadline.
+void DSoftbusAdapterImpl::ShutdownSessions(ClosedSessions &closed)
+{
+    auto deadline = std::chrono::steady_clock::now() + SEND_QUEUE_DRAIN_TIMEOUT;
+    for (auto &session : closed) {
+        if (session.sendQueue != nullptr) {
+            auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            session.sendQueue->Drain(std::max(timeout, std::chrono::milliseconds::zero()));
+        }
+        ::Shutdown(session.socket);
+        FI_HILOGI("Shutdown session(%{public}d, %{public}s)",
+            session.socket, Utility::Anonymize(session.networkId).c_str());
+    }
+    closed.clear();
+}
+
 void DSoftbusAdapterImpl::ConfigTcpAlive(int32_t socket)
 {
     CALL_DEBUG_ENTER;
@@ -584,7 +677,7 @@ void DSoftbusAdapterImpl::HandleSessionData(const std::string &networkId, Circle
         const char *buf = circleBuffer.ReadBuf();
         const PackHead *head = reinterpret_cast<const PackHead *>(buf);
 
-        if ((head->size < 0) || (static_cast<size_t>(head->size) > MAX_PACKET_BUF_SIZE)) {
+        if ((head->size < 0) || (head->size > MAX_STREAM_BUF_CAPACITY)) {
             FI_HILOGE("Corrupted net packet");
             break;
         }
@@ -593,36 +686,48 @@ void DSoftbusAdapterImpl::HandleSessionData(const std::string &networkId, Circle
                 (head->size + static_cast<int32_t>(sizeof(PackHead))), circleBuffer.ResidualSize());
             break;
         }
-        NetPacket packet(head->idMsg);
-
-        if ((head->size > 0) && !packet.Write(&buf[sizeof(PackHead)], head->size)) {
-            FI_HILOGE("Failed to fill packet, PacketSize:%{public}d", head->size);
-            break;
-        }
+        NetPacketView packet(head->idMsg, &buf[sizeof(PackHead)], static_cast<size_t>(head->size));
         circleBuffer.SeekReadPos(packet.GetPacketLength());
         HandlePacket(networkId, packet);
     }
 }
 
-void DSoftbusAdapterImpl::HandlePacket(const std::string &networkId, NetPacket &packet)
+void DSoftbusAdapterImpl::HandlePacket(const std::string &networkId, NetPacketView &packet)
 {
     CALL_DEBUG_ENTER;
-    for (const auto &item : observers_) {
-        std::shared_ptr<IDSoftbusObserver> observer = item.Lock();
-        if ((observer != nullptr) &&
-            observer->OnPacket(networkId, packet)) {
+    if (packet.GetMsgId() == MessageId::DSOFTBUS_HEART_BEAT_ACK) {
+        heartBeat_.OnAck(networkId, packet, DSoftbusHeartBeat::Now());
+        return;
+    }
+    if (packet.GetMsgId() == MessageId::DSOFTBUS_HEART_BEAT_PACKET) {
+        ReplyHeartBeat(networkId, packet);
+    }
+    if (packet.GetMsgId() == MessageId::DSOFTBUS_INPUT_EVENT_SCHEMA) {
+        AcceptLargePackets(networkId);
+    }
+    for (const auto &observer : *observerSnapshot_) {
+        if (observer->OnPacket(networkId, packet)) {
             return;
         }
     }
 }
 
+// Peers announcing an input event schema receive packets of up to MAX_STREAM_BUF_CAPACITY,
+// older ones drop the session on a packet above MAX_PACKET_BUF_SIZE.
+void DSoftbusAdapterImpl::AcceptLargePackets(const std::string &networkId)
+{
+    auto iter = sessions_.find(networkId);
+    if ((iter == sessions_.end()) || (iter->second.sendQueue_ == nullptr)) {
+        return;
+    }
+    iter->second.sendQueue_->SetMaxPacketSize(MAX_STREAM_BUF_CAPACITY);
+}
+
 void DSoftbusAdapterImpl::HandleRawData(const std::string &networkId, const void *data, uint32_t dataLen)
 {
     CALL_DEBUG_ENTER;
-    for (const auto &item : observers_) {
-        std::shared_ptr<IDSoftbusObserver> observer = item.Lock();
-        if ((observer != nullptr) &&
-            observer->OnRawData(networkId, data, dataLen)) {
+    for (const auto &observer : *observerSnapshot_) {
+        if (observer->OnRawData(networkId, data, dataLen)) {
             return;
         }
     }
@@ -634,71 +739,62 @@ void DSoftbusAdapterImpl::InitHeartBeat()
     auto runner = AppExecFwk::EventRunner::Create(HEART_BEAT_THREAD_NAME, AppExecFwk::ThreadMode::FFRT);
     CHKPV(runner);
     eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    char heartBeatContent[HEART_BEAT_SIZE_BYTE] { 'a' };
-    heartBeatPacket_.Write(heartBeatContent, HEART_BEAT_SIZE_BYTE);
     // LCOV_EXCL_STOP
 }
 
 void DSoftbusAdapterImpl::StartHeartBeat(const std::string &networkId)
 {
     CALL_INFO_TRACE;
-    if (GetHeartBeatState(networkId)) {
-        FI_HILOGI("HeartBeat to %{public}s running ready", Utility::Anonymize(networkId).c_str());
-        return;
+    if (heartBeat_.Start(networkId)) {
+        ScheduleHeartBeat(0);
     }
-    if (KeepHeartBeating(networkId) != RET_OK) {
-        UpdateHeartBeatState(networkId, false);
-        FI_HILOGE("StartHeartBeat to %{public}s failed", Utility::Anonymize(networkId).c_str());
-        return;
-    }
-    UpdateHeartBeatState(networkId, true);
-    FI_HILOGI("StartHeartBeat to %{public}s successfully", Utility::Anonymize(networkId).c_str());
 }
 
 void DSoftbusAdapterImpl::StopHeartBeat(const std::string &networkId)
 {
-    UpdateHeartBeatState(networkId, false);
-    FI_HILOGI("StopHeartBeat to %{public}s successfully", Utility::Anonymize(networkId).c_str());
+    heartBeat_.Stop(networkId);
 }
 
-int32_t DSoftbusAdapterImpl::KeepHeartBeating(const std::string &networkId)
+int32_t DSoftbusAdapterImpl::GetLinkState(const std::string &networkId, DSoftbusLinkState &state)
 {
-    if (SendPacket(networkId, heartBeatPacket_) != RET_OK) {
-        FI_HILOGE("HeartBeat to %{public}s failed, stop it", Utility::Anonymize(networkId).c_str());
-        UpdateHeartBeatState(networkId, false);
-        return RET_ERR;
+    return heartBeat_.GetLinkState(networkId, DSoftbusHeartBeat::Now(), state);
+}
+
+void DSoftbusAdapterImpl::ScheduleHeartBeat(int32_t delayMs)
+{
+    if ((eventHandler_ == nullptr) ||
+        !eventHandler_->PostTask([this]() { this->OnHeartBeatTick(); }, delayMs)) {
+        FI_HILOGE("PostTask heartBeat failed");
+        heartBeat_.OnTickCancelled();
     }
-    CHKPR(eventHandler_, RET_ERR);
-    if (!eventHandler_->PostTask(
-        [this, networkId]() {
-            if (GetHeartBeatState(networkId)) {
-                this->KeepHeartBeating(networkId);
-            } else {
-                UpdateHeartBeatState(networkId, false);
-                FI_HILOGE("Switch off, Stop heartBeat to %{public}s", Utility::Anonymize(networkId).c_str());
-            }
-        }, HEART_BEAT_INTERVAL_MS)) {
-        FI_HILOGE("PostTask heartBeat to %{public}s failed", Utility::Anonymize(networkId).c_str());
-        UpdateHeartBeatState(networkId, false);
-        return RET_ERR;
+}
+
+void DSoftbusAdapterImpl::OnHeartBeatTick()
+{
+    if (int32_t delayMs = heartBeat_.Tick(DSoftbusHeartBeat::Now()); delayMs >= 0) {
+        ScheduleHeartBeat(delayMs);
+    } else {
+        FI_HILOGI("No heart beat running, stop ticking");
     }
-    return RET_OK;
 }
 
-void DSoftbusAdapterImpl::UpdateHeartBeatState(const std::string &networkId, bool state)
+void DSoftbusAdapterImpl::ReplyHeartBeat(const std::string &networkId, const NetPacketView &packet)
 {
-    std::unique_lock<std::shared_mutex> lock(heartBeatLock_);
-    heartBeatStates_[networkId] = state;
-    FI_HILOGI("Update %{public}s state:%{public}s", Utility::Anonymize(networkId).c_str(), state ? "true" : "false");
+    NetPacket ack(MessageId::DSOFTBUS_HEART_BEAT_ACK);
+    if (!DSoftbusHeartBeat::MakeAck(packet, ack)) {
+        return;
+    }
+    // Runs on the receiving path with lock_ held, so queue the ack directly.
+    if (auto iter = sessions_.find(networkId); (iter != sessions_.end()) && (iter->second.sendQueue_ != nullptr)) {
+        iter->second.sendQueue_->Push(ack);
+    }
 }
 
-bool DSoftbusAdapterImpl::GetHeartBeatState(const std::string &networkId)
+void DSoftbusAdapterImpl::OnApplicationTraffic(const Session &session, SendPriority priority)
 {
-    std::shared_lock<std::shared_mutex> lock(heartBeatLock_);
-    if (heartBeatStates_.find(networkId) != heartBeatStates_.end()) {
-        return heartBeatStates_[networkId];
+    if ((priority != SendPriority::HEART_BEAT) && (session.traffic_ != nullptr)) {
+        session.traffic_->lastSendTime.store(DSoftbusHeartBeat::Now(), std::memory_order_relaxed);
     }
-    return false;
 }
 
 bool DSoftbusAdapterImpl::CheckDeviceOsType(const std::string &networkId)
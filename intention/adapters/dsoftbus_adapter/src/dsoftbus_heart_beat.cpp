@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsoftbus_heart_beat.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "devicestatus_define.h"
+#include "utility.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DSoftbusHeartBeat"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr uint32_t HEART_BEAT_PROBE_MAGIC { 0x48425031 };
+constexpr int64_t US_PER_MS { 1000 };
+constexpr int64_t RTT_REFRESH_US { 500 * US_PER_MS };
+constexpr int64_t LINK_TIMEOUT_US { 4 * MAX_HEART_BEAT_INTERVAL_MS * US_PER_MS };
+constexpr int64_t RTT_VAR_FACTOR { 4 };
+constexpr int64_t ACK_TIMEOUT_INTERVALS { 2 };
+constexpr int32_t INTERVAL_STEP_DIVISOR { 4 };
+
+// Payload of a heart beat, echoed back unchanged as the payload of its ack. Sized so
+// that the heart beat keeps the length of the padding older peers send.
+#pragma pack(1)
+struct HeartBeatProbe {
+    uint32_t magic { HEART_BEAT_PROBE_MAGIC };
+    uint32_t seq { 0 };
+    int64_t sendTime { 0 };
+    char padding[12] {};
+};
+#pragma pack()
+static_assert(sizeof(HeartBeatProbe) == 28);
+
+bool ParseProbe(const NetPacketView &packet, HeartBeatProbe &probe)
+{
+    if (packet.Size() != sizeof(probe)) {
+        return false;
+    }
+    std::copy_n(packet.GetData(), sizeof(probe), reinterpret_cast<char *>(&probe));
+    return (probe.magic == HEART_BEAT_PROBE_MAGIC);
+}
+
+int32_t UsToMs(int64_t us)
+{
+    return static_cast<int32_t>((us + US_PER_MS - 1) / US_PER_MS);
+}
+} // namespace
+
+DSoftbusHeartBeat::DSoftbusHeartBeat(Sender sender)
+    : sender_(sender) {}
+
+int64_t DSoftbusHeartBeat::Now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::shared_ptr<DSoftbusHeartBeat::Traffic> DSoftbusHeartBeat::GetTraffic(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return peers_[networkId].traffic;
+}
+
+bool DSoftbusHeartBeat::Start(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    Peer &peer = peers_[networkId];
+    if (peer.running) {
+        FI_HILOGI("HeartBeat to %{public}s running ready", Utility::Anonymize(networkId).c_str());
+    } else {
+        peer.running = true;
+        peer.nextProbeTime = 0;
+        peer.awaitingAck = false;
+        FI_HILOGI("StartHeartBeat to %{public}s successfully", Utility::Anonymize(networkId).c_str());
+    }
+    bool idle = !ticking_;
+    ticking_ = true;
+    return idle;
+}
+
+void DSoftbusHeartBeat::Stop(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (auto iter = peers_.find(networkId); iter != peers_.end()) {
+        iter->second.running = false;
+        iter->second.awaitingAck = false;
+    }
+    FI_HILOGI("StopHeartBeat to %{public}s successfully", Utility::Anonymize(networkId).c_str());
+}
+
+bool DSoftbusHeartBeat::IsRunning(const std::string &networkId) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = peers_.find(networkId);
+    return ((iter != peers_.end()) && iter->second.running);
+}
+
+void DSoftbusHeartBeat::OnTickCancelled()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    ticking_ = false;
+}
+
+int64_t DSoftbusHeartBeat::GetAckTimeout(const Peer &peer)
+{
+    return std::max(peer.srttUs + RTT_VAR_FACTOR * peer.rttVarUs,
+        ACK_TIMEOUT_INTERVALS * peer.intervalMs * US_PER_MS);
+}
+
+void DSoftbusHeartBeat::OnProbeLostLocked(Peer &peer)
+{
+    peer.awaitingAck = false;
+    ++peer.nLost;
+    peer.intervalMs = std::max(peer.intervalMs - peer.intervalMs / INTERVAL_STEP_DIVISOR, MIN_HEART_BEAT_INTERVAL_MS);
+}
+
+bool DSoftbusHeartBeat::IsDueLocked(Peer &peer, int64_t now)
+{
+    // Only peers that have echoed a probe before are expected to echo this one.
+    if (peer.awaitingAck && (peer.srttUs >= 0) && ((now - peer.probeTime) > GetAckTimeout(peer))) {
+        OnProbeLostLocked(peer);
+    }
+    if (now < peer.nextProbeTime) {
+        return false;
+    }
+    int64_t interval = peer.intervalMs * US_PER_MS;
+    int64_t lastSendTime = peer.traffic->lastSendTime.load(std::memory_order_relaxed);
+    bool rttStale = ((peer.srttUs >= 0) && ((now - peer.lastAckTime) >= RTT_REFRESH_US));
+
+    if (((now - lastSendTime) < interval) && !rttStale) {
+        peer.nextProbeTime = lastSendTime + interval;
+        return false;
+    }
+    return true;
+}
+
+int32_t DSoftbusHeartBeat::Tick(int64_t now)
+{
+    struct Probe {
+        std::string networkId;
+        HeartBeatProbe payload;
+    };
+    std::vector<Probe> probes;
+    int64_t nextTick = std::numeric_limits<int64_t>::max();
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (auto &[networkId, peer] : peers_) {
+            if (!peer.running) {
+                continue;
+            }
+            if (IsDueLocked(peer, now)) {
+                ++peer.seq;
+                if (!peer.awaitingAck) {
+                    peer.awaitingAck = true;
+                    peer.ackSeq = peer.seq;
+                    peer.probeTime = now;
+                }
+                peer.nextProbeTime = now + peer.intervalMs * US_PER_MS;
+                probes.push_back(Probe { .networkId = networkId,
+                    .payload = HeartBeatProbe { .seq = peer.seq, .sendTime = now } });
+            }
+            nextTick = std::min(nextTick, peer.nextProbeTime);
+        }
+        if (nextTick == std::numeric_limits<int64_t>::max()) {
+            ticking_ = false;
+        }
+    }
+    for (const auto &probe : probes) {
+        NetPacket packet(MessageId::DSOFTBUS_HEART_BEAT_PACKET);
+        packet.Write(reinterpret_cast<const char *>(&probe.payload), sizeof(probe.payload));
+        if (sender_(probe.networkId, packet) != RET_OK) {
+            FI_HILOGE("HeartBeat to %{public}s failed, stop it", Utility::Anonymize(probe.networkId).c_str());
+            Stop(probe.networkId);
+        }
+    }
+    if (nextTick == std::numeric_limits<int64_t>::max()) {
+        return -1;
+    }
+    return std::max(UsToMs(nextTick - now), 1);
+}
+
+void DSoftbusHeartBeat::OnAck(const std::string &networkId, const NetPacketView &packet, int64_t now)
+{
+    HeartBeatProbe probe;
+    if (!ParseProbe(packet, probe)) {
+        FI_HILOGW("Invalid heart beat ack from %{public}s", Utility::Anonymize(networkId).c_str());
+        return;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = peers_.find(networkId);
+    if ((iter == peers_.end()) || !iter->second.awaitingAck) {
+        return;
+    }
+    Peer &peer = iter->second;
+    if ((static_cast<int32_t>(probe.seq - peer.ackSeq) < 0) || (static_cast<int32_t>(peer.seq - probe.seq) < 0)) {
+        return;
+    }
+    int64_t sample = std::max<int64_t>(now - probe.sendTime, 0);
+    bool spike = ((peer.srttUs >= 0) && (sample > (peer.srttUs + RTT_VAR_FACTOR * peer.rttVarUs)));
+
+    if (peer.srttUs < 0) {
+        peer.srttUs = sample;
+        peer.rttVarUs = sample / 2;
+    } else {
+        peer.rttVarUs += (std::abs(peer.srttUs - sample) - peer.rttVarUs) / 4;
+        peer.srttUs += (sample - peer.srttUs) / 8;
+    }
+    peer.awaitingAck = false;
+    peer.lastAckTime = now;
+    peer.nLost = 0;
+    if (spike) {
+        peer.intervalMs = std::max(peer.intervalMs - peer.intervalMs / INTERVAL_STEP_DIVISOR,
+            MIN_HEART_BEAT_INTERVAL_MS);
+    } else {
+        peer.intervalMs = std::min(peer.intervalMs + peer.intervalMs / INTERVAL_STEP_DIVISOR,
+            MAX_HEART_BEAT_INTERVAL_MS);
+    }
+}
+
+int32_t DSoftbusHeartBeat::GetLinkState(const std::string &networkId, int64_t now, DSoftbusLinkState &state) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = peers_.find(networkId);
+    if (iter == peers_.end()) {
+        return RET_ERR;
+    }
+    const Peer &peer = iter->second;
+    int64_t lastReceiveTime = peer.traffic->lastReceiveTime.load(std::memory_order_relaxed);
+
+    state.alive = ((lastReceiveTime > 0) && ((now - lastReceiveTime) <= LINK_TIMEOUT_US));
+    state.idleMs = (lastReceiveTime > 0 ? (now - lastReceiveTime) / US_PER_MS : -1);
+    state.rttMs = (peer.srttUs >= 0 ? UsToMs(peer.srttUs) : -1);
+    state.rttVarMs = (peer.srttUs >= 0 ? UsToMs(peer.rttVarUs) : -1);
+    state.heartBeatIntervalMs = (peer.running ? peer.intervalMs : 0);
+    state.nLostHeartBeats = peer.nLost;
+    return RET_OK;
+}
+
+bool DSoftbusHeartBeat::MakeAck(const NetPacketView &probe, NetPacket &ack)
+{
+    HeartBeatProbe payload;
+    if (!ParseProbe(probe, payload)) {
+        return false;
+    }
+    return ack.Write(reinterpret_cast<const char *>(&payload), sizeof(payload));
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsoftbus_send_queue.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "devicestatus_define.h"
+#include "util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DSoftbusSendQueue"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr size_t MAX_SPARE_FRAMES { 16 };
+constexpr size_t MAX_SPARE_FRAME_SIZE { 4096 };
+const std::string SEND_THREAD_NAME { "os_ds_sbus_tx" };
+constexpr SendPriority MIN_EVICTABLE_PRIORITY { SendPriority::HEART_BEAT };
+}
+
+DSoftbusSendQueue::DSoftbusSendQueue(const std::string &name, Sender sender, const SendQueueOptions &options)
+    : name_(name), sender_(sender)
+{
+    SetOptions(options);
+    worker_ = std::thread([this] { this->Run(); });
+}
+
+DSoftbusSendQueue::~DSoftbusSendQueue()
+{
+    Stop();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+SendPriority DSoftbusSendQueue::GetPriority(MessageId msgId)
+{
+    switch (msgId) {
+        case MessageId::DSOFTBUS_INPUT_POINTER_EVENT:
+        case MessageId::DSOFTBUS_INPUT_KEY_EVENT:
+        case MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT:
+        case MessageId::DSOFTBUS_INPUT_EVENT_BATCH:
+        case MessageId::DSOFTBUS_MOUSE_LOCATION_STREAM: {
+            return SendPriority::INPUT_EVENT;
+        }
+        case MessageId::DSOFTBUS_HEART_BEAT_PACKET:
+        case MessageId::DSOFTBUS_HEART_BEAT_ACK: {
+            return SendPriority::HEART_BEAT;
+        }
+        default: {
+            return SendPriority::BULK;
+        }
+    }
+}
+
+int32_t DSoftbusSendQueue::Push(const NetPacket &packet)
+{
+    PackHead head { packet.GetMsgId(), static_cast<int32_t>(packet.Size()) };
+    if (sizeof(head) + packet.Size() > maxPacketSize_.load(std::memory_order_relaxed)) {
+        FI_HILOGE("Packet(%{public}d) of %{public}zu bytes is too large for \'%{public}s\'",
+            static_cast<int32_t>(head.idMsg), packet.Size(), name_.c_str());
+        return RET_ERR;
+    }
+    return PushFrame(GetPriority(head.idMsg), sizeof(head) + packet.Size(),
+        [&head, &packet](char *buf) {
+            std::copy_n(reinterpret_cast<const char *>(&head), sizeof(head), buf);
+            std::copy_n(packet.GetData(), packet.Size(), buf + sizeof(head));
+        });
+}
+
+int32_t DSoftbusSendQueue::Push(SendPriority priority, const void *data, size_t dataLen)
+{
+    CHKPR(data, RET_ERR);
+    return PushFrame(priority, dataLen,
+        [data, dataLen](char *buf) {
+            std::copy_n(static_cast<const char *>(data), dataLen, buf);
+        });
+}
+
+template<typename Fill>
+int32_t DSoftbusSendQueue::PushFrame(SendPriority priority, size_t frameSize, Fill &&fill)
+{
+    if ((priority < SendPriority::INPUT_EVENT) || (priority >= SendPriority::MAX_SEND_PRIORITY)) {
+        FI_HILOGE("Invalid priority:%{public}d", static_cast<int32_t>(priority));
+        return RET_ERR;
+    }
+    if (frameSize > static_cast<size_t>(MAX_STREAM_BUF_CAPACITY)) {
+        FI_HILOGE("Packet is too large");
+        return RET_ERR;
+    }
+    Frame frame;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (!spare_.empty()) {
+            frame.data = std::move(spare_.back());
+            spare_.pop_back();
+        }
+    }
+    frame.data.resize(frameSize);
+    fill(frame.data.data());
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopping_) {
+        FI_HILOGE("Send queue of \'%{public}s\' has stopped", name_.c_str());
+        return RET_ERR;
+    }
+    if (!MakeRoomLocked(priority)) {
+        ++metrics_.nDropped;
+        FI_HILOGW("Send queue of \'%{public}s\' is full, drop frame", name_.c_str());
+        ReclaimLocked(frame);
+        return RET_ERR;
+    }
+    frame.queueTime = Clock::now();
+    frames_[static_cast<size_t>(priority)].push_back(std::move(frame));
+    ++depth_;
+    ++metrics_.nQueued;
+    metrics_.peakDepth = std::max(metrics_.peakDepth, depth_);
+    lock.unlock();
+    cv_.notify_one();
+    return RET_OK;
+}
+
+bool DSoftbusSendQueue::MakeRoomLocked(SendPriority priority)
+{
+    while (depth_ >= options_.capacity) {
+        if (options_.dropPolicy == SendDropPolicy::DROP_NEWEST) {
+            return false;
+        }
+        auto last = frames_.rend() - static_cast<ptrdiff_t>(std::max(priority, MIN_EVICTABLE_PRIORITY));
+        auto iter = std::find_if(frames_.rbegin(), last,
+            [](const auto &frames) {
+                return !frames.empty();
+            });
+        if (iter == last) {
+            return false;
+        }
+        ReclaimLocked(iter->front());
+        iter->pop_front();
+        --depth_;
+        ++metrics_.nDropped;
+    }
+    return true;
+}
+
+bool DSoftbusSendQueue::PopLocked(Frame &frame)
+{
+    for (auto &frames : frames_) {
+        if (!frames.empty()) {
+            frame = std::move(frames.front());
+            frames.pop_front();
+            --depth_;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DSoftbusSendQueue::ReclaimLocked(Frame &frame)
+{
+    if ((spare_.size() < MAX_SPARE_FRAMES) && (frame.data.capacity() <= MAX_SPARE_FRAME_SIZE)) {
+        frame.data.clear();
+        spare_.push_back(std::move(frame.data));
+    }
+}
+
+void DSoftbusSendQueue::Stop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopping_) {
+        return;
+    }
+    stopping_ = true;
+    metrics_.nDropped += depth_;
+    for (auto &frames : frames_) {
+        frames.clear();
+    }
+    depth_ = 0;
+    spare_.clear();
+    FI_HILOGI("Send queue of \'%{public}s\' stopped, queued:%{public}" PRIu64 ", sent:%{public}" PRIu64
+        ", failed:%{public}" PRIu64 ", dropped:%{public}" PRIu64 ", peak depth:%{public}zu"
+        ", latency(avg:%{public}" PRId64 "us, max:%{public}" PRId64 "us)",
+        name_.c_str(), metrics_.nQueued, metrics_.nSent, metrics_.nFailed, metrics_.nDropped,
+        metrics_.peakDepth, metrics_.avgLatencyUs, metrics_.maxLatencyUs);
+    lock.unlock();
+    cv_.notify_all();
+    idleCv_.notify_all();
+}
+
+bool DSoftbusSendQueue::Drain(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool drained = idleCv_.wait_for(lock, timeout, [this] {
+        return (stopping_ || ((depth_ == 0) && !sending_));
+    });
+    if (!drained) {
+        FI_HILOGW("Send queue of \'%{public}s\' is not drained in time, %{public}zu frames left",
+            name_.c_str(), depth_);
+    }
+    lock.unlock();
+    Stop();
+    return drained;
+}
+
+void DSoftbusSendQueue::SetOptions(const SendQueueOptions &options)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    options_ = options;
+    options_.capacity = std::max<size_t>(options_.capacity, 1);
+}
+
+void DSoftbusSendQueue::SetMaxPacketSize(size_t maxPacketSize)
+{
+    maxPacketSize_.store(std::min(maxPacketSize, static_cast<size_t>(MAX_STREAM_BUF_CAPACITY)),
+        std::memory_order_relaxed);
+}
+
+SendQueueMetrics DSoftbusSendQueue::GetMetrics() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    SendQueueMetrics metrics = metrics_;
+    metrics.depth = depth_;
+    return metrics;
+}
+
+void DSoftbusSendQueue::OnSent(Frame &frame, int32_t ret)
+{
+    int64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - frame.queueTime).count();
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (ret != RET_OK) {
+        ++metrics_.nFailed;
+        FI_HILOGE("Failed to send frame to \'%{public}s\', error:%{public}d", name_.c_str(), ret);
+    } else {
+        ++metrics_.nSent;
+        sumLatencyUs_ += latency;
+        metrics_.lastLatencyUs = latency;
+        metrics_.maxLatencyUs = std::max(metrics_.maxLatencyUs, latency);
+        metrics_.avgLatencyUs = sumLatencyUs_ / static_cast<int64_t>(metrics_.nSent);
+    }
+    ReclaimLocked(frame);
+    sending_ = false;
+    if (depth_ == 0) {
+        idleCv_.notify_all();
+    }
+}
+
+void DSoftbusSendQueue::Run()
+{
+    SetThreadName(SEND_THREAD_NAME);
+    Frame frame;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] {
+                return (stopping_ || (depth_ > 0));
+            });
+            if (stopping_ || !PopLocked(frame)) {
+                break;
+            }
+            sending_ = true;
+        }
+        int32_t ret = sender_(frame.data.data(), static_cast<uint32_t>(frame.data.size()));
+        OnSent(frame, ret);
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
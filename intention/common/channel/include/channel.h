@@ -16,11 +16,14 @@
 #ifndef CHANNEL_H
 #define CHANNEL_H
 
+#include <chrono>
+#include <algorithm>
 #include <condition_variable>
-#include <deque>
 #include <memory>
 #include <mutex>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace OHOS {
 namespace Msdp {
@@ -41,6 +44,9 @@ public:
         INACTIVE_CHANNEL = -3,
     };
 
+    // Returns true if |incoming| may replace |queued|, the last event still waiting in the queue.
+    using Coalescer = bool (*)(const Event &queued, const Event &incoming);
+
     class Sender final {
         friend class Channel<Event>;
 
@@ -79,6 +85,14 @@ public:
             return channel_->Send(event);
         }
 
+        int32_t Send(Event &&event)
+        {
+            if (channel_ == nullptr) {
+                return ChannelError::NO_CHANNEL;
+            }
+            return channel_->Send(std::move(event));
+        }
+
     private:
         Sender(std::shared_ptr<Channel<Event>> channel)
             : channel_(channel)
@@ -148,6 +162,21 @@ public:
             return (channel_ != nullptr ? channel_->Receive() : Event());
         }
 
+        bool TryReceive(Event &event)
+        {
+            return (channel_ != nullptr ? channel_->TryReceive(event) : false);
+        }
+
+        size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount)
+        {
+            return (channel_ != nullptr ? channel_->ReceiveBatch(events, maxCount) : 0);
+        }
+
+        size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount, std::chrono::milliseconds timeout)
+        {
+            return (channel_ != nullptr ? channel_->ReceiveBatch(events, maxCount, timeout) : 0);
+        }
+
     private:
         Receiver(std::shared_ptr<Channel<Event>> channel)
             : channel_(channel)
@@ -159,28 +188,46 @@ public:
     Channel() = default;
     ~Channel() = default;
 
-    static std::pair<Sender, Receiver> OpenChannel();
+    static std::pair<Sender, Receiver> OpenChannel(Coalescer coalescer = nullptr);
 
 private:
     void Enable();
     void Disable();
     int32_t Send(const Event &event);
+    int32_t Send(Event &&event);
+    template<typename T>
+    int32_t Push(T &&event);
     Event Peek();
     void Pop();
     Event Receive();
+    bool TryReceive(Event &event);
+    size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount);
+    size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount, std::chrono::milliseconds timeout);
+    size_t DrainLocked(std::vector<Event> &events, size_t maxCount);
+    Event TakeFrontLocked();
+    void ClearLocked();
+    bool Grow();
 
     static inline constexpr size_t QUEUE_CAPACITY { 1024 };
+    static inline constexpr size_t INITIAL_RING_SIZE { 16 };
 
     std::mutex lock_;
     bool isActive_ { false };
     std::condition_variable empty_;
-    std::deque<Event> queue_;
+    Coalescer coalescer_ { nullptr };
+    // Events live in a ring of slots that grows up to QUEUE_CAPACITY and is reused
+    // afterwards, so steady-state traffic does not allocate per event.
+    std::vector<Event> ring_;
+    size_t head_ { 0 };
+    size_t count_ { 0 };
 };
 
 template<typename Event>
-std::pair<typename Channel<Event>::Sender, typename Channel<Event>::Receiver> Channel<Event>::OpenChannel()
+std::pair<typename Channel<Event>::Sender, typename Channel<Event>::Receiver> Channel<Event>::OpenChannel(
+    Coalescer coalescer)
 {
     std::shared_ptr<Channel<Event>> channel = std::make_shared<Channel<Event>>();
+    channel->coalescer_ = coalescer;
     return std::make_pair(Channel<Event>::Sender(channel), Channel<Event>::Receiver(channel));
 }
 
@@ -196,63 +243,163 @@ void Channel<Event>::Disable()
 {
     std::unique_lock<std::mutex> lock(lock_);
     isActive_ = false;
-    queue_.clear();
+    ClearLocked();
 }
 
 template<typename Event>
 int32_t Channel<Event>::Send(const Event &event)
+{
+    return Push(event);
+}
+
+template<typename Event>
+int32_t Channel<Event>::Send(Event &&event)
+{
+    return Push(std::move(event));
+}
+
+template<typename Event>
+template<typename T>
+int32_t Channel<Event>::Push(T &&event)
 {
     std::unique_lock<std::mutex> lock(lock_);
     if (!isActive_) {
         return ChannelError::INACTIVE_CHANNEL;
     }
-    if (queue_.size() >= QUEUE_CAPACITY) {
+    if ((count_ > 0) && (coalescer_ != nullptr)) {
+        Event &back = ring_[(head_ + count_ - 1) % ring_.size()];
+        if (coalescer_(back, event)) {
+            back = std::forward<T>(event);
+            return ChannelError::NO_ERROR;
+        }
+    }
+    if ((count_ == ring_.size()) && !Grow()) {
         return ChannelError::QUEUE_IS_FULL;
     }
-    bool needNotify = queue_.empty();
-    queue_.push_back(event);
+    ring_[(head_ + count_) % ring_.size()] = std::forward<T>(event);
+    bool needNotify = (count_ == 0);
+    ++count_;
     if (needNotify) {
         empty_.notify_all();
     }
     return ChannelError::NO_ERROR;
 }
 
+template<typename Event>
+bool Channel<Event>::Grow()
+{
+    if (ring_.size() >= QUEUE_CAPACITY) {
+        return false;
+    }
+    std::vector<Event> ring(std::clamp(ring_.size() * 2, INITIAL_RING_SIZE, QUEUE_CAPACITY));
+    for (size_t index = 0; index < count_; ++index) {
+        ring[index] = std::move(ring_[(head_ + index) % ring_.size()]);
+    }
+    ring_.swap(ring);
+    head_ = 0;
+    return true;
+}
+
+template<typename Event>
+Event Channel<Event>::TakeFrontLocked()
+{
+    Event event = std::move(ring_[head_]);
+    ring_[head_] = Event();
+    head_ = (head_ + 1) % ring_.size();
+    --count_;
+    return event;
+}
+
+template<typename Event>
+void Channel<Event>::ClearLocked()
+{
+    while (count_ > 0) {
+        TakeFrontLocked();
+    }
+}
+
 template<typename Event>
 Event Channel<Event>::Peek()
 {
     std::unique_lock<std::mutex> lock(lock_);
-    if (queue_.empty()) {
+    if (count_ == 0) {
         empty_.wait(lock, [this] {
-            return !queue_.empty();
+            return (count_ > 0);
         });
     }
-    return queue_.front();
+    return ring_[head_];
 }
 
 template<typename Event>
 void Channel<Event>::Pop()
 {
     std::unique_lock<std::mutex> lock(lock_);
-    if (queue_.empty()) {
+    if (count_ == 0) {
         empty_.wait(lock, [this] {
-            return !queue_.empty();
+            return (count_ > 0);
         });
     }
-    queue_.pop_front();
+    TakeFrontLocked();
 }
 
 template<typename Event>
 Event Channel<Event>::Receive()
 {
     std::unique_lock<std::mutex> lock(lock_);
-    if (queue_.empty()) {
+    if (count_ == 0) {
         empty_.wait(lock, [this] {
-            return !queue_.empty();
+            return (count_ > 0);
         });
     }
-    Event event = queue_.front();
-    queue_.pop_front();
-    return event;
+    return TakeFrontLocked();
+}
+
+template<typename Event>
+bool Channel<Event>::TryReceive(Event &event)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    if (count_ == 0) {
+        return false;
+    }
+    event = TakeFrontLocked();
+    return true;
+}
+
+template<typename Event>
+size_t Channel<Event>::ReceiveBatch(std::vector<Event> &events, size_t maxCount)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    if (count_ == 0) {
+        empty_.wait(lock, [this] {
+            return (count_ > 0);
+        });
+    }
+    return DrainLocked(events, maxCount);
+}
+
+template<typename Event>
+size_t Channel<Event>::ReceiveBatch(std::vector<Event> &events, size_t maxCount, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    if (count_ == 0) {
+        if (!empty_.wait_for(lock, timeout, [this] {
+            return (count_ > 0);
+        })) {
+            return 0;
+        }
+    }
+    return DrainLocked(events, maxCount);
+}
+
+template<typename Event>
+size_t Channel<Event>::DrainLocked(std::vector<Event> &events, size_t maxCount)
+{
+    size_t count = 0;
+    while ((count_ > 0) && (count < maxCount)) {
+        events.push_back(TakeFrontLocked());
+        ++count;
+    }
+    return count;
 }
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RING_CHANNEL_H
+#define RING_CHANNEL_H
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+
+/**
+ * Bounded multi-producer/single-consumer channel backed by a lock-free ring buffer.
+ *
+ * Offers the same Sender/Receiver interface as Channel<Event>. Senders never take a lock;
+ * the receiver blocks on an eventfd only when the ring is empty, and senders signal it
+ * only when the receiver has announced that it is going to sleep.
+ */
+template<typename Event>
+class RingChannel {
+    static_assert(std::is_enum_v<Event> || std::is_integral_v<Event> ||
+                  (std::is_class_v<Event> &&
+                   std::is_default_constructible_v<Event> &&
+                   std::is_move_constructible_v<Event>));
+
+public:
+    enum ChannelError {
+        NO_ERROR = 0,
+        QUEUE_IS_FULL = -1,
+        NO_CHANNEL = -2,
+        INACTIVE_CHANNEL = -3,
+    };
+
+    class Sender final {
+        friend class RingChannel<Event>;
+
+    public:
+        Sender() = default;
+        ~Sender() = default;
+
+        Sender(const Sender &other)
+            : channel_(other.channel_)
+        {}
+
+        Sender(Sender &&other)
+            : channel_(other.channel_)
+        {
+            other.channel_ = nullptr;
+        }
+
+        Sender& operator=(const Sender &other)
+        {
+            channel_ = other.channel_;
+            return *this;
+        }
+
+        Sender& operator=(Sender &&other)
+        {
+            channel_ = other.channel_;
+            other.channel_ = nullptr;
+            return *this;
+        }
+
+        int32_t Send(const Event &event)
+        {
+            if (channel_ == nullptr) {
+                return ChannelError::NO_CHANNEL;
+            }
+            return channel_->Send(Event(event));
+        }
+
+        int32_t Send(Event &&event)
+        {
+            if (channel_ == nullptr) {
+                return ChannelError::NO_CHANNEL;
+            }
+            return channel_->Send(std::move(event));
+        }
+
+    private:
+        Sender(std::shared_ptr<RingChannel<Event>> channel)
+            : channel_(channel)
+        {}
+
+        std::shared_ptr<RingChannel<Event>> channel_ { nullptr };
+    };
+
+    class Receiver final {
+        friend class RingChannel<Event>;
+
+    public:
+        Receiver() = default;
+        ~Receiver() = default;
+
+        Receiver(const Receiver &other)
+            : channel_(other.channel_)
+        {}
+
+        Receiver(Receiver &&other)
+            : channel_(other.channel_)
+        {
+            other.channel_ = nullptr;
+        }
+
+        Receiver& operator=(const Receiver &other)
+        {
+            channel_ = other.channel_;
+            return *this;
+        }
+
+        Receiver& operator=(Receiver &&other)
+        {
+            channel_ = other.channel_;
+            other.channel_ = nullptr;
+            return *this;
+        }
+
+        void Enable()
+        {
+            if (channel_ != nullptr) {
+                channel_->Enable();
+            }
+        }
+
+        void Disable()
+        {
+            if (channel_ != nullptr) {
+                channel_->Disable();
+            }
+        }
+
+        Event Peek()
+        {
+            return (channel_ != nullptr ? channel_->Peek() : Event());
+        }
+
+        void Pop()
+        {
+            if (channel_ != nullptr) {
+                channel_->Pop();
+            }
+        }
+
+        Event Receive()
+        {
+            return (channel_ != nullptr ? channel_->Receive() : Event());
+        }
+
+        bool TryReceive(Event &event)
+        {
+            return (channel_ != nullptr ? channel_->TryReceive(event) : false);
+        }
+
+        size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount)
+        {
+            return (channel_ != nullptr ? channel_->ReceiveBatch(events, maxCount) : 0);
+        }
+
+        size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount, std::chrono::milliseconds timeout)
+        {
+            return (channel_ != nullptr ? channel_->ReceiveBatch(events, maxCount, timeout) : 0);
+        }
+
+    private:
+        Receiver(std::shared_ptr<RingChannel<Event>> channel)
+            : channel_(channel)
+        {}
+
+        std::shared_ptr<RingChannel<Event>> channel_ { nullptr };
+    };
+
+    explicit RingChannel(size_t capacity);
+    ~RingChannel();
+    RingChannel(const RingChannel &) = delete;
+    RingChannel& operator=(const RingChannel &) = delete;
+
+    static std::pair<Sender, Receiver> OpenChannel(size_t capacity = DEFAULT_CAPACITY);
+
+    size_t Capacity() const
+    {
+        return mask_ + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence { 0 };
+        Event event {};
+    };
+
+    void Enable();
+    void Disable();
+    int32_t Send(Event &&event);
+    Event Peek();
+    void Pop();
+    Event Receive();
+    bool TryReceive(Event &event);
+    size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount);
+    size_t ReceiveBatch(std::vector<Event> &events, size_t maxCount, std::chrono::milliseconds timeout);
+
+    bool TryPush(Event &&event);
+    Cell* Front();
+    void Advance(Cell *cell);
+    size_t Drain(std::vector<Event> &events, size_t maxCount);
+    void WaitNotEmpty();
+    bool WaitNotEmpty(std::chrono::milliseconds timeout);
+    void Wakeup();
+
+    static size_t RoundUpCapacity(size_t capacity);
+
+    static inline constexpr size_t DEFAULT_CAPACITY { 1024 };
+    static inline constexpr size_t MIN_CAPACITY { 2 };
+
+    std::vector<Cell> cells_;
+    size_t mask_ { 0 };
+    int32_t eventFd_ { -1 };
+    std::atomic_bool isActive_ { false };
+    alignas(64) std::atomic<size_t> tail_ { 0 };
+    alignas(64) size_t head_ { 0 };
+    std::atomic_bool waiting_ { false };
+};
+
+template<typename Event>
+RingChannel<Event>::RingChannel(size_t capacity)
+    : cells_(RoundUpCapacity(capacity)), mask_(cells_.size() - 1)
+{
+    for (size_t index = 0; index < cells_.size(); ++index) {
+        cells_[index].sequence.store(index, std::memory_order_relaxed);
+    }
+    eventFd_ = ::eventfd(0, EFD_CLOEXEC);
+}
+
+template<typename Event>
+RingChannel<Event>::~RingChannel()
+{
+    if (eventFd_ >= 0) {
+        ::close(eventFd_);
+        eventFd_ = -1;
+    }
+}
+
+template<typename Event>
+std::pair<typename RingChannel<Event>::Sender, typename RingChannel<Event>::Receiver>
+RingChannel<Event>::OpenChannel(size_t capacity)
+{
+    std::shared_ptr<RingChannel<Event>> channel = std::make_shared<RingChannel<Event>>(capacity);
+    return std::make_pair(RingChannel<Event>::Sender(channel), RingChannel<Event>::Receiver(channel));
+}
+
+template<typename Event>
+size_t RingChannel<Event>::RoundUpCapacity(size_t capacity)
+{
+    size_t rounded = MIN_CAPACITY;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    return rounded;
+}
+
+template<typename Event>
+void RingChannel<Event>::Enable()
+{
+    isActive_.store(true);
+}
+
+template<typename Event>
+void RingChannel<Event>::Disable()
+{
+    isActive_.store(false);
+    for (Cell *cell = Front(); cell != nullptr; cell = Front()) {
+        cell->event = Event();
+        Advance(cell);
+    }
+}
+
+template<typename Event>
+int32_t RingChannel<Event>::Send(Event &&event)
+{
+    if (!isActive_.load(std::memory_order_acquire)) {
+        return ChannelError::INACTIVE_CHANNEL;
+    }
+    if (!TryPush(std::move(event))) {
+        return ChannelError::QUEUE_IS_FULL;
+    }
+    Wakeup();
+    return ChannelError::NO_ERROR;
+}
+
+template<typename Event>
+Event RingChannel<Event>::Peek()
+{
+    WaitNotEmpty();
+    return Front()->event;
+}
+
+template<typename Event>
+void RingChannel<Event>::Pop()
+{
+    WaitNotEmpty();
+    Cell *cell = Front();
+    cell->event = Event();
+    Advance(cell);
+}
+
+template<typename Event>
+Event RingChannel<Event>::Receive()
+{
+    WaitNotEmpty();
+    Cell *cell = Front();
+    Event event = std::move(cell->event);
+    Advance(cell);
+    return event;
+}
+
+template<typename Event>
+bool RingChannel<Event>::TryReceive(Event &event)
+{
+    Cell *cell = Front();
+    if (cell == nullptr) {
+        return false;
+    }
+    event = std::move(cell->event);
+    Advance(cell);
+    return true;
+}
+
+template<typename Event>
+size_t RingChannel<Event>::ReceiveBatch(std::vector<Event> &events, size_t maxCount)
+{
+    WaitNotEmpty();
+    return Drain(events, maxCount);
+}
+
+template<typename Event>
+size_t RingChannel<Event>::ReceiveBatch(std::vector<Event> &events, size_t maxCount,
+    std::chrono::milliseconds timeout)
+{
+    if (!WaitNotEmpty(timeout)) {
+        return 0;
+    }
+    return Drain(events, maxCount);
+}
+
+template<typename Event>
+bool RingChannel<Event>::TryPush(Event &&event)
+{
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell &cell = cells_[pos & mask_];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.event = std::move(event);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename Event>
+typename RingChannel<Event>::Cell* RingChannel<Event>::Front()
+{
+    Cell &cell = cells_[head_ & mask_];
+    if (cell.sequence.load(std::memory_order_acquire) != head_ + 1) {
+        return nullptr;
+    }
+    return &cell;
+}
+
+template<typename Event>
+void RingChannel<Event>::Advance(Cell *cell)
+{
+    cell->sequence.store(head_ + mask_ + 1, std::memory_order_release);
+    ++head_;
+}
+
+template<typename Event>
+size_t RingChannel<Event>::Drain(std::vector<Event> &events, size_t maxCount)
+{
+    size_t count = 0;
+    for (Cell *cell = Front(); (cell != nullptr) && (count < maxCount); cell = Front()) {
+        events.push_back(std::move(cell->event));
+        Advance(cell);
+        ++count;
+    }
+    return count;
+}
+
+template<typename Event>
+void RingChannel<Event>::WaitNotEmpty()
+{
+    while (Front() == nullptr) {
+        waiting_.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (Front() != nullptr) {
+            waiting_.store(false);
+            break;
+        }
+        uint64_t count = 0;
+        if ((::read(eventFd_, &count, sizeof(count)) < 0) && (errno != EINTR)) {
+            waiting_.store(false);
+            ::usleep(1);
+        }
+    }
+}
+
+template<typename Event>
+bool RingChannel<Event>::WaitNotEmpty(std::chrono::milliseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (Front() == nullptr) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) {
+            return false;
+        }
+        waiting_.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (Front() != nullptr) {
+            waiting_.store(false);
+            break;
+        }
+        struct pollfd pfd {};
+        pfd.fd = eventFd_;
+        pfd.events = POLLIN;
+        if (::poll(&pfd, 1, static_cast<int>(remaining.count())) > 0) {
+            uint64_t count = 0;
+            [[maybe_unused]] auto ret = ::read(eventFd_, &count, sizeof(count));
+        } else {
+            waiting_.store(false);
+        }
+    }
+    return true;
+}
+
+template<typename Event>
+void RingChannel<Event>::Wakeup()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_.exchange(false)) {
+        uint64_t count = 1;
+        while ((::write(eventFd_, &count, sizeof(count)) < 0) && (errno == EINTR)) {}
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // RING_CHANNEL_H
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EPOLL_LOOP_H
+#define EPOLL_LOOP_H
+
+#include <atomic>
+#include <cinttypes>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "nocopyable.h"
+
+#include "i_epoll_event_source.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// One worker thread waiting on its own epoll instance. Sources registered here
+// are dispatched only on this thread, so a slow source delays nothing but its
+// own loop.
+class EpollLoop final {
+public:
+    struct Metrics {
+        uint64_t nWakeups { 0 };
+        uint64_t nDispatched { 0 };
+        // Time from epoll_wait returning to the end of an event's dispatch,
+        // including the time it waited behind earlier events of the batch.
+        uint64_t totalLatencyUs { 0 };
+        uint64_t maxLatencyUs { 0 };
+        size_t nSources { 0 };
+    };
+
+    explicit EpollLoop(size_t index);
+    ~EpollLoop();
+    DISALLOW_COPY_AND_MOVE(EpollLoop);
+
+    bool Start();
+    void Stop();
+    bool IsRunning() const;
+
+    bool Add(std::shared_ptr<IEpollEventSource> source);
+    void Remove(int32_t fd);
+    bool Update(std::shared_ptr<IEpollEventSource> source);
+
+    size_t GetIndex() const;
+    Metrics GetMetrics() const;
+    void ResetMetrics();
+
+    static void DispatchEvent(IEpollEventSource &source, const struct epoll_event &ev);
+
+private:
+    void Run();
+    void OnWakeup();
+    void Record(uint64_t latencyUs);
+    std::shared_ptr<IEpollEventSource> FindSource(int32_t fd) const;
+
+private:
+    const size_t index_;
+    int32_t epollFd_ { -1 };
+    int32_t wakeFd_ { -1 };
+    std::atomic<bool> running_ { false };
+    std::thread worker_;
+    mutable std::mutex lock_;
+    std::map<int32_t, std::shared_ptr<IEpollEventSource>> sources_;
+    std::atomic<uint64_t> nWakeups_ { 0 };
+    std::atomic<uint64_t> nDispatched_ { 0 };
+    std::atomic<uint64_t> totalLatencyUs_ { 0 };
+    std::atomic<uint64_t> maxLatencyUs_ { 0 };
+};
+
+inline size_t EpollLoop::GetIndex() const
+{
+    return index_;
+}
+
+inline bool EpollLoop::IsRunning() const
+{
+    return running_.load(std::memory_order_acquire);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // EPOLL_LOOP_H
\ No newline at end of file
@@ -17,12 +17,15 @@
 #define EPOLL_MANAGER_H
 
 #include <cinttypes>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "nocopyable.h"
 
+#include "epoll_loop.h"
 #include "i_epoll_event_source.h"
 
 namespace OHOS {
@@ -30,6 +33,10 @@ namespace Msdp {
 namespace DeviceStatus {
 class EpollManager final : public IEpollEventSource {
 public:
+    // Picks the worker loop, in [0, nLoops), that a source is pinned to.
+    using AffinityPolicy = std::function<size_t(const IEpollEventSource &source, size_t nLoops)>;
+    using LoopMetrics = EpollLoop::Metrics;
+
     EpollManager() = default;
     ~EpollManager();
     DISALLOW_COPY_AND_MOVE(EpollManager);
@@ -43,17 +50,49 @@ public:
     int32_t Wait(struct epoll_event *events, int32_t maxevents);
     int32_t WaitTimeout(struct epoll_event *events, int32_t maxevents, int32_t timeout);
 
+    // Multi-worker mode: every source is moved to one of @nLoops worker loops, each
+    // with its own thread and epoll instance. Sources added afterwards are placed
+    // by @policy, by fd when no policy is given. StopWorkers() moves them back.
+    bool StartWorkers(size_t nLoops, AffinityPolicy policy = nullptr);
+    void StopWorkers();
+    bool AddToLoop(std::shared_ptr<IEpollEventSource> source, size_t loop);
+    size_t GetLoopCount() const;
+    bool GetLoopMetrics(size_t loop, LoopMetrics &metrics) const;
+
+    // Registers this epoll fd edge-triggered with an outer loop; Dispatch() then
+    // drains all ready events instead of one batch.
+    void SetEdgeTriggered(bool edgeTriggered);
+
+    uint32_t GetEvents() const override;
     int32_t GetFd() const override;
     void Dispatch(const struct epoll_event &ev) override;
 
 private:
     void DispatchOne(const struct epoll_event &ev);
+    bool AddLocked(std::shared_ptr<IEpollEventSource> source, size_t loop);
+    size_t PickLoop(const IEpollEventSource &source) const;
+    bool EpollCtl(int32_t op, std::shared_ptr<IEpollEventSource> source);
 
 private:
     int32_t epollFd_ { -1 };
+    bool edgeTriggered_ { false };
+    mutable std::mutex lock_;
     std::map<int32_t, std::shared_ptr<IEpollEventSource>> sources_;
+    std::vector<std::shared_ptr<EpollLoop>> loops_;
+    std::map<int32_t, size_t> affinity_;
+    AffinityPolicy policy_;
 };
 
+inline void EpollManager::SetEdgeTriggered(bool edgeTriggered)
+{
+    edgeTriggered_ = edgeTriggered;
+}
+
+inline uint32_t EpollManager::GetEvents() const
+{
+    return (edgeTriggered_ ? (IEpollEventSource::GetEvents() | EPOLLET) : IEpollEventSource::GetEvents());
+}
+
 inline int32_t EpollManager::GetFd() const
 {
     return epollFd_;
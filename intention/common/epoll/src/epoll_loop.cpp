@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "epoll_loop.h"
+
+#include <chrono>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "devicestatus_define.h"
+#include "util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "EpollLoop"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int32_t MAX_N_EVENTS { 64 };
+constexpr uint64_t DOMAIN_ID { 0xD002220 };
+
+uint64_t ElapsedUs(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+} // namespace
+
+EpollLoop::EpollLoop(size_t index)
+    : index_(index)
+{}
+
+EpollLoop::~EpollLoop()
+{
+    Stop();
+}
+
+bool EpollLoop::Start()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    if (epollFd_ != -1) {
+        return true;
+    }
+    epollFd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ == -1) {
+        FI_HILOGE("epoll_create1 failed:%{public}s", ::strerror(errno));
+        return false;
+    }
+    fdsan_exchange_owner_tag(epollFd_, 0, DOMAIN_ID);
+    wakeFd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (wakeFd_ == -1) {
+        FI_HILOGE("eventfd failed:%{public}s", ::strerror(errno));
+        fdsan_close_with_tag(epollFd_, DOMAIN_ID);
+        epollFd_ = -1;
+        return false;
+    }
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    ev.data.fd = wakeFd_;
+    if (::epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeFd_, &ev) != 0) {
+        FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
+        ::close(wakeFd_);
+        wakeFd_ = -1;
+        fdsan_close_with_tag(epollFd_, DOMAIN_ID);
+        epollFd_ = -1;
+        return false;
+    }
+    running_.store(true, std::memory_order_release);
+    worker_ = std::thread([this] { this->Run(); });
+    FI_HILOGI("Epoll loop(%{public}zu) started", index_);
+    return true;
+}
+
+void EpollLoop::Stop()
+{
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (worker_.get_id() == std::this_thread::get_id()) {
+        FI_HILOGE("Epoll loop(%{public}zu) can not be stopped from its own thread", index_);
+        running_.store(true, std::memory_order_release);
+        return;
+    }
+    uint64_t one { 1 };
+    if (::write(wakeFd_, &one, sizeof(one)) != static_cast<ssize_t>(sizeof(one))) {
+        FI_HILOGW("Wake up epoll loop(%{public}zu) failed:%{public}s", index_, ::strerror(errno));
+    }
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    sources_.clear();
+    ::close(wakeFd_);
+    wakeFd_ = -1;
+    fdsan_close_with_tag(epollFd_, DOMAIN_ID);
+    epollFd_ = -1;
+    FI_HILOGI("Epoll loop(%{public}zu) stopped", index_);
+}
+
+bool EpollLoop::Add(std::shared_ptr<IEpollEventSource> source)
+{
+    CHKPF(source);
+    std::lock_guard<std::mutex> guard(lock_);
+    if (epollFd_ == -1) {
+        FI_HILOGE("Epoll loop(%{public}zu) is not started", index_);
+        return false;
+    }
+    auto [iter, isNew] = sources_.emplace(source->GetFd(), source);
+    if (!isNew) {
+        FI_HILOGW("Epoll source(%{public}d) has been added", source->GetFd());
+        return true;
+    }
+    struct epoll_event ev {};
+    ev.events = source->GetEvents();
+    ev.data.fd = source->GetFd();
+
+    if (::epoll_ctl(epollFd_, EPOLL_CTL_ADD, source->GetFd(), &ev) != 0) {
+        FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
+        sources_.erase(iter);
+        return false;
+    }
+    return true;
+}
+
+void EpollLoop::Remove(int32_t fd)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    auto iter = sources_.find(fd);
+    if (iter == sources_.end()) {
+        return;
+    }
+    if ((epollFd_ != -1) && (::epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr) != 0)) {
+        FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
+    }
+    sources_.erase(iter);
+}
+
+bool EpollLoop::Update(std::shared_ptr<IEpollEventSource> source)
+{
+    CHKPF(source);
+    std::lock_guard<std::mutex> guard(lock_);
+    auto iter = sources_.find(source->GetFd());
+    if ((iter == sources_.end()) || (epollFd_ == -1)) {
+        FI_HILOGE("No epoll source(%{public}d)", source->GetFd());
+        return false;
+    }
+    struct epoll_event ev {};
+    ev.events = source->GetEvents();
+    ev.data.fd = source->GetFd();
+
+    if (::epoll_ctl(epollFd_, EPOLL_CTL_MOD, source->GetFd(), &ev) != 0) {
+        FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
+        return false;
+    }
+    iter->second = source;
+    return true;
+}
+
+EpollLoop::Metrics EpollLoop::GetMetrics() const
+{
+    Metrics metrics;
+    metrics.nWakeups = nWakeups_.load(std::memory_order_relaxed);
+    metrics.nDispatched = nDispatched_.load(std::memory_order_relaxed);
+    metrics.totalLatencyUs = totalLatencyUs_.load(std::memory_order_relaxed);
+    metrics.maxLatencyUs = maxLatencyUs_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> guard(lock_);
+    metrics.nSources = sources_.size();
+    return metrics;
+}
+
+void EpollLoop::ResetMetrics()
+{
+    nWakeups_.store(0, std::memory_order_relaxed);
+    nDispatched_.store(0, std::memory_order_relaxed);
+    totalLatencyUs_.store(0, std::memory_order_relaxed);
+    maxLatencyUs_.store(0, std::memory_order_relaxed);
+}
+
+void EpollLoop::DispatchEvent(IEpollEventSource &source, const struct epoll_event &ev)
+{
+    // Edge-triggered sources are not told again about a condition they missed,
+    // so they get hangups and errors as well and must drain their fd.
+    if (((ev.events & (EPOLLIN | EPOLLOUT)) != 0) || ((source.GetEvents() & EPOLLET) == EPOLLET)) {
+        source.Dispatch(ev);
+    } else if ((ev.events & (EPOLLHUP | EPOLLERR)) != 0) {
+        FI_HILOGE("Epoll hangup:%{public}s", ::strerror(errno));
+    }
+}
+
+void EpollLoop::Run()
+{
+    SetThreadName(std::string("os_ds_epoll") + std::to_string(index_));
+    struct epoll_event evs[MAX_N_EVENTS];
+
+    while (running_.load(std::memory_order_acquire)) {
+        int32_t cnt = ::epoll_wait(epollFd_, evs, MAX_N_EVENTS, -1);
+        if (cnt < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            FI_HILOGE("epoll_wait failed:%{public}s", ::strerror(errno));
+            break;
+        }
+        auto woken = std::chrono::steady_clock::now();
+        nWakeups_.fetch_add(1, std::memory_order_relaxed);
+
+        for (int32_t index = 0; index < cnt; ++index) {
+            if (evs[index].data.fd == wakeFd_) {
+                OnWakeup();
+                continue;
+            }
+            auto source = FindSource(evs[index].data.fd);
+            if (source == nullptr) {
+                continue;
+            }
+            DispatchEvent(*source, evs[index]);
+            Record(ElapsedUs(woken));
+        }
+    }
+}
+
+void EpollLoop::OnWakeup()
+{
+    uint64_t value {};
+    if (::read(wakeFd_, &value, sizeof(value)) < 0) {
+        FI_HILOGW("read failed:%{public}s", ::strerror(errno));
+    }
+}
+
+void EpollLoop::Record(uint64_t latencyUs)
+{
+    nDispatched_.fetch_add(1, std::memory_order_relaxed);
+    totalLatencyUs_.fetch_add(latencyUs, std::memory_order_relaxed);
+    uint64_t maxLatency = maxLatencyUs_.load(std::memory_order_relaxed);
+    while ((latencyUs > maxLatency) &&
+        !maxLatencyUs_.compare_exchange_weak(maxLatency, latencyUs, std::memory_order_relaxed)) {}
+}
+
+std::shared_ptr<IEpollEventSource> EpollLoop::FindSource(int32_t fd) const
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    auto iter = sources_.find(fd);
+    return (iter != sources_.end() ? iter->second : nullptr);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -51,6 +51,7 @@ bool EpollManager::Open()
 
 void EpollManager::Close()
 {
+    StopWorkers();
     if (epollFd_ != -1) {
         fdsan_close_with_tag(epollFd_, DOMAIN_ID);
         epollFd_ = -1;
@@ -60,37 +61,27 @@ void EpollManager::Close()
 bool EpollManager::Add(std::shared_ptr<IEpollEventSource> source)
 {
     CHKPF(source);
-    auto [iter, isNew] = sources_.emplace(source->GetFd(), source);
-    if (!isNew) {
-        FI_HILOGW("Epoll source(%d) has been added", source->GetFd());
-        return true;
-    }
-    struct epoll_event ev {};
-    ev.events = source->GetEvents();
-    ev.data.ptr = source.get();
-
-    int32_t ret = ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, source->GetFd(), &ev);
-    if (ret != 0) {
-        FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
-        sources_.erase(iter);
-        return false;
-    }
-    FI_HILOGI("Add epoll source(%d)", source->GetFd());
-    return true;
+    std::lock_guard<std::mutex> guard(lock_);
+    return AddLocked(source, PickLoop(*source));
 }
 
 void EpollManager::Remove(std::shared_ptr<IEpollEventSource> source)
 {
     CHKPV(source);
+    std::lock_guard<std::mutex> guard(lock_);
     auto iter = sources_.find(source->GetFd());
     if (iter == sources_.cend()) {
         FI_HILOGE("No epoll source(%d)", source->GetFd());
         return;
     }
     FI_HILOGI("Remove epoll source(%d)", source->GetFd());
-    int32_t ret = ::epoll_ctl(epollFd_, EPOLL_CTL_DEL, source->GetFd(), nullptr);
-    if (ret != 0) {
-        FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
+    if (loops_.empty()) {
+        if (::epoll_ctl(epollFd_, EPOLL_CTL_DEL, source->GetFd(), nullptr) != 0) {
+            FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
+        }
+    } else if (auto aIter = affinity_.find(source->GetFd()); aIter != affinity_.end()) {
+        loops_[aIter->second]->Remove(source->GetFd());
+        affinity_.erase(aIter);
     }
     sources_.erase(iter);
 }
@@ -98,21 +89,159 @@ void EpollManager::Remove(std::shared_ptr<IEpollEventSource> source)
 bool EpollManager::Update(std::shared_ptr<IEpollEventSource> source)
 {
     CHKPF(source);
+    std::lock_guard<std::mutex> guard(lock_);
     auto iter = sources_.find(source->GetFd());
     if (iter == sources_.cend()) {
         FI_HILOGE("No epoll source(%d)", source->GetFd());
         return false;
     }
+    if (loops_.empty()) {
+        if (!EpollCtl(EPOLL_CTL_MOD, source)) {
+            return false;
+        }
+    } else if (auto aIter = affinity_.find(source->GetFd());
+        (aIter == affinity_.end()) || !loops_[aIter->second]->Update(source)) {
+        return false;
+    }
+    iter->second = source;
+    return true;
+}
+
+bool EpollManager::StartWorkers(size_t nLoops, AffinityPolicy policy)
+{
+    if (nLoops == 0) {
+        FI_HILOGE("At least one worker loop is required");
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!loops_.empty()) {
+        FI_HILOGW("Worker loops have been started");
+        return true;
+    }
+    std::vector<std::shared_ptr<EpollLoop>> loops;
+    for (size_t index = 0; index < nLoops; ++index) {
+        auto loop = std::make_shared<EpollLoop>(index);
+        if (!loop->Start()) {
+            for (const auto &started : loops) {
+                started->Stop();
+            }
+            return false;
+        }
+        loops.push_back(loop);
+    }
+    loops_ = std::move(loops);
+    policy_ = std::move(policy);
+
+    for (const auto &[fd, source] : sources_) {
+        if ((epollFd_ != -1) && (::epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr) != 0)) {
+            FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
+        }
+        size_t loop = PickLoop(*source);
+        if (!loops_[loop]->Add(source)) {
+            FI_HILOGE("Failed to move epoll source(%{public}d) to loop(%{public}zu)", fd, loop);
+            continue;
+        }
+        affinity_.emplace(fd, loop);
+    }
+    FI_HILOGI("%{public}zu worker loops started", nLoops);
+    return true;
+}
+
+void EpollManager::StopWorkers()
+{
+    std::vector<std::shared_ptr<EpollLoop>> loops;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        loops = loops_;
+    }
+    if (loops.empty()) {
+        return;
+    }
+    // Stop without holding the lock, sources may still add or remove themselves
+    // from callbacks running on the worker threads.
+    for (const auto &loop : loops) {
+        loop->Stop();
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    loops_.clear();
+    affinity_.clear();
+    policy_ = nullptr;
+
+    for (const auto &[fd, source] : sources_) {
+        if ((epollFd_ == -1) || !EpollCtl(EPOLL_CTL_ADD, source)) {
+            FI_HILOGE("Failed to move epoll source(%{public}d) back", fd);
+        }
+    }
+}
+
+bool EpollManager::AddToLoop(std::shared_ptr<IEpollEventSource> source, size_t loop)
+{
+    CHKPF(source);
+    std::lock_guard<std::mutex> guard(lock_);
+    if (loop >= loops_.size()) {
+        FI_HILOGE("No worker loop(%{public}zu)", loop);
+        return false;
+    }
+    return AddLocked(source, loop);
+}
+
+size_t EpollManager::GetLoopCount() const
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    return loops_.size();
+}
+
+bool EpollManager::GetLoopMetrics(size_t loop, LoopMetrics &metrics) const
+{
+    std::shared_ptr<EpollLoop> epollLoop;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (loop >= loops_.size()) {
+            return false;
+        }
+        epollLoop = loops_[loop];
+    }
+    metrics = epollLoop->GetMetrics();
+    return true;
+}
+
+bool EpollManager::AddLocked(std::shared_ptr<IEpollEventSource> source, size_t loop)
+{
+    auto [iter, isNew] = sources_.emplace(source->GetFd(), source);
+    if (!isNew) {
+        FI_HILOGW("Epoll source(%d) has been added", source->GetFd());
+        return true;
+    }
+    if (loops_.empty() ? !EpollCtl(EPOLL_CTL_ADD, source) : !loops_[loop]->Add(source)) {
+        sources_.erase(iter);
+        return false;
+    }
+    if (!loops_.empty()) {
+        affinity_.emplace(source->GetFd(), loop);
+    }
+    FI_HILOGI("Add epoll source(%d)", source->GetFd());
+    return true;
+}
+
+size_t EpollManager::PickLoop(const IEpollEventSource &source) const
+{
+    if (loops_.empty()) {
+        return 0;
+    }
+    size_t loop = (policy_ != nullptr ? policy_(source, loops_.size()) : static_cast<size_t>(source.GetFd()));
+    return (loop % loops_.size());
+}
+
+bool EpollManager::EpollCtl(int32_t op, std::shared_ptr<IEpollEventSource> source)
+{
     struct epoll_event ev {};
     ev.events = source->GetEvents();
     ev.data.ptr = source.get();
 
-    int32_t ret = ::epoll_ctl(epollFd_, EPOLL_CTL_MOD, source->GetFd(), &ev);
-    if (ret != 0) {
+    if (::epoll_ctl(epollFd_, op, source->GetFd(), &ev) != 0) {
         FI_HILOGE("epoll_ctl failed:%{public}s", ::strerror(errno));
         return false;
     }
-    sources_.insert_or_assign(source->GetFd(), source);
     return true;
 }
 
@@ -145,17 +274,16 @@ void EpollManager::Dispatch(const struct epoll_event &ev)
 void EpollManager::DispatchOne(const struct epoll_event &ev)
 {
     struct epoll_event evs[MAX_N_EVENTS];
-    int32_t cnt = WaitTimeout(evs, MAX_N_EVENTS, 0);
-
-    for (int32_t index = 0; index < cnt; ++index) {
-        IEpollEventSource *source = reinterpret_cast<IEpollEventSource *>(evs[index].data.ptr);
-        CHKPC(source);
-        if ((evs[index].events & EPOLLIN) == EPOLLIN) {
-            source->Dispatch(evs[index]);
-        } else if ((evs[index].events & (EPOLLHUP | EPOLLERR)) != 0) {
-            FI_HILOGE("Epoll hangup:%{public}s", ::strerror(errno));
+    int32_t cnt {};
+
+    do {
+        cnt = WaitTimeout(evs, MAX_N_EVENTS, 0);
+        for (int32_t index = 0; index < cnt; ++index) {
+            IEpollEventSource *source = reinterpret_cast<IEpollEventSource *>(evs[index].data.ptr);
+            CHKPC(source);
+            EpollLoop::DispatchEvent(*source, evs[index]);
         }
-    }
+    } while (edgeTriggered_ && (cnt == MAX_N_EVENTS));
 }
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -59,6 +59,7 @@ public:
 
 private:
     void Loop();
+    bool HandleEvent(const CooperateEvent &event);
     void StartWorker();
     void StopWorker();
     void LoadMotionDrag();
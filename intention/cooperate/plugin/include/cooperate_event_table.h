@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATE_EVENT_TABLE_H
+#define COOPERATE_EVENT_TABLE_H
+
+#include <array>
+
+#include "cooperate_events.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+constexpr size_t N_COOPERATE_EVENT_TYPES {
+    static_cast<size_t>(CooperateEventType::N_COOPERATE_EVENT_TYPES) };
+
+// Dense handler table indexed by event type. Handlers are plain member-function pointers,
+// so registration does not allocate and dispatch is a single indexed load plus an indirect call.
+template<typename Owner, typename ContextType>
+class CooperateEventTable final {
+public:
+    using Handler = void (Owner::*)(ContextType &context, const CooperateEvent &event);
+
+    CooperateEventTable() = default;
+    ~CooperateEventTable() = default;
+
+    // The first handler registered for an event type is kept.
+    void Register(CooperateEventType type, Handler handler)
+    {
+        size_t index = static_cast<size_t>(type);
+        if ((index < handlers_.size()) && (handlers_[index] == nullptr)) {
+            handlers_[index] = handler;
+        }
+    }
+
+    bool Dispatch(Owner &owner, ContextType &context, const CooperateEvent &event) const
+    {
+        size_t index = static_cast<size_t>(event.type);
+        if ((index >= handlers_.size()) || (handlers_[index] == nullptr)) {
+            return false;
+        }
+        (owner.*handlers_[index])(context, event);
+        return true;
+    }
+
+private:
+    std::array<Handler, N_COOPERATE_EVENT_TYPES> handlers_ {};
+};
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // COOPERATE_EVENT_TABLE_H
\ No newline at end of file
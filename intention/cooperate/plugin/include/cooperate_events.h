@@ -18,11 +18,13 @@
 
 #include <future>
 #include <string>
+#include <utility>
 #include <variant>
 
 #include "coordination_message.h"
 #include "i_cooperate.h"
 #include "i_device.h"
+#include "mouse_location_stream.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -73,6 +75,8 @@ enum class CooperateEventType {
     DSOFTBUS_REPLY_SUBSCRIBE_MOUSE_LOCATION,
     DSOFTBUS_REPLY_UNSUBSCRIBE_MOUSE_LOCATION,
     DSOFTBUS_MOUSE_LOCATION,
+    DSOFTBUS_MOUSE_LOCATION_STREAM,
+    DSOFTBUS_INPUT_EVENT_SCHEMA,
     DSOFTBUS_INPUT_DEV_SYNC,
     DSOFTBUS_INPUT_DEV_HOT_PLUG,
     UPDATE_VIRTUAL_DEV_ID_MAP,
@@ -80,7 +84,8 @@ enum class CooperateEventType {
     DSOFTBUS_COOPERATE_WITH_OPTIONS,
     DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS,
     DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS_FINISHED,
-    STOP_ABOUT_VIRTUALTRACKPAD
+    STOP_ABOUT_VIRTUALTRACKPAD,
+    N_COOPERATE_EVENT_TYPES,
 };
 
 struct Rectangle {
@@ -237,6 +242,8 @@ struct DSoftbusRelayCooperate {
 struct DSoftbusSubscribeMouseLocation {
     std::string networkId;
     std::string remoteNetworkId;
+    // Whether the subscriber decodes DSOFTBUS_MOUSE_LOCATION_STREAM.
+    bool supportStream { false };
 };
 
 struct DSoftbusReplySubscribeMouseLocation {
@@ -257,6 +264,17 @@ struct DSoftbusSyncMouseLocation {
     LocationInfo mouseLocation;
 };
 
+struct DSoftbusMouseLocationStream {
+    std::string networkId;
+    LocationFrame frame;
+};
+
+// Highest pointer event schema the peer decodes, see compact_pointer_event_codec.h.
+struct DSoftbusInputEventSchema {
+    std::string networkId;
+    uint32_t schema { 0 };
+};
+
 struct DSoftbusSyncInputDevice {
     std::string networkId;
     std::vector<std::shared_ptr<IDevice>> devices;
@@ -315,7 +333,7 @@ struct CooperateEvent {
     explicit CooperateEvent(CooperateEventType ty) : type(ty) {}
 
     template<typename Event>
-    CooperateEvent(CooperateEventType ty, Event ev) : type(ty), event(ev) {}
+    CooperateEvent(CooperateEventType ty, Event ev) : type(ty), event(std::move(ev)) {}
 
     CooperateEventType type;
     std::variant<
@@ -329,6 +347,8 @@ struct CooperateEvent {
         DSoftbusSubscribeMouseLocation,
         DSoftbusReplySubscribeMouseLocation,
         DSoftbusSyncMouseLocation,
+        DSoftbusMouseLocationStream,
+        DSoftbusInputEventSchema,
         DumpEvent,
         DDMBoardOnlineEvent,
         InputHotplugEvent,
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATE_DEADLINE_TIMER_H
+#define COOPERATE_DEADLINE_TIMER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+// One-shot timer for deadlines of a few milliseconds. TimerManager raises any interval
+// below 50 ms and runs callbacks on the delegate thread; this timer instead waits on
+// steady_clock in a thread of its own, started on first use, and runs the callback there.
+class DeadlineTimer final {
+public:
+    using Callback = std::function<void()>;
+
+    DeadlineTimer() = default;
+    ~DeadlineTimer();
+    DISALLOW_COPY_AND_MOVE(DeadlineTimer);
+
+    // Run @callback once @delay has passed, replacing any pending callback.
+    int32_t Arm(std::chrono::microseconds delay, Callback callback);
+    // Drop the pending callback. A callback that is already running is not waited for.
+    void Cancel();
+    bool IsArmed() const;
+
+private:
+    void Run();
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread worker_;
+    Callback callback_;
+    std::chrono::steady_clock::time_point deadline_;
+    bool armed_ { false };
+    bool stopping_ { false };
+};
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // COOPERATE_DEADLINE_TIMER_H
@@ -47,7 +47,7 @@ class DSoftbusHandler final {
             parent_.OnConnected(networkId);
         }
 
-        bool OnPacket(const std::string &networkId, NetPacket &packet) override
+        bool OnPacket(const std::string &networkId, NetPacketView &packet) override
         {
             return parent_.OnPacket(networkId, packet);
         }
@@ -89,7 +89,7 @@ private:
     void OnShutdown(const std::string &networkId);
     void OnConnected(const std::string &networkId);
     bool OnPacket(const std::string &networkId, NetPacket &packet);
-    void SendEvent(const CooperateEvent &event);
+    void SendEvent(CooperateEvent event);
     void OnCommunicationFailure(const std::string &networkId);
     void OnStartCooperate(const std::string &networkId, NetPacket &packet);
     void OnStopCooperate(const std::string &networkId, NetPacket &packet);
@@ -103,6 +103,8 @@ private:
     void OnReplySubscribeLocation(const std::string& networKId, NetPacket &packet);
     void OnReplyUnSubscribeLocation(const std::string& networKId, NetPacket &packet);
     void OnRemoteMouseLocation(const std::string& networKId, NetPacket &packet);
+    void OnRemoteMouseLocationStream(const std::string &networkId, NetPacket &packet);
+    void OnRemoteInputEventSchema(const std::string &networkId, NetPacket &packet);
     void OnRemoteInputDevice(const std::string& networKId, NetPacket &packet);
     void OnRemoteHotPlug(const std::string& networKId, NetPacket &packet);
     int32_t DeserializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet);
@@ -16,13 +16,16 @@
 #ifndef COOPERATE_HOTAREA_H
 #define COOPERATE_HOTAREA_H
 
-#include <set>
+#include <atomic>
+#include <functional>
+#include <map>
 
 #include "nocopyable.h"
 #include "pointer_event.h"
 
 #include "cooperate_events.h"
 #include "coordination_message.h"
+#include "deadline_timer.h"
 #include "i_context.h"
 #include "devicestatus_proto.h"
 
@@ -32,11 +35,26 @@ namespace DeviceStatus {
 namespace Cooperate {
 class HotArea final {
 public:
+    struct NotifyPolicy {
+        // Notify only when the hot-area type or the edge flag changes.
+        bool edgeTriggered { false };
+        // Maximum notifications per second, 0 for no limit.
+        int32_t maxRate { 0 };
+    };
+
     struct HotAreaInfo {
         int32_t pid { -1 };
         MessageId msgId { MessageId::INVALID };
         HotAreaType msg { HotAreaType::AREA_NONE };
         bool isEdge { false };
+        NotifyPolicy policy {};
+        bool notified { false };
+        int64_t lastNotifyTime { 0 };
+        // Latest transition held back by the rate limit, delivered by FlushPending().
+        bool pending { false };
+        HotAreaType pendingMsg { HotAreaType::AREA_NONE };
+        bool pendingEdge { false };
+        std::weak_ptr<ISocketSession> session;
 
         bool operator<(const HotAreaInfo &other) const
         {
@@ -44,7 +62,7 @@ public:
         }
     };
 
-    HotArea(IContext *env) : env_(env) {}
+    HotArea(IContext *env);
     ~HotArea() = default;
     DISALLOW_COPY_AND_MOVE(HotArea);
 
@@ -55,12 +73,24 @@ public:
     int32_t ProcessData(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void OnClientDied(const ClientDiedEvent &event);
 
+    // Policy applied to listeners registered afterwards. Level-triggered without a rate limit by
+    // default, since apps read the pointer position off every notification; listeners that only
+    // care about transitions are opted in with SetListenerPolicy().
+    void SetNotifyPolicy(const NotifyPolicy &policy);
+    bool SetListenerPolicy(int32_t pid, const NotifyPolicy &policy);
+    uint64_t GetDeliveredCount() const;
+    uint64_t GetSuppressedCount() const;
+
 private:
     void CheckInHotArea();
     void CheckPointerToEdge(HotAreaType type);
     void NotifyMessage();
     void OnHotAreaMessage(HotAreaType msg, bool isEdge);
-    void NotifyHotAreaMessage(int32_t pid, MessageId msgId, HotAreaType msg, bool isEdge);
+    void NotifyListener(HotAreaInfo &info, HotAreaType msg, bool isEdge, int64_t now, int64_t &flushDelay);
+    int64_t GetRateLimitDelay(const HotAreaInfo &info, int64_t now) const;
+    void ScheduleFlush(int64_t now, int64_t delay);
+    void FlushPending();
+    bool NotifyHotAreaMessage(HotAreaInfo &info, HotAreaType msg, bool isEdge);
 
 private:
     IContext *env_ { nullptr };
@@ -73,8 +103,27 @@ private:
     bool isEdge_ { false };
     HotAreaType type_ { HotAreaType::AREA_NONE };
     std::mutex lock_;
-    std::set<HotAreaInfo> callbacks_;
+    std::map<int32_t, HotAreaInfo> callbacks_;
+    NotifyPolicy policy_ {};
+    std::atomic<uint64_t> nDelivered_ { 0 };
+    std::atomic<uint64_t> nSuppressed_ { 0 };
+    // Time in microseconds, as Utility::GetSysClockTime() gives it.
+    std::function<int64_t()> clock_;
+    bool flushScheduled_ { false };
+    int64_t flushTime_ { 0 };
+    // Declared last so that it stops, and no flush runs, before the listeners go away.
+    DeadlineTimer flushTimer_;
 };
+
+inline uint64_t HotArea::GetDeliveredCount() const
+{
+    return nDelivered_.load(std::memory_order_relaxed);
+}
+
+inline uint64_t HotArea::GetSuppressedCount() const
+{
+    return nSuppressed_.load(std::memory_order_relaxed);
+}
 } // namespace Cooperate
 } // namespace DeviceStatus
 } // namespace Msdp
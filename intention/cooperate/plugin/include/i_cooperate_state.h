@@ -16,7 +16,10 @@
 #ifndef I_COOPERATE_STATE_H
 #define I_COOPERATE_STATE_H
 
+#include <type_traits>
+
 #include "cooperate_context.h"
+#include "cooperate_event_table.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -56,9 +59,11 @@ protected:
         void SetNext(std::shared_ptr<ICooperateStep> next);
 
     protected:
-        void AddHandler(CooperateEventType event, std::function<void(Context&, const CooperateEvent&)> handler)
+        template<typename Step>
+        void AddHandler(CooperateEventType event, void (Step::*handler)(Context&, const CooperateEvent&))
         {
-            handlers_.emplace(event, handler);
+            static_assert(std::is_base_of_v<ICooperateStep, Step>, "Handler must be a member of a cooperate step");
+            handlers_.Register(event, static_cast<CooperateEventTable<ICooperateStep, Context>::Handler>(handler));
         }
 
         void TransiteTo(Context &context, CooperateState state);
@@ -69,7 +74,7 @@ protected:
         ICooperateState &parent_;
         std::shared_ptr<ICooperateStep> prev_ { nullptr };
         std::shared_ptr<ICooperateStep> next_ { nullptr };
-        std::map<CooperateEventType, std::function<void(Context&, const CooperateEvent&)>> handlers_;
+        CooperateEventTable<ICooperateStep, Context> handlers_;
     };
 
     class Process final {
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMPACT_POINTER_EVENT_CODEC_H
+#define COMPACT_POINTER_EVENT_CODEC_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "input_event_transmission/inner_pointer_item.h"
+#include "net_packet.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+// Version of the compact pointer event schema carried by DSOFTBUS_INPUT_POINTER_EVENT_COMPACT.
+// Peers announce the highest version they decode with DSOFTBUS_INPUT_EVENT_SCHEMA; 0 means
+// only the legacy DSOFTBUS_INPUT_POINTER_EVENT format is understood.
+constexpr uint32_t LEGACY_POINTER_EVENT_SCHEMA { 0 };
+constexpr uint32_t COMPACT_POINTER_EVENT_SCHEMA { 1 };
+
+// Flattened view of the pointer event fields carried by InputEventSerialization::Marshalling.
+struct PointerEventRecord {
+    int32_t eventType { 0 };
+    int32_t id { 0 };
+    int64_t actionTime { 0 };
+    int32_t action { 0 };
+    int64_t actionStartTime { 0 };
+    uint64_t sensorInputTime { 0 };
+    int32_t deviceId { 0 };
+    int32_t targetDisplayId { 0 };
+    int32_t targetWindowId { 0 };
+    int32_t agentWindowId { 0 };
+    uint32_t flag { 0 };
+    int32_t pointerAction { 0 };
+    int32_t pointerId { 0 };
+    int32_t sourceType { 0 };
+    int32_t buttonId { 0 };
+    int32_t fingerCount { 0 };
+    float zOrder { 0.0F };
+    uint32_t axes { 0 };
+    std::vector<double> axisValues;
+    std::vector<int32_t> pressedButtons;
+    std::vector<InnerPointerItem> pointers;
+    std::vector<int32_t> pressedKeys;
+    std::vector<uint8_t> buffer;
+    int64_t interceptorTime { 0 };
+    int32_t scrollRows { 0 };
+
+    static int32_t FromPointerEvent(std::shared_ptr<MMI::PointerEvent> event, int64_t interceptorTime,
+        PointerEventRecord &record);
+    static int32_t ToPointerEvent(const PointerEventRecord &record, std::shared_ptr<MMI::PointerEvent> event);
+};
+
+// Writes pointer events as varint/zigzag deltas against the previous event of the same device.
+// A keyframe, coded against an empty record, starts every device and recurs periodically.
+class CompactPointerEventEncoder final {
+public:
+    CompactPointerEventEncoder() = default;
+    ~CompactPointerEventEncoder() = default;
+    DISALLOW_COPY_AND_MOVE(CompactPointerEventEncoder);
+
+    int32_t Encode(std::shared_ptr<MMI::PointerEvent> event, int64_t interceptorTime, NetPacket &pkt);
+    int32_t Encode(const PointerEventRecord &record, NetPacket &pkt);
+    void Reset();
+
+private:
+    int32_t EncodeRecord(const PointerEventRecord &record, NetPacket &pkt);
+
+    struct DeviceState {
+        PointerEventRecord last;
+        uint32_t seq { 0 };
+        uint32_t nSinceKeyframe { 0 };
+    };
+
+    std::unordered_map<int32_t, DeviceState> states_;
+    PointerEventRecord record_;
+    std::vector<uint8_t> body_;
+};
+
+class CompactPointerEventDecoder final {
+public:
+    CompactPointerEventDecoder() = default;
+    ~CompactPointerEventDecoder() = default;
+    DISALLOW_COPY_AND_MOVE(CompactPointerEventDecoder);
+
+    int32_t Decode(NetPacket &pkt, std::shared_ptr<MMI::PointerEvent> event, int64_t &interceptorTime);
+    int32_t Decode(NetPacket &pkt, PointerEventRecord &record);
+    void Reset();
+
+private:
+    int32_t DecodeRecord(NetPacket &pkt);
+
+    struct DeviceState {
+        PointerEventRecord last;
+        uint32_t seq { 0 };
+    };
+
+    std::unordered_map<int32_t, DeviceState> states_;
+    PointerEventRecord record_;
+    std::vector<InnerPointerItem> items_;
+};
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // COMPACT_POINTER_EVENT_CODEC_H
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INPUT_EVENT_BATCHER_H
+#define INPUT_EVENT_BATCHER_H
+
+#include <functional>
+
+#include "nocopyable.h"
+
+#include "net_packet.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+// Peers announcing this input event schema or higher also unpack DSOFTBUS_INPUT_EVENT_BATCH frames.
+constexpr uint32_t INPUT_EVENT_BATCH_SCHEMA { 2 };
+constexpr size_t DEFAULT_BATCH_BYTE_BUDGET { 1024 };
+constexpr int32_t DEFAULT_BATCH_DEADLINE_MS { 2 };
+
+// Packs framed input event packets for one peer into a single DSOFTBUS_INPUT_EVENT_BATCH frame,
+// so that a burst of events costs one softbus send instead of one per event. The owner flushes
+// the batch once it is full, when an urgent event arrives, or when the batch deadline passes.
+class InputEventBatcher final {
+public:
+    explicit InputEventBatcher(size_t byteBudget = DEFAULT_BATCH_BYTE_BUDGET);
+    ~InputEventBatcher() = default;
+    DISALLOW_COPY_AND_MOVE(InputEventBatcher);
+
+    bool Append(const NetPacket &packet);
+    bool IsEmpty() const;
+    bool IsFull() const;
+    size_t GetEventCount() const;
+    int32_t Flush(NetPacket &frame);
+    void Clear();
+
+    static int32_t Unpack(NetPacket &frame, std::function<void(NetPacket&)> handler);
+
+private:
+    size_t byteBudget_ { DEFAULT_BATCH_BYTE_BUDGET };
+    size_t nEvents_ { 0 };
+    StreamBuffer batch_;
+};
+
+inline bool InputEventBatcher::IsEmpty() const
+{
+    return (nEvents_ == 0);
+}
+
+inline bool InputEventBatcher::IsFull() const
+{
+    return (batch_.Size() >= byteBudget_);
+}
+
+inline size_t InputEventBatcher::GetEventCount() const
+{
+    return nEvents_;
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // INPUT_EVENT_BATCHER_H
\ No newline at end of file
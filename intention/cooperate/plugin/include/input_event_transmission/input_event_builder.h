@@ -26,6 +26,8 @@
 #include "cooperate_events.h"
 #include "i_context.h"
 #include "i_dsoftbus_adapter.h"
+#include "input_event_transmission/compact_pointer_event_codec.h"
+#include "input_event_transmission/input_event_batcher.h"
 #include "net_packet.h"
 
 namespace OHOS {
@@ -47,7 +49,7 @@ class InputEventBuilder final {
         void OnShutdown(const std::string &networkId) override {}
         void OnConnected(const std::string &networkId) override {}
 
-        bool OnPacket(const std::string &networkId, Msdp::NetPacket &packet) override
+        bool OnPacket(const std::string &networkId, Msdp::NetPacketView &packet) override
         {
             return parent_.OnPacket(networkId, packet);
         }
@@ -93,6 +95,9 @@ private:
     bool OnPacket(const std::string &networkId, Msdp::NetPacket &packet);
     void OnPointerEvent(Msdp::NetPacket &packet);
     void OnKeyEvent(Msdp::NetPacket &packet);
+    void OnEventBatch(const std::string &networkId, Msdp::NetPacket &packet);
+    void AnnounceInputEventSchema();
+    int32_t UnmarshallingPointerEvent(Msdp::NetPacket &packet, int64_t &interceptorTime);
     void TurnOffChannelScan();
     void TurnOnChannelScan();
     int32_t SetWifiScene(unsigned int scene);
@@ -131,6 +136,7 @@ private:
     std::shared_ptr<DSoftbusObserver> observer_;
     std::shared_ptr<MMI::PointerEvent> pointerEvent_;
     std::shared_ptr<MMI::KeyEvent> keyEvent_;
+    CompactPointerEventDecoder compactDecoder_;
     std::shared_mutex lock_;
     std::unordered_map<int32_t, int32_t> remote2VirtualIds_;
     void TagRemoteEvent(std::shared_ptr<MMI::KeyEvent> KeyEvent);
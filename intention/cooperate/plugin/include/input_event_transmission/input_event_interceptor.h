@@ -17,12 +17,17 @@
 #define INPUT_EVENT_INTERCEPTOR_H
 
 #include <atomic>
+#include <chrono>
+#include <mutex>
 
 #include "nocopyable.h"
 
 #include "channel.h"
 #include "cooperate_events.h"
+#include "deadline_timer.h"
 #include "i_context.h"
+#include "input_event_transmission/compact_pointer_event_codec.h"
+#include "input_event_transmission/input_event_batcher.h"
 #include "input_event_transmission/input_event_sampler.h"
 
 namespace OHOS {
@@ -40,6 +45,9 @@ public:
     int32_t Enable(Context &context);
     void Disable();
     void Update(Context &context);
+    InputEventSamplerStats GetSamplerStats() const;
+    void SetLinkRtt(int32_t rttMs);
+    void SetPeerSchema(const std::string &networkId, uint32_t schema);
 
 private:
     void OnPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
@@ -53,6 +61,12 @@ private:
     int32_t SetWifiScene(unsigned int scene);
     void RefreshActivity();
     void HeartBeatSend();
+    void ReportSamplerStats();
+    int32_t MarshallingPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent, int64_t interceptorTime,
+        NetPacket &packet);
+    void TransmitPacket(NetPacket &packet, bool urgent);
+    void FlushBatch();
+    void SendInputPacket(NetPacket &packet);
 
     IContext *env_ { nullptr };
     int32_t interceptorId_ { -1 };
@@ -62,6 +76,19 @@ private:
     std::string remoteNetworkId_;
     Channel<CooperateEvent>::Sender sender_;
     InputEventSampler inputEventSampler_;
+    std::atomic<uint32_t> peerSchema_ { LEGACY_POINTER_EVENT_SCHEMA };
+    std::atomic<bool> resetEncoder_ { false };
+    CompactPointerEventEncoder compactEncoder_;
+    std::mutex batchMutex_;
+    InputEventBatcher batcher_;
+    // Bumped on every flush, a batch deadline only flushes the batch it was armed for.
+    uint64_t batchGeneration_ { 0 };
+    bool batchTimerArmed_ { false };
+    std::chrono::steady_clock::time_point batchStart_;
+    size_t nBatchedEvents_ { 0 };
+    size_t nBatchFrames_ { 0 };
+    // Declared last so that it stops, and no deadline runs, before the batch goes away.
+    DeadlineTimer batchTimer_;
     static std::set<int32_t> filterKeys_;
     static std::set<int32_t> filterPointers_;
 };
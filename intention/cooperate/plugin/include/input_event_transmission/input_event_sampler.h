@@ -17,6 +17,7 @@
 #define INPUT_EVENT_SAMPLER_H
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_set>
@@ -35,12 +36,45 @@ struct RawEvent {
     std::chrono::steady_clock::time_point rcvdTimeStamp;
 };
 
+enum class SamplingMode : int32_t {
+    FIXED,
+    ADAPTIVE,
+};
+
+struct InputEventSamplerStats {
+    uint64_t nInputEvents { 0 };
+    uint64_t nOutputEvents { 0 };
+    double inputRate { 0.0 };
+    double outputRate { 0.0 };
+    double aggregationRatio { 0.0 };
+    int64_t avgAddedLatencyUs { 0 };
+    int64_t maxAddedLatencyUs { 0 };
+    int64_t windowUs { 0 };
+    int32_t linkRttMs { 0 };
+};
+
 class InputEventSampler final {
 public:
     InputEventSampler();
     void OnPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void SetPointerEventHandler(PointerEventHandler pointerEventHandler);
+
+    // In adaptive mode, the aggregation window follows pointer velocity and is capped by link RTT.
+    void SetSamplingMode(SamplingMode mode);
+    void SetLinkRtt(int32_t rttMs);
+    InputEventSamplerStats GetStats() const;
+    void ResetStats();
 private:
+    // State of the adaptive pipeline, touched only by the thread delivering pointer events.
+    struct AdaptiveState {
+        int32_t pendingDx { 0 };
+        int32_t pendingDy { 0 };
+        bool hasPending { false };
+        std::chrono::steady_clock::time_point firstPendingTime;
+        std::chrono::steady_clock::time_point lastEventTime;
+        double velocity { 0.0 };
+    };
+
     bool IsTouchPadEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     bool IsSpecialEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     bool IsDurationMatched();
@@ -54,6 +88,12 @@ private:
     void ClearRawEvents();
     void UpdateAggregationTimeStamp();
     bool IsAggregationIntervalMatched();
+    void HandleAdaptiveMouseEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent,
+        std::chrono::steady_clock::time_point now);
+    void UpdateVelocity(int32_t rawDx, int32_t rawDy, std::chrono::steady_clock::time_point now);
+    int64_t ComputeWindowUs() const;
+    void ForwardEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent, int64_t latencyUs);
+    void RecordLatency(int64_t latencyUs);
 private:
     PointerEventHandler pointerEventHandler_;
     std::mutex rawEventMutex_;
@@ -65,7 +105,17 @@ private:
 
     std::atomic_int32_t prefixRawDxSum_ { 0 };
     std::atomic_int32_t prefixRawDySum_ { 0 };
-    
+
+    std::atomic<SamplingMode> mode_ { SamplingMode::FIXED };
+    std::atomic_int32_t linkRttMs_;
+    AdaptiveState adaptive_;
+    std::atomic<int64_t> statsStartNs_ { 0 };
+    std::atomic<uint64_t> nInputEvents_ { 0 };
+    std::atomic<uint64_t> nOutputEvents_ { 0 };
+    std::atomic<int64_t> totalLatencyUs_ { 0 };
+    std::atomic<int64_t> maxLatencyUs_ { 0 };
+    std::atomic<int64_t> windowUs_ { 0 };
+
     static int32_t idealEventIntervalMS_;
     static int32_t expiredIntervalMS_;
     static int32_t rawDxThreshold_;
@@ -24,8 +24,10 @@
 #include "pointer_event.h"
 
 #include "cooperate_events.h"
+#include "deadline_timer.h"
 #include "i_context.h"
 #include "i_event_listener.h"
+#include "mouse_location_stream.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -41,7 +43,7 @@ struct LocationInfo {
 
 public:
     MouseLocation(IContext *context);
-    ~MouseLocation() = default;
+    ~MouseLocation();
     DISALLOW_COPY_AND_MOVE(MouseLocation);
     void AddListener(const RegisterEventListenerEvent &event);
     void RemoveListener(const UnregisterEventListenerEvent &event);
@@ -51,19 +53,32 @@ public:
     void OnReplySubscribeMouseLocation(const DSoftbusReplySubscribeMouseLocation &notice);
     void OnReplyUnSubscribeMouseLocation(const DSoftbusReplyUnSubscribeMouseLocation &notice);
     void OnRemoteMouseLocation(const DSoftbusSyncMouseLocation &notice);
+    void OnRemoteMouseLocationStream(const DSoftbusMouseLocationStream &notice);
     void OnClientDied(const ClientDiedEvent &event);
     void OnSoftbusSessionClosed(const DSoftbusSessionClosed &notice);
+    // Frame rate of the stream offered to new subscribers, 0 to always sync full locations.
+    void SetStreamFrameRate(int32_t frameRate);
 
 private:
+    struct RemoteStreams {
+        std::mutex mutex;
+        bool flushScheduled { false };
+        std::unordered_map<std::string, MouseLocationStreamEncoder> encoders;
+    };
+
     int32_t SubscribeMouseLocation(const DSoftbusSubscribeMouseLocation &event);
     int32_t UnSubscribeMouseLocation(const DSoftbusUnSubscribeMouseLocation &event);
     int32_t SyncMouseLocation(const DSoftbusSyncMouseLocation &event);
     int32_t ReplySubscribeMouseLocation(const DSoftbusReplySubscribeMouseLocation &event);
     int32_t ReplyUnSubscribeMouseLocation(const DSoftbusReplyUnSubscribeMouseLocation &event);
     int32_t SendPacket(const std::string &remoteNetworkId, NetPacket &packet);
+    static int32_t SendPacket(IContext *context, const std::string &remoteNetworkId, NetPacket &packet);
+    void FlushStreams();
     void ReportMouseLocationToListener(const std::string &networkId, const LocationInfo &locationInfo, int32_t pid);
     void TransferToLocationInfo(std::shared_ptr<MMI::PointerEvent> pointerEvent, LocationInfo &locationInfo);
     void SyncLocationToRemote(const std::string &remoteNetworkId, const LocationInfo &locationInfo);
+    bool StreamLocationToRemote(const std::string &remoteNetworkId, const LocationInfo &locationInfo);
+    void RemoveStream(const std::string &remoteNetworkId);
     bool HasRemoteSubscriber();
     bool HasLocalListener();
 
@@ -74,6 +89,13 @@ private:
     std::set<int32_t> localListeners_;
     std::set<std::string> remoteSubscribers_;
     std::unordered_map<std::string, std::set<int32_t>> listeners_;
+    int32_t streamFrameRate_ { DEFAULT_STREAM_FRAME_RATE };
+    uint16_t streamSessionId_ { 0 };
+    std::shared_ptr<RemoteStreams> streams_;
+    std::unordered_map<std::string, MouseLocationStreamDecoder> decoders_;
+    // Frames are paced at a few milliseconds, below what TimerManager offers. Declared last
+    // so that it stops, and no flush runs, before the streams go away.
+    DeadlineTimer flushTimer_;
 };
 } // namespace Cooperate
 } // namespace DeviceStatus
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATE_MOUSE_LOCATION_STREAM_H
+#define COOPERATE_MOUSE_LOCATION_STREAM_H
+
+#include <cstdint>
+
+#include "net_packet.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+inline constexpr int32_t DEFAULT_STREAM_FRAME_RATE { 60 };
+
+struct StreamLocation {
+    int32_t displayX { -1 };
+    int32_t displayY { -1 };
+    int32_t displayWidth { -1 };
+    int32_t displayHeight { -1 };
+};
+
+// One frame of a mouse-location stream, as carried by DSOFTBUS_MOUSE_LOCATION_STREAM.
+// Keyframes carry absolute coordinates; delta frames carry the offset of the pointer
+// from the previous frame in displayX/displayY and leave the display size untouched.
+struct LocationFrame {
+    enum Kind : uint8_t {
+        KEYFRAME = 1,
+        DELTA = 2,
+    };
+
+    uint8_t kind { KEYFRAME };
+    uint16_t sessionId { 0 };
+    uint16_t seq { 0 };
+    StreamLocation location;
+};
+
+/**
+ * Sender side of a mouse-location stream to one subscriber. Locations pushed between two
+ * frames are coalesced, and at most one frame is encoded per frame interval.
+ */
+class MouseLocationStreamEncoder final {
+public:
+    MouseLocationStreamEncoder(uint16_t sessionId, int32_t frameRate);
+    ~MouseLocationStreamEncoder() = default;
+
+    void Push(const StreamLocation &location);
+    bool HasPending() const;
+    // Microseconds until the pending location may be encoded, or -1 if nothing is pending.
+    int64_t GetDelay(int64_t now) const;
+    // Encode the pending location if its frame is due. Returns false if nothing was written.
+    bool Encode(int64_t now, NetPacket &packet);
+    // Force the next frame to be a keyframe, e.g. after a failed send.
+    void RequestKeyframe();
+    uint16_t GetSessionId() const;
+
+private:
+    bool NeedKeyframe(const StreamLocation &location) const;
+
+    uint16_t sessionId_ { 0 };
+    uint16_t seq_ { 0 };
+    int64_t interval_ { 0 };
+    int64_t lastFrameTime_ { 0 };
+    int32_t nDeltas_ { 0 };
+    bool needKeyframe_ { true };
+    bool hasPending_ { false };
+    StreamLocation pending_;
+    StreamLocation last_;
+};
+
+/**
+ * Receiver side of a mouse-location stream from one peer. Delta frames are applied only on
+ * top of the keyframe of the same session and in sequence; otherwise they are dropped until
+ * the next keyframe resynchronizes the stream.
+ */
+class MouseLocationStreamDecoder final {
+public:
+    MouseLocationStreamDecoder() = default;
+    ~MouseLocationStreamDecoder() = default;
+
+    static int32_t ReadFrame(NetPacket &packet, LocationFrame &frame);
+    bool Apply(const LocationFrame &frame, StreamLocation &location);
+    uint64_t GetDroppedCount() const;
+
+private:
+    bool synced_ { false };
+    uint16_t sessionId_ { 0 };
+    uint16_t seq_ { 0 };
+    uint64_t nDropped_ { 0 };
+    StreamLocation last_;
+};
+
+inline bool MouseLocationStreamEncoder::HasPending() const
+{
+    return hasPending_;
+}
+
+inline void MouseLocationStreamEncoder::RequestKeyframe()
+{
+    needKeyframe_ = true;
+}
+
+inline uint16_t MouseLocationStreamEncoder::GetSessionId() const
+{
+    return sessionId_;
+}
+
+inline uint64_t MouseLocationStreamDecoder::GetDroppedCount() const
+{
+    return nDropped_;
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // COOPERATE_MOUSE_LOCATION_STREAM_H
\ No newline at end of file
@@ -54,7 +54,7 @@ private:
 
 private:
     void TransiteTo(Context &context, CooperateState state) override;
-    void AddHandler(CooperateEventType event, std::function<void(Context&, const CooperateEvent&)> handler);
+    void AddHandler(CooperateEventType event, CooperateEventTable<StateMachine, Context>::Handler handler);
     void OnQuit(Context &context);
     void AddObserver(Context &context, const CooperateEvent &event);
     void RemoveObserver(Context &context, const CooperateEvent &event);
@@ -80,6 +80,8 @@ private:
     void OnSoftbusReplySubscribeMouseLocation(Context &context, const CooperateEvent &event);
     void OnSoftbusReplyUnSubscribeMouseLocation(Context &context, const CooperateEvent &event);
     void OnSoftbusMouseLocation(Context &context, const CooperateEvent &event);
+    void OnSoftbusMouseLocationStream(Context &context, const CooperateEvent &event);
+    void OnSoftbusInputEventSchema(Context &context, const CooperateEvent &event);
     void OnSoftbusSessionClosed(Context &context, const CooperateEvent &event);
     void OnSoftbusSessionOpened(Context &context, const CooperateEvent &event);
     void OnHotPlugEvent(Context &context, const CooperateEvent &event);
@@ -106,7 +108,7 @@ private:
     void ResetCooperate(Context &context);
 
     IContext *env_ { nullptr };
-    std::map<CooperateEventType, std::function<void(Context&, const CooperateEvent&)>> handlers_;
+    CooperateEventTable<StateMachine, Context> handlers_;
     size_t current_ { COOPERATE_STATE_FREE };
     std::array<std::shared_ptr<ICooperateState>, N_COOPERATE_STATES> states_;
     std::set<std::string> onlineBoards_;
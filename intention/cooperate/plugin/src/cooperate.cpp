@@ -30,11 +30,36 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
+namespace {
+constexpr size_t MAX_EVENT_BATCH_SIZE { 64 };
+
+#ifdef OHOS_BUILD_COOPERATE_COALESCE_POINTER_MOVE
+// A pointer move still waiting in the queue is superseded by the next move of the same pointer.
+bool CoalescePointerMove(const CooperateEvent &queued, const CooperateEvent &incoming)
+{
+    if ((queued.type != CooperateEventType::INPUT_POINTER_EVENT) ||
+        (incoming.type != CooperateEventType::INPUT_POINTER_EVENT)) {
+        return false;
+    }
+    const auto *last = std::get_if<InputPointerEvent>(&queued.event);
+    const auto *next = std::get_if<InputPointerEvent>(&incoming.event);
+    return ((last != nullptr) && (next != nullptr) &&
+        (last->pointerAction == MMI::PointerEvent::POINTER_ACTION_MOVE) &&
+        (next->pointerAction == MMI::PointerEvent::POINTER_ACTION_MOVE) &&
+        (last->deviceId == next->deviceId) && (last->sourceType == next->sourceType) &&
+        (last->currentDisplayId == next->currentDisplayId));
+}
+#endif // OHOS_BUILD_COOPERATE_COALESCE_POINTER_MOVE
+} // namespace
 
 Cooperate::Cooperate(IContext *env)
     : env_(env), context_(env), sm_(env)
 {
+#ifdef OHOS_BUILD_COOPERATE_COALESCE_POINTER_MOVE
+    auto [sender, receiver] = Channel<CooperateEvent>::OpenChannel(&CoalescePointerMove);
+#else
     auto [sender, receiver] = Channel<CooperateEvent>::OpenChannel();
+#endif // OHOS_BUILD_COOPERATE_COALESCE_POINTER_MOVE
     receiver_ = receiver;
     receiver_.Enable();
     context_.AttachSender(sender);
@@ -379,28 +404,38 @@ void Cooperate::Loop()
     bool running = true;
     SetThreadName("OS_Cooperate");
     LoadMotionDrag();
+    std::vector<CooperateEvent> events;
+    events.reserve(MAX_EVENT_BATCH_SIZE);
 
     while (running) {
-        CooperateEvent event = receiver_.Receive();
-        switch (event.type) {
-            case CooperateEventType::NOOP: {
-                break;
-            }
-            case CooperateEventType::QUIT: {
-                FI_HILOGI("Skip out of loop");
-                running = false;
-                break;
-            }
-            case CooperateEventType::SET_DAMPLING_COEFFICIENT: {
-                SetDamplingCoefficient(event);
-                break;
-            }
-            default: {
-                sm_.OnEvent(context_, event);
-                break;
-            }
+        events.clear();
+        receiver_.ReceiveBatch(events, MAX_EVENT_BATCH_SIZE);
+        for (auto iter = events.begin(); running && (iter != events.end()); ++iter) {
+            running = HandleEvent(*iter);
+        }
+    }
+}
+
+bool Cooperate::HandleEvent(const CooperateEvent &event)
+{
+    switch (event.type) {
+        case CooperateEventType::NOOP: {
+            break;
+        }
+        case CooperateEventType::QUIT: {
+            FI_HILOGI("Skip out of loop");
+            return false;
+        }
+        case CooperateEventType::SET_DAMPLING_COEFFICIENT: {
+            SetDamplingCoefficient(event);
+            break;
+        }
+        default: {
+            sm_.OnEvent(context_, event);
+            break;
         }
     }
+    return true;
 }
 
 void Cooperate::StartWorker()
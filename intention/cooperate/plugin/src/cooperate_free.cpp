@@ -102,35 +102,15 @@ void CooperateFree::SimulateShowPointerEvent()
 CooperateFree::Initial::Initial(CooperateFree &parent)
     : ICooperateStep(parent, nullptr), parent_(parent)
 {
-    AddHandler(CooperateEventType::START, [this](Context &context, const CooperateEvent &event) {
-        this->OnStart(context, event);
-    });
-    AddHandler(CooperateEventType::WITH_OPTIONS_START, [this](Context &context, const CooperateEvent &event) {
-        this->OnStartWithOptions(context, event);
-    });
-    AddHandler(CooperateEventType::STOP, [this](Context &context, const CooperateEvent &event) {
-        this->OnStop(context, event);
-    });
-    AddHandler(CooperateEventType::DISABLE, [this](Context &context, const CooperateEvent &event) {
-        this->OnDisable(context, event);
-    });
-    AddHandler(CooperateEventType::APP_CLOSED, [this](Context &context, const CooperateEvent &event) {
-        this->OnAppClosed(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE, [this](Context &context, const CooperateEvent &event) {
-        this->OnRemoteStart(context, event);
-    });
-    AddHandler(CooperateEventType::INPUT_POINTER_EVENT, [this](Context &context, const CooperateEvent &event) {
-        this->OnPointerEvent(context, event);
-    });
-    AddHandler(CooperateEventType::UPDATE_COOPERATE_FLAG,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnUpdateCooperateFlag(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStartWithOptions(context, event);
-    });
+    AddHandler(CooperateEventType::START, &CooperateFree::Initial::OnStart);
+    AddHandler(CooperateEventType::WITH_OPTIONS_START, &CooperateFree::Initial::OnStartWithOptions);
+    AddHandler(CooperateEventType::STOP, &CooperateFree::Initial::OnStop);
+    AddHandler(CooperateEventType::DISABLE, &CooperateFree::Initial::OnDisable);
+    AddHandler(CooperateEventType::APP_CLOSED, &CooperateFree::Initial::OnAppClosed);
+    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE, &CooperateFree::Initial::OnRemoteStart);
+    AddHandler(CooperateEventType::INPUT_POINTER_EVENT, &CooperateFree::Initial::OnPointerEvent);
+    AddHandler(CooperateEventType::UPDATE_COOPERATE_FLAG, &CooperateFree::Initial::OnUpdateCooperateFlag);
+    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS, &CooperateFree::Initial::OnRemoteStartWithOptions);
 }
 
 void CooperateFree::Initial::OnProgress(Context &context, const CooperateEvent &event)
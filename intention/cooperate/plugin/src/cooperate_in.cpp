@@ -106,56 +106,20 @@ void CooperateIn::Initial::RemoveChains(std::shared_ptr<Initial> self)
 CooperateIn::Initial::Initial(CooperateIn &parent)
     : ICooperateStep(parent, nullptr), parent_(parent)
 {
-    AddHandler(CooperateEventType::DISABLE, [this](Context &context, const CooperateEvent &event) {
-        this->OnDisable(context, event);
-    });
-    AddHandler(CooperateEventType::START, [this](Context &context, const CooperateEvent &event) {
-        this->OnStart(context, event);
-    });
-    AddHandler(CooperateEventType::STOP, [this](Context &context, const CooperateEvent &event) {
-        this->OnStop(context, event);
-    });
-    AddHandler(CooperateEventType::APP_CLOSED, [this](Context &context, const CooperateEvent &event) {
-        this->OnAppClosed(context, event);
-    });
-    AddHandler(CooperateEventType::INPUT_POINTER_EVENT, [this](Context &context, const CooperateEvent &event) {
-        this->OnPointerEvent(context, event);
-    });
-    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE, [this](Context &context, const CooperateEvent &event) {
-        this->OnBoardOffline(context, event);
-    });
-    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSwitchChanged(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusSessionClosed(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStart(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_STOP_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStop(context, event);
-    });
-    AddHandler(CooperateEventType::UPDATE_COOPERATE_FLAG,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnUpdateCooperateFlag(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_INPUT_DEV_SYNC,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteInputDevice(context, event);
-    });
-    AddHandler(CooperateEventType::WITH_OPTIONS_START,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnStartWithOptions(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStartWithOptions(context, event);
-    });
+    AddHandler(CooperateEventType::DISABLE, &CooperateIn::Initial::OnDisable);
+    AddHandler(CooperateEventType::START, &CooperateIn::Initial::OnStart);
+    AddHandler(CooperateEventType::STOP, &CooperateIn::Initial::OnStop);
+    AddHandler(CooperateEventType::APP_CLOSED, &CooperateIn::Initial::OnAppClosed);
+    AddHandler(CooperateEventType::INPUT_POINTER_EVENT, &CooperateIn::Initial::OnPointerEvent);
+    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE, &CooperateIn::Initial::OnBoardOffline);
+    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED, &CooperateIn::Initial::OnSwitchChanged);
+    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED, &CooperateIn::Initial::OnSoftbusSessionClosed);
+    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE, &CooperateIn::Initial::OnRemoteStart);
+    AddHandler(CooperateEventType::DSOFTBUS_STOP_COOPERATE, &CooperateIn::Initial::OnRemoteStop);
+    AddHandler(CooperateEventType::UPDATE_COOPERATE_FLAG, &CooperateIn::Initial::OnUpdateCooperateFlag);
+    AddHandler(CooperateEventType::DSOFTBUS_INPUT_DEV_SYNC, &CooperateIn::Initial::OnRemoteInputDevice);
+    AddHandler(CooperateEventType::WITH_OPTIONS_START, &CooperateIn::Initial::OnStartWithOptions);
+    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS, &CooperateIn::Initial::OnRemoteStartWithOptions);
 }
 
 void CooperateIn::Initial::OnDisable(Context &context, const CooperateEvent &event)
@@ -496,51 +460,20 @@ void CooperateIn::Initial::OnProgressWithOptions(Context &context, const Coopera
 CooperateIn::RelayConfirmation::RelayConfirmation(CooperateIn &parent, std::shared_ptr<ICooperateStep> prev)
     : ICooperateStep(parent, prev), parent_(parent)
 {
-    AddHandler(CooperateEventType::DISABLE, [this](Context &context, const CooperateEvent &event) {
-        this->OnDisable(context, event);
-    });
-    AddHandler(CooperateEventType::STOP, [this](Context &context, const CooperateEvent &event) {
-        this->OnStop(context, event);
-    });
-    AddHandler(CooperateEventType::APP_CLOSED, [this](Context &context, const CooperateEvent &event) {
-        this->OnAppClosed(context, event);
-    });
-    AddHandler(CooperateEventType::INPUT_POINTER_EVENT,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnPointerEvent(context, event);
-    });
-    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnBoardOffline(context, event);
-    });
-    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSwitchChanged(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusSessionClosed(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_RELAY_COOPERATE_FINISHED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnResponse(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStart(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_STOP_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStop(context, event);
-    });
+    AddHandler(CooperateEventType::DISABLE, &CooperateIn::RelayConfirmation::OnDisable);
+    AddHandler(CooperateEventType::STOP, &CooperateIn::RelayConfirmation::OnStop);
+    AddHandler(CooperateEventType::APP_CLOSED, &CooperateIn::RelayConfirmation::OnAppClosed);
+    AddHandler(CooperateEventType::INPUT_POINTER_EVENT, &CooperateIn::RelayConfirmation::OnPointerEvent);
+    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE, &CooperateIn::RelayConfirmation::OnBoardOffline);
+    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED, &CooperateIn::RelayConfirmation::OnSwitchChanged);
+    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED, &CooperateIn::RelayConfirmation::OnSoftbusSessionClosed);
+    AddHandler(CooperateEventType::DSOFTBUS_RELAY_COOPERATE_FINISHED, &CooperateIn::RelayConfirmation::OnResponse);
+    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE, &CooperateIn::RelayConfirmation::OnRemoteStart);
+    AddHandler(CooperateEventType::DSOFTBUS_STOP_COOPERATE, &CooperateIn::RelayConfirmation::OnRemoteStop);
     AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStartWithOptions(context, event);
-    });
+        &CooperateIn::RelayConfirmation::OnRemoteStartWithOptions);
     AddHandler(CooperateEventType::DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS_FINISHED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnResponseWithOptions(context, event);
-    });
+        &CooperateIn::RelayConfirmation::OnResponseWithOptions);
 }
 
 void CooperateIn::RelayConfirmation::OnDisable(Context &context, const CooperateEvent &event)
@@ -110,67 +110,23 @@ void CooperateOut::Initial::RemoveChains(std::shared_ptr<Initial> self)
 CooperateOut::Initial::Initial(CooperateOut &parent)
     : ICooperateStep(parent, nullptr), parent_(parent)
 {
-    AddHandler(CooperateEventType::DISABLE, [this](Context &context, const CooperateEvent &event) {
-        this->OnDisable(context, event);
-    });
-    AddHandler(CooperateEventType::START, [this](Context &context, const CooperateEvent &event) {
-        this->OnStart(context, event);
-    });
-    AddHandler(CooperateEventType::WITH_OPTIONS_START, [this](Context &context, const CooperateEvent &event) {
-        this->OnStartWithOptions(context, event);
-    });
-    AddHandler(CooperateEventType::STOP, [this](Context &context, const CooperateEvent &event) {
-        this->OnStop(context, event);
-    });
-    AddHandler(CooperateEventType::APP_CLOSED, [this](Context &context, const CooperateEvent &event) {
-        this->OnAppClosed(context, event);
-    });
-    AddHandler(CooperateEventType::INPUT_HOTPLUG_EVENT, [this](Context &context, const CooperateEvent &event) {
-        this->OnHotplug(context, event);
-    });
-    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE, [this](Context &context, const CooperateEvent &event) {
-        this->OnBoardOffline(context, event);
-    });
-    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSwitchChanged(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusSessionClosed(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_COME_BACK,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnComeBack(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStart(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_STOP_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStop(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_RELAY_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRelay(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStartWithOptions(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_COME_BACK_WITH_OPTIONS,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnComeBackWithOptions(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRelayWithOptions(context, event);
-    });
-    AddHandler(CooperateEventType::STOP_ABOUT_VIRTUALTRACKPAD,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnStopAboutVirtualTrackpad(context, event);
-    });
+    AddHandler(CooperateEventType::DISABLE, &CooperateOut::Initial::OnDisable);
+    AddHandler(CooperateEventType::START, &CooperateOut::Initial::OnStart);
+    AddHandler(CooperateEventType::WITH_OPTIONS_START, &CooperateOut::Initial::OnStartWithOptions);
+    AddHandler(CooperateEventType::STOP, &CooperateOut::Initial::OnStop);
+    AddHandler(CooperateEventType::APP_CLOSED, &CooperateOut::Initial::OnAppClosed);
+    AddHandler(CooperateEventType::INPUT_HOTPLUG_EVENT, &CooperateOut::Initial::OnHotplug);
+    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE, &CooperateOut::Initial::OnBoardOffline);
+    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED, &CooperateOut::Initial::OnSwitchChanged);
+    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED, &CooperateOut::Initial::OnSoftbusSessionClosed);
+    AddHandler(CooperateEventType::DSOFTBUS_COME_BACK, &CooperateOut::Initial::OnComeBack);
+    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE, &CooperateOut::Initial::OnRemoteStart);
+    AddHandler(CooperateEventType::DSOFTBUS_STOP_COOPERATE, &CooperateOut::Initial::OnRemoteStop);
+    AddHandler(CooperateEventType::DSOFTBUS_RELAY_COOPERATE, &CooperateOut::Initial::OnRelay);
+    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS, &CooperateOut::Initial::OnRemoteStartWithOptions);
+    AddHandler(CooperateEventType::DSOFTBUS_COME_BACK_WITH_OPTIONS, &CooperateOut::Initial::OnComeBackWithOptions);
+    AddHandler(CooperateEventType::DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS, &CooperateOut::Initial::OnRelayWithOptions);
+    AddHandler(CooperateEventType::STOP_ABOUT_VIRTUALTRACKPAD, &CooperateOut::Initial::OnStopAboutVirtualTrackpad);
 }
 
 void CooperateOut::Initial::OnDisable(Context &context, const CooperateEvent &event)
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "deadline_timer.h"
+
+#include "devicestatus_define.h"
+#include "util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DeadlineTimer"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+const std::string DEADLINE_THREAD_NAME { "os_coop_deadline" };
+}
+
+DeadlineTimer::~DeadlineTimer()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stopping_ = true;
+        armed_ = false;
+        callback_ = nullptr;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+int32_t DeadlineTimer::Arm(std::chrono::microseconds delay, Callback callback)
+{
+    CHKPR(callback, RET_ERR);
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (stopping_) {
+        return RET_ERR;
+    }
+    if (!worker_.joinable()) {
+        worker_ = std::thread([this] { Run(); });
+    }
+    deadline_ = std::chrono::steady_clock::now() + delay;
+    callback_ = std::move(callback);
+    armed_ = true;
+    cv_.notify_all();
+    return RET_OK;
+}
+
+void DeadlineTimer::Cancel()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    armed_ = false;
+    callback_ = nullptr;
+    cv_.notify_all();
+}
+
+bool DeadlineTimer::IsArmed() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return armed_;
+}
+
+void DeadlineTimer::Run()
+{
+    SetThreadName(DEADLINE_THREAD_NAME);
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stopping_) {
+        if (!armed_) {
+            cv_.wait(lock);
+            continue;
+        }
+        if (std::chrono::steady_clock::now() < deadline_) {
+            cv_.wait_until(lock, deadline_);
+            continue;
+        }
+        armed_ = false;
+        Callback callback = std::move(callback_);
+        callback_ = nullptr;
+        lock.unlock();
+        callback();
+        lock.lock();
+    }
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -70,6 +70,12 @@ DSoftbusHandler::DSoftbusHandler(IContext *env)
         { static_cast<int32_t>(MessageId::DSOFTBUS_MOUSE_LOCATION),
         [this] (const std::string &networkId, NetPacket &packet) {
             this->OnRemoteMouseLocation(networkId, packet);}},
+        { static_cast<int32_t>(MessageId::DSOFTBUS_MOUSE_LOCATION_STREAM),
+        [this] (const std::string &networkId, NetPacket &packet) {
+            this->OnRemoteMouseLocationStream(networkId, packet);}},
+        { static_cast<int32_t>(MessageId::DSOFTBUS_INPUT_EVENT_SCHEMA),
+        [this] (const std::string &networkId, NetPacket &packet) {
+            this->OnRemoteInputEventSchema(networkId, packet);}},
         { static_cast<int32_t>(MessageId::DSOFTBUS_INPUT_DEV_SYNC),
         [this] (const std::string &networkId, NetPacket &packet) {
             this->OnRemoteInputDevice(networkId, packet);}},
@@ -394,10 +400,10 @@ bool DSoftbusHandler::OnPacket(const std::string &networkId, NetPacket &packet)
     return false;
 }
 
-void DSoftbusHandler::SendEvent(const CooperateEvent &event)
+void DSoftbusHandler::SendEvent(CooperateEvent event)
 {
     std::lock_guard guard(lock_);
-    auto ret = sender_.Send(event);
+    auto ret = sender_.Send(std::move(event));
     if (ret != Channel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
@@ -736,6 +742,10 @@ void DSoftbusHandler::OnSubscribeMouseLocation(const std::string &networKId, Net
         FI_HILOGE("Failed to read data packet");
         return;
     }
+    packet >> event.supportStream;
+    if (packet.ChkRWError()) {
+        event.supportStream = false;
+    }
     SendEvent(CooperateEvent(
         CooperateEventType::DSOFTBUS_SUBSCRIBE_MOUSE_LOCATION,
         event));
@@ -798,6 +808,39 @@ void DSoftbusHandler::OnRemoteMouseLocation(const std::string& networKId, NetPac
         event));
 }
 
+void DSoftbusHandler::OnRemoteMouseLocationStream(const std::string &networkId, NetPacket &packet)
+{
+    CALL_DEBUG_ENTER;
+    DSoftbusMouseLocationStream event {
+        .networkId = networkId,
+    };
+    if (MouseLocationStreamDecoder::ReadFrame(packet, event.frame) != RET_OK) {
+        FI_HILOGE("Failed to read location frame");
+        return;
+    }
+    SendEvent(CooperateEvent(
+        CooperateEventType::DSOFTBUS_MOUSE_LOCATION_STREAM,
+        event));
+}
+
+void DSoftbusHandler::OnRemoteInputEventSchema(const std::string &networkId, NetPacket &packet)
+{
+    CALL_DEBUG_ENTER;
+    DSoftbusInputEventSchema event {
+        .networkId = networkId,
+    };
+    packet >> event.schema;
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Failed to read input event schema");
+        return;
+    }
+    FI_HILOGI("Peer '%{public}s' decodes pointer event schema %{public}u",
+        Utility::Anonymize(networkId).c_str(), event.schema);
+    SendEvent(CooperateEvent(
+        CooperateEventType::DSOFTBUS_INPUT_EVENT_SCHEMA,
+        event));
+}
+
 void DSoftbusHandler::OnRemoteInputDevice(const std::string& networkId, NetPacket &packet)
 {
     CALL_INFO_TRACE;
@@ -15,9 +15,12 @@
 
 #include "hot_area.h"
 
+#include <algorithm>
+
 #include "display_manager.h"
 
 #include "devicestatus_define.h"
+#include "utility.h"
 
 #undef LOG_TAG
 #define LOG_TAG "HotArea"
@@ -29,8 +32,11 @@ namespace Cooperate {
 namespace {
 constexpr int32_t HOT_AREA_WIDTH { 100 };
 constexpr int32_t HOT_AREA_MARGIN { 200 };
+constexpr int64_t MICROSECONDS_PER_SECOND { 1000000 };
 }; // namespace
 
+HotArea::HotArea(IContext *env) : env_(env), clock_(&Utility::GetSysClockTime) {}
+
 void HotArea::AddListener(const RegisterHotareaListenerEvent &event)
 {
     CALL_DEBUG_ENTER;
@@ -38,19 +44,34 @@ void HotArea::AddListener(const RegisterHotareaListenerEvent &event)
     HotAreaInfo info {
         .pid = event.pid,
         .msgId = MessageId::HOT_AREA_ADD_LISTENER,
+        .policy = policy_,
     };
-    auto [iter, isOk] = callbacks_.emplace(info);
-    if (!isOk) {
-        callbacks_.erase(iter);
-        callbacks_.emplace(info);
-    }
+    callbacks_.insert_or_assign(event.pid, info);
 }
 
 void HotArea::RemoveListener(const UnregisterHotareaListenerEvent &event)
 {
     CALL_DEBUG_ENTER;
     std::lock_guard guard(lock_);
-    callbacks_.erase(HotAreaInfo { .pid = event.pid });
+    callbacks_.erase(event.pid);
+}
+
+void HotArea::SetNotifyPolicy(const NotifyPolicy &policy)
+{
+    std::lock_guard guard(lock_);
+    policy_ = policy;
+}
+
+bool HotArea::SetListenerPolicy(int32_t pid, const NotifyPolicy &policy)
+{
+    std::lock_guard guard(lock_);
+    auto iter = callbacks_.find(pid);
+    if (iter == callbacks_.end()) {
+        FI_HILOGE("No hot area listener, pid:%{public}d", pid);
+        return false;
+    }
+    iter->second.policy = policy;
+    return true;
 }
 
 void HotArea::EnableCooperate(const EnableCooperateEvent &event)
@@ -128,34 +149,111 @@ void HotArea::NotifyMessage()
 void HotArea::OnHotAreaMessage(HotAreaType msg, bool isEdge)
 {
     CALL_DEBUG_ENTER;
-    for (const auto &callback : callbacks_) {
-        NotifyHotAreaMessage(callback.pid, callback.msgId, msg, isEdge);
+    int64_t now = clock_();
+    int64_t flushDelay { -1 };
+    for (auto &[pid, info] : callbacks_) {
+        NotifyListener(info, msg, isEdge, now, flushDelay);
+    }
+    ScheduleFlush(now, flushDelay);
+}
+
+void HotArea::NotifyListener(HotAreaInfo &info, HotAreaType msg, bool isEdge, int64_t now, int64_t &flushDelay)
+{
+    info.pending = false;
+    if (info.policy.edgeTriggered && info.notified && (info.msg == msg) && (info.isEdge == isEdge)) {
+        nSuppressed_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    // A transition held back by the rate limit still goes out once the limit allows,
+    // with the next event or by FlushPending() if the pointer stops meanwhile.
+    if (int64_t delay = GetRateLimitDelay(info, now); delay > 0) {
+        info.pending = true;
+        info.pendingMsg = msg;
+        info.pendingEdge = isEdge;
+        flushDelay = ((flushDelay < 0) ? delay : std::min(flushDelay, delay));
+        nSuppressed_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (NotifyHotAreaMessage(info, msg, isEdge)) {
+        info.msg = msg;
+        info.isEdge = isEdge;
+        info.notified = true;
+        info.lastNotifyTime = now;
+        nDelivered_.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
+int64_t HotArea::GetRateLimitDelay(const HotAreaInfo &info, int64_t now) const
+{
+    if ((info.policy.maxRate <= 0) || !info.notified) {
+        return 0;
+    }
+    return (info.lastNotifyTime + MICROSECONDS_PER_SECOND / info.policy.maxRate - now);
+}
+
+void HotArea::ScheduleFlush(int64_t now, int64_t delay)
+{
+    if ((delay < 0) || (flushScheduled_ && (flushTime_ <= now + delay))) {
+        return;
+    }
+    if (flushTimer_.Arm(std::chrono::microseconds(delay), [this] { FlushPending(); }) != RET_OK) {
+        FI_HILOGE("Failed to arm flush timer");
+        return;
+    }
+    flushScheduled_ = true;
+    flushTime_ = now + delay;
+}
+
+void HotArea::FlushPending()
+{
+    CALL_DEBUG_ENTER;
+    std::lock_guard guard(lock_);
+    flushScheduled_ = false;
+    int64_t now = clock_();
+    int64_t flushDelay { -1 };
+    for (auto &[pid, info] : callbacks_) {
+        if (!info.pending) {
+            continue;
+        }
+        if (int64_t delay = GetRateLimitDelay(info, now); delay > 0) {
+            flushDelay = ((flushDelay < 0) ? delay : std::min(flushDelay, delay));
+            continue;
+        }
+        NotifyListener(info, info.pendingMsg, info.pendingEdge, now, flushDelay);
+    }
+    ScheduleFlush(now, flushDelay);
+}
+
 void HotArea::OnClientDied(const ClientDiedEvent &event)
 {
     FI_HILOGI("Remove client died listener, pid: %{public}d", event.pid);
-    callbacks_.erase(HotAreaInfo { .pid = event.pid });
+    std::lock_guard guard(lock_);
+    callbacks_.erase(event.pid);
 }
 
-void HotArea::NotifyHotAreaMessage(int32_t pid, MessageId msgId, HotAreaType msg, bool isEdge)
+bool HotArea::NotifyHotAreaMessage(HotAreaInfo &info, HotAreaType msg, bool isEdge)
 {
     CALL_DEBUG_ENTER;
-    CHKPV(env_);
-    auto session = env_->GetSocketSessionManager().FindSessionByPid(pid);
-    CHKPV(session);
-    NetPacket pkt(msgId);
+    CHKPF(env_);
+    auto session = info.session.lock();
+    if (session == nullptr) {
+        session = env_->GetSocketSessionManager().FindSessionByPid(info.pid);
+        CHKPF(session);
+        info.session = session;
+    }
+    NetPacket pkt(info.msgId);
 
     pkt << displayX_ << displayY_ << static_cast<int32_t>(msg) << isEdge;
     if (pkt.ChkRWError()) {
         FI_HILOGE("Packet write data failed");
-        return;
+        return false;
     }
     if (!session->SendMsg(pkt)) {
         FI_HILOGE("Sending failed");
-        return;
+        info.session.reset();
+        return false;
     }
+    return true;
 }
 } // namespace Cooperate
 } // namespace DeviceStatus
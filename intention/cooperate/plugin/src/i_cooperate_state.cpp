@@ -43,9 +43,10 @@ void ICooperateState::Switch(std::shared_ptr<ICooperateStep> step)
 
 void ICooperateState::ICooperateStep::OnEvent(Context &context, const CooperateEvent &event)
 {
-    if (auto iter = handlers_.find(event.type); iter != handlers_.end()) {
-        iter->second(context, event);
-    } else if (event.type != CooperateEventType::INPUT_POINTER_EVENT) {
+    if (handlers_.Dispatch(*this, context, event)) {
+        return;
+    }
+    if (event.type != CooperateEventType::INPUT_POINTER_EVENT) {
         FI_HILOGD("Unhandled event(%{public}d)", event.type);
     }
 }
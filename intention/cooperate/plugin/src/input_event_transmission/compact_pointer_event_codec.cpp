@@ -0,0 +1,708 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_transmission/compact_pointer_event_codec.h"
+
+#include <cinttypes>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CompactPointerEventCodec"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+constexpr uint64_t FLAG_KEYFRAME { 1U };
+constexpr uint32_t KEYFRAME_INTERVAL { 64 };
+constexpr size_t MAX_DEVICE_STATES { 8 };
+constexpr size_t MAX_N_PRESSED_BUTTONS { 10 };
+constexpr size_t MAX_N_POINTERS { 10 };
+constexpr size_t MAX_N_PRESSED_KEYS { 10 };
+constexpr size_t MAX_BUFFER_SIZE { 1024 };
+constexpr uint32_t VARINT_SHIFT { 7 };
+constexpr uint64_t VARINT_PAYLOAD { 0x7F };
+constexpr uint8_t VARINT_CONTINUE { 0x80 };
+constexpr uint32_t MAX_VARINT_SHIFT { 63 };
+
+class ByteWriter final {
+public:
+    explicit ByteWriter(std::vector<uint8_t> &bytes) : bytes_(bytes) {}
+
+    void PutVarint(uint64_t value)
+    {
+        while (value > VARINT_PAYLOAD) {
+            bytes_.push_back(static_cast<uint8_t>(value & VARINT_PAYLOAD) | VARINT_CONTINUE);
+            value >>= VARINT_SHIFT;
+        }
+        bytes_.push_back(static_cast<uint8_t>(value));
+    }
+
+    void PutZigzag(int64_t value)
+    {
+        uint64_t sign = (value < 0 ? ~uint64_t { 0 } : uint64_t { 0 });
+        PutVarint((static_cast<uint64_t>(value) << 1) ^ sign);
+    }
+
+    void PutBytes(const std::vector<uint8_t> &bytes)
+    {
+        bytes_.insert(bytes_.end(), bytes.begin(), bytes.end());
+    }
+
+private:
+    std::vector<uint8_t> &bytes_;
+};
+
+class ByteReader final {
+public:
+    ByteReader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+    bool GetVarint(uint64_t &value)
+    {
+        value = 0;
+        for (uint32_t shift = 0; shift <= MAX_VARINT_SHIFT; shift += VARINT_SHIFT) {
+            if (pos_ >= size_) {
+                return false;
+            }
+            uint8_t byte = data_[pos_++];
+            value |= (static_cast<uint64_t>(byte) & VARINT_PAYLOAD) << shift;
+            if ((byte & VARINT_CONTINUE) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool GetZigzag(int64_t &value)
+    {
+        uint64_t raw { 0 };
+        if (!GetVarint(raw)) {
+            return false;
+        }
+        value = static_cast<int64_t>((raw >> 1) ^ (uint64_t { 0 } - (raw & 1U)));
+        return true;
+    }
+
+    bool GetBytes(size_t count, std::vector<uint8_t> &bytes)
+    {
+        if (size_ - pos_ < count) {
+            return false;
+        }
+        bytes.assign(data_ + pos_, data_ + pos_ + count);
+        pos_ += count;
+        return true;
+    }
+
+    bool GetCount(size_t limit, size_t &count)
+    {
+        uint64_t value { 0 };
+        if (!GetVarint(value) || (value >= limit)) {
+            return false;
+        }
+        count = static_cast<size_t>(value);
+        return true;
+    }
+
+    size_t Consumed() const
+    {
+        return pos_;
+    }
+
+private:
+    const uint8_t *data_ { nullptr };
+    size_t size_ { 0 };
+    size_t pos_ { 0 };
+};
+
+template<typename T>
+bool IsSame(const T &lhs, const T &rhs)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        return (std::memcmp(&lhs, &rhs, sizeof(T)) == 0);
+    } else {
+        return (lhs == rhs);
+    }
+}
+
+bool IsSame(const std::vector<double> &lhs, const std::vector<double> &rhs)
+{
+    return ((lhs.size() == rhs.size()) &&
+        (lhs.empty() || (std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(double)) == 0)));
+}
+
+template<typename T>
+struct FloatBits {
+    using Type = std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t, uint32_t>;
+};
+
+template<typename T>
+typename FloatBits<T>::Type ToBits(T value)
+{
+    typename FloatBits<T>::Type bits { 0 };
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+template<typename U>
+U ReverseBytes(U value)
+{
+    U reversed { 0 };
+    for (size_t index = 0; index < sizeof(U); ++index) {
+        reversed = static_cast<U>((reversed << CHAR_BIT) | (value & UINT8_MAX));
+        value >>= CHAR_BIT;
+    }
+    return reversed;
+}
+
+// Integers are written as the zigzag varint of their wrap-around difference from the base value.
+// Floating-point values are XORed with the base value bitwise; nearby values share sign, exponent
+// and leading mantissa bits, so the byte-reversed XOR is a short varint. A flagged bool is the
+// negation of its base value.
+template<typename T>
+void PutField(ByteWriter &writer, const T &value, const T &base)
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        writer.PutVarint(ReverseBytes(ToBits(value) ^ ToBits(base)));
+    } else {
+        writer.PutZigzag(static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(base)));
+    }
+}
+
+template<typename T>
+bool GetField(ByteReader &reader, const T &base, T &value)
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        value = !base;
+        return true;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        uint64_t raw { 0 };
+        if (!reader.GetVarint(raw) || (raw > std::numeric_limits<typename FloatBits<T>::Type>::max())) {
+            return false;
+        }
+        auto bits = ReverseBytes(static_cast<typename FloatBits<T>::Type>(raw)) ^ ToBits(base);
+        std::memcpy(&value, &bits, sizeof(T));
+        return true;
+    } else {
+        int64_t delta { 0 };
+        if (!reader.GetZigzag(delta)) {
+            return false;
+        }
+        value = static_cast<T>(static_cast<uint64_t>(base) + static_cast<uint64_t>(delta));
+        return true;
+    }
+}
+
+template<typename Visitor>
+void VisitScalarFields(Visitor &&visitor)
+{
+    visitor(&PointerEventRecord::eventType);
+    visitor(&PointerEventRecord::id);
+    visitor(&PointerEventRecord::actionTime);
+    visitor(&PointerEventRecord::action);
+    visitor(&PointerEventRecord::actionStartTime);
+    visitor(&PointerEventRecord::sensorInputTime);
+    visitor(&PointerEventRecord::targetDisplayId);
+    visitor(&PointerEventRecord::targetWindowId);
+    visitor(&PointerEventRecord::agentWindowId);
+    visitor(&PointerEventRecord::flag);
+    visitor(&PointerEventRecord::pointerAction);
+    visitor(&PointerEventRecord::pointerId);
+    visitor(&PointerEventRecord::sourceType);
+    visitor(&PointerEventRecord::buttonId);
+    visitor(&PointerEventRecord::fingerCount);
+    visitor(&PointerEventRecord::zOrder);
+    visitor(&PointerEventRecord::interceptorTime);
+    visitor(&PointerEventRecord::scrollRows);
+}
+
+// Every field of InnerPointerItem except pointerId, which identifies the item.
+template<typename Visitor>
+void VisitItemFields(Visitor &&visitor)
+{
+    visitor(&InnerPointerItem::pressed);
+    visitor(&InnerPointerItem::displayX);
+    visitor(&InnerPointerItem::displayY);
+    visitor(&InnerPointerItem::windowX);
+    visitor(&InnerPointerItem::windowY);
+    visitor(&InnerPointerItem::displayXPos);
+    visitor(&InnerPointerItem::displayYPos);
+    visitor(&InnerPointerItem::windowXPos);
+    visitor(&InnerPointerItem::windowYPos);
+    visitor(&InnerPointerItem::width);
+    visitor(&InnerPointerItem::height);
+    visitor(&InnerPointerItem::tiltX);
+    visitor(&InnerPointerItem::tiltY);
+    visitor(&InnerPointerItem::toolDisplayX);
+    visitor(&InnerPointerItem::toolDisplayY);
+    visitor(&InnerPointerItem::toolWindowX);
+    visitor(&InnerPointerItem::toolWindowY);
+    visitor(&InnerPointerItem::toolWidth);
+    visitor(&InnerPointerItem::toolHeight);
+    visitor(&InnerPointerItem::pressure);
+    visitor(&InnerPointerItem::longAxis);
+    visitor(&InnerPointerItem::shortAxis);
+    visitor(&InnerPointerItem::deviceId);
+    visitor(&InnerPointerItem::downTime);
+    visitor(&InnerPointerItem::toolType);
+    visitor(&InnerPointerItem::targetWindowId);
+    visitor(&InnerPointerItem::originPointerId);
+    visitor(&InnerPointerItem::rawDx);
+    visitor(&InnerPointerItem::rawDy);
+}
+
+constexpr uint32_t N_SCALAR_FIELDS { 18 };
+constexpr uint64_t FIELD_AXES { 1ULL << N_SCALAR_FIELDS };
+constexpr uint64_t FIELD_PRESSED_BUTTONS { FIELD_AXES << 1 };
+constexpr uint64_t FIELD_POINTERS { FIELD_PRESSED_BUTTONS << 1 };
+constexpr uint64_t FIELD_PRESSED_KEYS { FIELD_POINTERS << 1 };
+constexpr uint64_t FIELD_BUFFER { FIELD_PRESSED_KEYS << 1 };
+
+const PointerEventRecord EMPTY_RECORD {};
+const InnerPointerItem EMPTY_ITEM {};
+
+const InnerPointerItem &FindItem(const std::vector<InnerPointerItem> &items, int32_t pointerId)
+{
+    for (const auto &item : items) {
+        if (item.pointerId == pointerId) {
+            return item;
+        }
+    }
+    return EMPTY_ITEM;
+}
+
+uint64_t ItemMask(const InnerPointerItem &item, const InnerPointerItem &base)
+{
+    uint64_t mask { 0 };
+    uint32_t bit { 0 };
+    VisitItemFields([&](auto member) {
+        if (!IsSame(item.*member, base.*member)) {
+            mask |= (1ULL << bit);
+        }
+        ++bit;
+    });
+    return mask;
+}
+
+bool IsSamePointers(const std::vector<InnerPointerItem> &lhs, const std::vector<InnerPointerItem> &rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (size_t index = 0; index < lhs.size(); ++index) {
+        if ((lhs[index].pointerId != rhs[index].pointerId) || (ItemMask(lhs[index], rhs[index]) != 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t RecordMask(const PointerEventRecord &record, const PointerEventRecord &base)
+{
+    uint64_t mask { 0 };
+    uint32_t bit { 0 };
+    VisitScalarFields([&](auto member) {
+        if (!IsSame(record.*member, base.*member)) {
+            mask |= (1ULL << bit);
+        }
+        ++bit;
+    });
+    if ((record.axes != base.axes) || !IsSame(record.axisValues, base.axisValues)) {
+        mask |= FIELD_AXES;
+    }
+    if (record.pressedButtons != base.pressedButtons) {
+        mask |= FIELD_PRESSED_BUTTONS;
+    }
+    if (!IsSamePointers(record.pointers, base.pointers)) {
+        mask |= FIELD_POINTERS;
+    }
+    if (record.pressedKeys != base.pressedKeys) {
+        mask |= FIELD_PRESSED_KEYS;
+    }
+    if (record.buffer != base.buffer) {
+        mask |= FIELD_BUFFER;
+    }
+    return mask;
+}
+
+size_t CountAxes(uint32_t axes)
+{
+    size_t count { 0 };
+    for (; axes != 0; axes &= (axes - 1)) {
+        ++count;
+    }
+    return count;
+}
+
+bool IsValid(const PointerEventRecord &record)
+{
+    return ((record.axisValues.size() == CountAxes(record.axes)) &&
+        (record.pressedButtons.size() < MAX_N_PRESSED_BUTTONS) &&
+        (record.pointers.size() < MAX_N_POINTERS) &&
+        (record.pressedKeys.size() < MAX_N_PRESSED_KEYS) &&
+        (record.buffer.size() < MAX_BUFFER_SIZE));
+}
+
+void PutInts(ByteWriter &writer, const std::vector<int32_t> &values)
+{
+    writer.PutVarint(values.size());
+    for (int32_t value : values) {
+        writer.PutZigzag(value);
+    }
+}
+
+bool GetInts(ByteReader &reader, size_t limit, std::vector<int32_t> &values)
+{
+    size_t count { 0 };
+    if (!reader.GetCount(limit, count)) {
+        return false;
+    }
+    values.resize(count);
+    for (auto &value : values) {
+        int64_t raw { 0 };
+        if (!reader.GetZigzag(raw)) {
+            return false;
+        }
+        value = static_cast<int32_t>(raw);
+    }
+    return true;
+}
+
+void PutItem(ByteWriter &writer, const InnerPointerItem &item, const InnerPointerItem &base)
+{
+    uint64_t mask = ItemMask(item, base);
+    writer.PutZigzag(item.pointerId);
+    writer.PutVarint(mask);
+    uint32_t bit { 0 };
+    VisitItemFields([&](auto member) {
+        if ((mask & (1ULL << bit)) != 0) {
+            PutField(writer, item.*member, base.*member);
+        }
+        ++bit;
+    });
+}
+
+bool GetItem(ByteReader &reader, const std::vector<InnerPointerItem> &baseItems, InnerPointerItem &item)
+{
+    int64_t pointerId { 0 };
+    uint64_t mask { 0 };
+    if (!reader.GetZigzag(pointerId) || !reader.GetVarint(mask)) {
+        return false;
+    }
+    const InnerPointerItem &base = FindItem(baseItems, static_cast<int32_t>(pointerId));
+    item = base;
+    item.pointerId = static_cast<int32_t>(pointerId);
+    bool ok { true };
+    uint32_t bit { 0 };
+    VisitItemFields([&](auto member) {
+        if (ok && ((mask & (1ULL << bit)) != 0)) {
+            ok = GetField(reader, base.*member, item.*member);
+        }
+        ++bit;
+    });
+    return ok;
+}
+} // namespace
+
+int32_t PointerEventRecord::FromPointerEvent(std::shared_ptr<MMI::PointerEvent> event, int64_t interceptorTime,
+    PointerEventRecord &record)
+{
+    CHKPR(event, ERROR_NULL_POINTER);
+    record.eventType = event->GetEventType();
+    record.id = event->GetId();
+    record.actionTime = event->GetActionTime();
+    record.action = event->GetAction();
+    record.actionStartTime = event->GetActionStartTime();
+    record.sensorInputTime = event->GetSensorInputTime();
+    record.deviceId = event->GetDeviceId();
+    record.targetDisplayId = event->GetTargetDisplayId();
+    record.targetWindowId = event->GetTargetWindowId();
+    record.agentWindowId = event->GetAgentWindowId();
+    record.flag = event->GetFlag();
+    record.pointerAction = event->GetPointerAction();
+    record.pointerId = event->GetPointerId();
+    record.sourceType = event->GetSourceType();
+    record.buttonId = event->GetButtonId();
+    record.fingerCount = event->GetFingerCount();
+    record.zOrder = event->GetZOrder();
+    record.axes = event->GetAxes();
+    record.axisValues.clear();
+    for (int32_t i = MMI::PointerEvent::AXIS_TYPE_UNKNOWN; i < MMI::PointerEvent::AXIS_TYPE_MAX; ++i) {
+        if (event->HasAxis(static_cast<MMI::PointerEvent::AxisType>(i))) {
+            record.axisValues.push_back(event->GetAxisValue(static_cast<MMI::PointerEvent::AxisType>(i)));
+        }
+    }
+    std::set<int32_t> pressedBtns = event->GetPressedButtons();
+    record.pressedButtons.assign(pressedBtns.begin(), pressedBtns.end());
+    std::vector<int32_t> pointerIds = event->GetPointerIds();
+    record.pointers.resize(pointerIds.size());
+    for (size_t index = 0; index < pointerIds.size(); ++index) {
+        MMI::PointerEvent::PointerItem item;
+        if (!event->GetPointerItem(pointerIds[index], item)) {
+            FI_HILOGE("Get pointer item failed");
+            return RET_ERR;
+        }
+        InnerPointerItem::Transform(item, record.pointers[index]);
+    }
+    record.pressedKeys = event->GetPressedKeys();
+    record.buffer = event->GetBuffer();
+    record.interceptorTime = interceptorTime;
+    record.scrollRows = event->GetScrollRows();
+    return RET_OK;
+}
+
+int32_t PointerEventRecord::ToPointerEvent(const PointerEventRecord &record, std::shared_ptr<MMI::PointerEvent> event)
+{
+    CHKPR(event, ERROR_NULL_POINTER);
+    event->SetId(record.id);
+    event->SetActionTime(record.actionTime);
+    event->SetAction(record.action);
+    event->SetActionStartTime(record.actionStartTime);
+    event->SetSensorInputTime(record.sensorInputTime);
+    event->SetDeviceId(record.deviceId);
+    event->SetTargetDisplayId(record.targetDisplayId);
+    event->SetTargetWindowId(record.targetWindowId);
+    event->SetAgentWindowId(record.agentWindowId);
+    event->AddFlag(record.flag);
+    event->SetPointerAction(record.pointerAction);
+    event->SetPointerId(record.pointerId);
+    event->SetSourceType(record.sourceType);
+    event->SetButtonId(record.buttonId);
+    event->SetFingerCount(record.fingerCount);
+    event->SetZOrder(record.zOrder);
+    size_t nextValue { 0 };
+    for (int32_t i = MMI::PointerEvent::AXIS_TYPE_UNKNOWN;
+        (i < MMI::PointerEvent::AXIS_TYPE_MAX) && (nextValue < record.axisValues.size()); ++i) {
+        if (MMI::PointerEvent::HasAxis(record.axes, static_cast<MMI::PointerEvent::AxisType>(i))) {
+            event->SetAxisValue(static_cast<MMI::PointerEvent::AxisType>(i), record.axisValues[nextValue++]);
+        }
+    }
+    for (int32_t btnId : record.pressedButtons) {
+        event->SetButtonPressed(btnId);
+    }
+    for (const auto &innerItem : record.pointers) {
+        MMI::PointerEvent::PointerItem item;
+        InnerPointerItem::Transform(innerItem, item);
+        event->AddPointerItem(item);
+    }
+    event->SetPressedKeys(record.pressedKeys);
+    event->SetBuffer(record.buffer);
+    event->SetScrollRows(record.scrollRows);
+    return RET_OK;
+}
+
+int32_t CompactPointerEventEncoder::Encode(std::shared_ptr<MMI::PointerEvent> event, int64_t interceptorTime,
+    NetPacket &pkt)
+{
+    if (PointerEventRecord::FromPointerEvent(event, interceptorTime, record_) != RET_OK) {
+        FI_HILOGE("Failed to flatten pointer event");
+        return RET_ERR;
+    }
+    return EncodeRecord(record_, pkt);
+}
+
+int32_t CompactPointerEventEncoder::Encode(const PointerEventRecord &record, NetPacket &pkt)
+{
+    return EncodeRecord(record, pkt);
+}
+
+void CompactPointerEventEncoder::Reset()
+{
+    states_.clear();
+}
+
+int32_t CompactPointerEventEncoder::EncodeRecord(const PointerEventRecord &record, NetPacket &pkt)
+{
+    if (!IsValid(record)) {
+        FI_HILOGE("Pointer event exceeds the limits of compact schema");
+        return RET_ERR;
+    }
+    auto iter = states_.find(record.deviceId);
+    if (iter == states_.end()) {
+        if (states_.size() >= MAX_DEVICE_STATES) {
+            states_.clear();
+        }
+        iter = states_.emplace(record.deviceId, DeviceState {}).first;
+    }
+    DeviceState &state = iter->second;
+    bool keyframe = ((state.seq == 0) || (state.nSinceKeyframe >= KEYFRAME_INTERVAL));
+    const PointerEventRecord &base = (keyframe ? EMPTY_RECORD : state.last);
+    uint64_t mask = RecordMask(record, base);
+
+    body_.clear();
+    ByteWriter writer(body_);
+    writer.PutVarint(COMPACT_POINTER_EVENT_SCHEMA);
+    writer.PutVarint(keyframe ? FLAG_KEYFRAME : 0);
+    writer.PutZigzag(record.deviceId);
+    writer.PutVarint(state.seq + 1);
+    writer.PutVarint(mask);
+    uint32_t bit { 0 };
+    VisitScalarFields([&](auto member) {
+        if ((mask & (1ULL << bit)) != 0) {
+            PutField(writer, record.*member, base.*member);
+        }
+        ++bit;
+    });
+    if ((mask & FIELD_AXES) != 0) {
+        writer.PutVarint(record.axes);
+        for (double value : record.axisValues) {
+            PutField(writer, value, 0.0);
+        }
+    }
+    if ((mask & FIELD_PRESSED_BUTTONS) != 0) {
+        PutInts(writer, record.pressedButtons);
+    }
+    if ((mask & FIELD_POINTERS) != 0) {
+        writer.PutVarint(record.pointers.size());
+        for (const auto &item : record.pointers) {
+            PutItem(writer, item, FindItem(base.pointers, item.pointerId));
+        }
+    }
+    if ((mask & FIELD_PRESSED_KEYS) != 0) {
+        PutInts(writer, record.pressedKeys);
+    }
+    if ((mask & FIELD_BUFFER) != 0) {
+        writer.PutVarint(record.buffer.size());
+        writer.PutBytes(record.buffer);
+    }
+    if (!pkt.Write(reinterpret_cast<const char *>(body_.data()), body_.size()) || pkt.ChkRWError()) {
+        FI_HILOGE("Failed to write compact pointer event");
+        return RET_ERR;
+    }
+    state.last = record;
+    ++state.seq;
+    state.nSinceKeyframe = (keyframe ? 1 : state.nSinceKeyframe + 1);
+    return RET_OK;
+}
+
+int32_t CompactPointerEventDecoder::Decode(NetPacket &pkt, std::shared_ptr<MMI::PointerEvent> event,
+    int64_t &interceptorTime)
+{
+    CHKPR(event, ERROR_NULL_POINTER);
+    if (DecodeRecord(pkt) != RET_OK) {
+        return RET_ERR;
+    }
+    interceptorTime = record_.interceptorTime;
+    return PointerEventRecord::ToPointerEvent(record_, event);
+}
+
+int32_t CompactPointerEventDecoder::Decode(NetPacket &pkt, PointerEventRecord &record)
+{
+    if (DecodeRecord(pkt) != RET_OK) {
+        return RET_ERR;
+    }
+    record = record_;
+    return RET_OK;
+}
+
+void CompactPointerEventDecoder::Reset()
+{
+    states_.clear();
+}
+
+int32_t CompactPointerEventDecoder::DecodeRecord(NetPacket &pkt)
+{
+    int32_t residual = pkt.ResidualSize();
+    if (residual <= 0) {
+        FI_HILOGE("Empty compact pointer event");
+        return RET_ERR;
+    }
+    ByteReader reader(reinterpret_cast<const uint8_t *>(pkt.ReadBuf()), static_cast<size_t>(residual));
+    uint64_t schema { 0 };
+    uint64_t flags { 0 };
+    int64_t deviceId { 0 };
+    uint64_t seq { 0 };
+    uint64_t mask { 0 };
+    if (!reader.GetVarint(schema) || !reader.GetVarint(flags) || !reader.GetZigzag(deviceId) ||
+        !reader.GetVarint(seq) || !reader.GetVarint(mask)) {
+        FI_HILOGE("Corrupted compact pointer event header");
+        return RET_ERR;
+    }
+    if (schema != COMPACT_POINTER_EVENT_SCHEMA) {
+        FI_HILOGE("Unsupported pointer event schema:%{public}" PRIu64, schema);
+        return RET_ERR;
+    }
+    bool keyframe = ((flags & FLAG_KEYFRAME) != 0);
+    auto iter = states_.find(static_cast<int32_t>(deviceId));
+    if (!keyframe && ((iter == states_.end()) || (seq != static_cast<uint64_t>(iter->second.seq) + 1))) {
+        FI_HILOGW("Out-of-sequence pointer event from device %{public}" PRId64 ", wait for keyframe", deviceId);
+        return RET_ERR;
+    }
+    const PointerEventRecord &base = (keyframe ? EMPTY_RECORD : iter->second.last);
+    record_ = base;
+    record_.deviceId = static_cast<int32_t>(deviceId);
+
+    bool ok { true };
+    uint32_t bit { 0 };
+    VisitScalarFields([&](auto member) {
+        if (ok && ((mask & (1ULL << bit)) != 0)) {
+            ok = GetField(reader, base.*member, record_.*member);
+        }
+        ++bit;
+    });
+    if (ok && ((mask & FIELD_AXES) != 0)) {
+        uint64_t axes { 0 };
+        ok = (reader.GetVarint(axes) && (axes <= UINT32_MAX));
+        record_.axes = static_cast<uint32_t>(axes);
+        record_.axisValues.resize(ok ? CountAxes(record_.axes) : 0);
+        for (size_t index = 0; ok && (index < record_.axisValues.size()); ++index) {
+            ok = GetField(reader, 0.0, record_.axisValues[index]);
+        }
+    }
+    if (ok && ((mask & FIELD_PRESSED_BUTTONS) != 0)) {
+        ok = GetInts(reader, MAX_N_PRESSED_BUTTONS, record_.pressedButtons);
+    }
+    if (ok && ((mask & FIELD_POINTERS) != 0)) {
+        size_t nPointers { 0 };
+        ok = reader.GetCount(MAX_N_POINTERS, nPointers);
+        items_.resize(ok ? nPointers : 0);
+        for (size_t index = 0; ok && (index < items_.size()); ++index) {
+            ok = GetItem(reader, base.pointers, items_[index]);
+        }
+        record_.pointers.swap(items_);
+    }
+    if (ok && ((mask & FIELD_PRESSED_KEYS) != 0)) {
+        ok = GetInts(reader, MAX_N_PRESSED_KEYS, record_.pressedKeys);
+    }
+    if (ok && ((mask & FIELD_BUFFER) != 0)) {
+        size_t bufSize { 0 };
+        ok = (reader.GetCount(MAX_BUFFER_SIZE, bufSize) && reader.GetBytes(bufSize, record_.buffer));
+    }
+    if (!ok) {
+        FI_HILOGE("Corrupted compact pointer event");
+        return RET_ERR;
+    }
+    pkt.SeekReadPos(static_cast<int32_t>(reader.Consumed()));
+    if (iter == states_.end()) {
+        if (states_.size() >= MAX_DEVICE_STATES) {
+            states_.clear();
+        }
+        iter = states_.emplace(record_.deviceId, DeviceState {}).first;
+    }
+    iter->second.last = record_;
+    iter->second.seq = static_cast<uint32_t>(seq);
+    return RET_OK;
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
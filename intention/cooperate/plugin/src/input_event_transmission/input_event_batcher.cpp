@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_transmission/input_event_batcher.h"
+
+#include <algorithm>
+
+#include "devicestatus_define.h"
+#include "net_packet_view.h"
+
+#undef LOG_TAG
+#define LOG_TAG "InputEventBatcher"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+InputEventBatcher::InputEventBatcher(size_t byteBudget)
+    : byteBudget_(std::min(byteBudget, static_cast<size_t>(MAX_STREAM_BUF_CAPACITY)))
+{}
+
+// Fails without side effects if the packet does not fit into the current batch;
+// the owner then flushes the batch and appends again.
+bool InputEventBatcher::Append(const NetPacket &packet)
+{
+    if (packet.GetMsgId() == MessageId::DSOFTBUS_INPUT_EVENT_BATCH) {
+        FI_HILOGE("Batches do not nest");
+        return false;
+    }
+    size_t packetLength = static_cast<size_t>(packet.GetPacketLength());
+    if (!IsEmpty() && ((batch_.Size() + packetLength) > byteBudget_)) {
+        return false;
+    }
+    if ((batch_.Size() + packetLength) > static_cast<size_t>(MAX_STREAM_BUF_CAPACITY)) {
+        FI_HILOGE("Packet is too large");
+        return false;
+    }
+    if (!packet.MakeData(batch_)) {
+        FI_HILOGE("Failed to append packet to batch");
+        batch_.Reset();
+        nEvents_ = 0;
+        return false;
+    }
+    ++nEvents_;
+    return true;
+}
+
+int32_t InputEventBatcher::Flush(NetPacket &frame)
+{
+    if (IsEmpty()) {
+        return RET_ERR;
+    }
+    if (!frame.Write(batch_.Data(), batch_.Size())) {
+        FI_HILOGE("Failed to write batch frame");
+        Clear();
+        return RET_ERR;
+    }
+    Clear();
+    return RET_OK;
+}
+
+void InputEventBatcher::Clear()
+{
+    batch_.Reset();
+    nEvents_ = 0;
+}
+
+// Hands every packet of the batch to the handler as a view on the frame payload,
+// which is only valid for the duration of the call.
+int32_t InputEventBatcher::Unpack(NetPacket &frame, std::function<void(NetPacket&)> handler)
+{
+    CHKPR(handler, RET_ERR);
+    while (frame.ResidualSize() > 0) {
+        if (frame.ResidualSize() < static_cast<int32_t>(sizeof(PackHead))) {
+            FI_HILOGE("Corrupted batch frame");
+            return RET_ERR;
+        }
+        const char *buf = frame.ReadBuf();
+        PackHead head;
+        errno_t ret = memcpy_s(&head, sizeof(head), buf, sizeof(PackHead));
+        if (ret != EOK) {
+            FI_HILOGE("Failed to call memcpy_s");
+            return RET_ERR;
+        }
+        if ((head.size < 0) || (head.size > (frame.ResidualSize() - static_cast<int32_t>(sizeof(PackHead)))) ||
+            (head.idMsg == MessageId::DSOFTBUS_INPUT_EVENT_BATCH)) {
+            FI_HILOGE("Corrupted packet in batch frame");
+            return RET_ERR;
+        }
+        NetPacketView packet(head.idMsg, &buf[sizeof(PackHead)], static_cast<size_t>(head.size));
+        frame.SeekReadPos(packet.GetPacketLength());
+        handler(packet);
+    }
+    return RET_OK;
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -83,7 +83,9 @@ void InputEventBuilder::Enable(Context &context)
     localNetworkId_ = context.Local();
     pointerSpeed_ = context.GetPointerSpeed();
     touchPadSpeed_ = context.GetTouchPadSpeed();
+    compactDecoder_.Reset();
     env_->GetDSoftbus().AddObserver(observer_);
+    AnnounceInputEventSchema();
     Coordinate cursorPos = context.CursorPosition();
     TurnOffChannelScan();
     FI_HILOGI("Cursor transite in (%{private}d, %{private}d)", cursorPos.x, cursorPos.y);
@@ -125,6 +127,23 @@ void InputEventBuilder::Update(Context &context)
 {
     remoteNetworkId_ = context.Peer();
     FI_HILOGI("Update peer to \'%{public}s\'", Utility::Anonymize(remoteNetworkId_).c_str());
+    AnnounceInputEventSchema();
+}
+
+void InputEventBuilder::AnnounceInputEventSchema()
+{
+    CHKPV(env_);
+    // The peer restarts its compact stream with keyframes once it learns the schema, which also
+    // resynchronizes the decoder after a peer change.
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_EVENT_SCHEMA);
+    packet << INPUT_EVENT_BATCH_SCHEMA;
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Failed to write input event schema");
+        return;
+    }
+    if (env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet) != RET_OK) {
+        FI_HILOGW("Failed to announce input event schema, peer keeps legacy format");
+    }
 }
 
 void InputEventBuilder::Freeze()
@@ -191,7 +210,8 @@ bool InputEventBuilder::OnPacket(const std::string &networkId, Msdp::NetPacket &
         return false;
     }
     switch (packet.GetMsgId()) {
-        case MessageId::DSOFTBUS_INPUT_POINTER_EVENT: {
+        case MessageId::DSOFTBUS_INPUT_POINTER_EVENT:
+        case MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT: {
             OnPointerEvent(packet);
             break;
         }
@@ -199,6 +219,10 @@ bool InputEventBuilder::OnPacket(const std::string &networkId, Msdp::NetPacket &
             OnKeyEvent(packet);
             break;
         }
+        case MessageId::DSOFTBUS_INPUT_EVENT_BATCH: {
+            OnEventBatch(networkId, packet);
+            break;
+        }
         case MessageId::DSOFTBUS_HEART_BEAT_PACKET: {
             FI_HILOGD("Heart beat received");
             break;
@@ -226,7 +250,7 @@ void InputEventBuilder::OnPointerEvent(Msdp::NetPacket &packet)
     }
     pointerEvent_->Reset();
     int64_t curInterceptorTime = -1;
-    int32_t ret = InputEventSerialization::Unmarshalling(packet, pointerEvent_, curInterceptorTime);
+    int32_t ret = UnmarshallingPointerEvent(packet, curInterceptorTime);
     if (ret != RET_OK) {
         FI_HILOGE("Failed to deserialize pointer event");
         return;
@@ -311,6 +335,24 @@ void InputEventBuilder::OnNotifyCrossDrag(std::shared_ptr<MMI::PointerEvent> poi
     env_->GetDragManager().NotifyCrossDrag(isButtonDown);
 }
 
+void InputEventBuilder::OnEventBatch(const std::string &networkId, Msdp::NetPacket &packet)
+{
+    int32_t ret = InputEventBatcher::Unpack(packet, [this, &networkId](Msdp::NetPacket &event) {
+        this->OnPacket(networkId, event);
+    });
+    if (ret != RET_OK) {
+        FI_HILOGE("Failed to unpack input event batch");
+    }
+}
+
+int32_t InputEventBuilder::UnmarshallingPointerEvent(Msdp::NetPacket &packet, int64_t &interceptorTime)
+{
+    if (packet.GetMsgId() == MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT) {
+        return compactDecoder_.Decode(packet, pointerEvent_, interceptorTime);
+    }
+    return InputEventSerialization::Unmarshalling(packet, pointerEvent_, interceptorTime);
+}
+
 void InputEventBuilder::OnKeyEvent(Msdp::NetPacket &packet)
 {
     CHKPV(keyEvent_);
@@ -76,6 +76,10 @@ int32_t InputEventInterceptor::Enable(Context &context)
     FI_HILOGI("Cursor transite out at (%{private}d, %{private}d)", cursorPos.x, cursorPos.y);
     remoteNetworkId_ = context.Peer();
     sender_ = context.Sender();
+#ifdef OHOS_BUILD_COOPERATE_ADAPTIVE_SAMPLING
+    inputEventSampler_.SetSamplingMode(SamplingMode::ADAPTIVE);
+#endif // OHOS_BUILD_COOPERATE_ADAPTIVE_SAMPLING
+    inputEventSampler_.ResetStats();
     inputEventSampler_.SetPointerEventHandler(
         [this](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
             this->OnPointerEvent(pointerEvent);
@@ -117,6 +121,10 @@ void InputEventInterceptor::HeartBeatSend()
             return;
         }
         env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet);
+        if (DSoftbusLinkState linkState; (env_->GetDSoftbus().GetLinkState(remoteNetworkId_, linkState) == RET_OK) &&
+            (linkState.rttMs >= 0)) {
+            SetLinkRtt(linkState.rttMs);
+        }
     });
 }
 
@@ -128,7 +136,16 @@ void InputEventInterceptor::Disable()
     if (interceptorId_ > 0) {
         env_->GetInput().RemoveInterceptor(interceptorId_);
         interceptorId_ = -1;
+        ReportSamplerStats();
+    }
+    {
+        std::lock_guard<std::mutex> guard(batchMutex_);
+        FlushBatch();
+        FI_HILOGI("Batched %{public}zu events into %{public}zu frames", nBatchedEvents_, nBatchFrames_);
+        nBatchedEvents_ = 0;
+        nBatchFrames_ = 0;
     }
+    peerSchema_ = LEGACY_POINTER_EVENT_SCHEMA;
     if ((pointerEventTimer_ >= 0)) {
         env_->GetTimerManager().RemoveTimerAsync(pointerEventTimer_);
         pointerEventTimer_ = -1;
@@ -143,9 +160,48 @@ void InputEventInterceptor::Disable()
     heartTimer_ = -1;
 }
 
+InputEventSamplerStats InputEventInterceptor::GetSamplerStats() const
+{
+    return inputEventSampler_.GetStats();
+}
+
+void InputEventInterceptor::SetLinkRtt(int32_t rttMs)
+{
+    inputEventSampler_.SetLinkRtt(rttMs);
+}
+
+void InputEventInterceptor::SetPeerSchema(const std::string &networkId, uint32_t schema)
+{
+    if (networkId != remoteNetworkId_) {
+        FI_HILOGW("Schema from unexpected peer \'%{public}s\'", Utility::Anonymize(networkId).c_str());
+        return;
+    }
+    // The peer announces its schema whenever it (re)starts decoding, so start over with a keyframe.
+    resetEncoder_ = true;
+    peerSchema_ = std::min(schema, INPUT_EVENT_BATCH_SCHEMA);
+    FI_HILOGI("Send pointer events to \'%{public}s\' with schema %{public}u",
+        Utility::Anonymize(remoteNetworkId_).c_str(), peerSchema_.load());
+}
+
+void InputEventInterceptor::ReportSamplerStats()
+{
+    InputEventSamplerStats stats = inputEventSampler_.GetStats();
+    FI_HILOGI("Sampler stats with '%{public}s', in:%{public}" PRIu64 "(%{public}.1f/s), "
+        "out:%{public}" PRIu64 "(%{public}.1f/s), ratio:%{public}.2f, latency avg:%{public}" PRId64
+        "us max:%{public}" PRId64 "us, window:%{public}" PRId64 "us, rtt:%{public}dms",
+        Utility::Anonymize(remoteNetworkId_).c_str(), stats.nInputEvents, stats.inputRate,
+        stats.nOutputEvents, stats.outputRate, stats.aggregationRatio, stats.avgAddedLatencyUs,
+        stats.maxAddedLatencyUs, stats.windowUs, stats.linkRttMs);
+}
+
 void InputEventInterceptor::Update(Context &context)
 {
+    {
+        std::lock_guard<std::mutex> guard(batchMutex_);
+        FlushBatch();
+    }
     remoteNetworkId_ = context.Peer();
+    peerSchema_ = LEGACY_POINTER_EVENT_SCHEMA;
     FI_HILOGI("Update peer to \'%{public}s\'", Utility::Anonymize(remoteNetworkId_).c_str());
 }
 
@@ -173,22 +229,37 @@ void InputEventInterceptor::OnPointerEvent(std::shared_ptr<MMI::PointerEvent> po
         pointerEvent->SetPointerAction(originAction);
     }
     OnNotifyCrossDrag(pointerEvent);
-    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    NetPacket packet(peerSchema_ >= COMPACT_POINTER_EVENT_SCHEMA ?
+        MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT : MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
 
-    int32_t ret = InputEventSerialization::Marshalling(pointerEvent, packet, interceptorTime);
+    int32_t ret = MarshallingPointerEvent(pointerEvent, interceptorTime, packet);
     if (ret != RET_OK) {
         FI_HILOGE("Failed to serialize pointer event");
         return;
     }
     FI_HILOGD("PointerEvent(No:%{public}d,Source:%{public}s,Action:%{public}s)",
         pointerEvent->GetId(), pointerEvent->DumpSourceType(), pointerEvent->DumpPointerAction());
-    env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet);
+    auto pointerAction = pointerEvent->GetPointerAction();
+    TransmitPacket(packet, (pointerAction != MMI::PointerEvent::POINTER_ACTION_MOVE) &&
+        (pointerAction != MMI::PointerEvent::POINTER_ACTION_PULL_MOVE));
     pointerEventTimer_ = env_->GetTimerManager().AddTimerAsync(POINTER_EVENT_TIMEOUT, REPEAT_ONCE, [this]() {
         TurnOnChannelScan();
         pointerEventTimer_ = -1;
     });
 }
 
+int32_t InputEventInterceptor::MarshallingPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent,
+    int64_t interceptorTime, NetPacket &packet)
+{
+    if (packet.GetMsgId() != MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT) {
+        return InputEventSerialization::Marshalling(pointerEvent, packet, interceptorTime);
+    }
+    if (resetEncoder_.exchange(false)) {
+        compactEncoder_.Reset();
+    }
+    return compactEncoder_.Encode(pointerEvent, interceptorTime, packet);
+}
+
 void InputEventInterceptor::OnNotifyCrossDrag(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
@@ -225,7 +296,91 @@ void InputEventInterceptor::OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent)
     }
     FI_HILOGD("KeyEvent(No:%{public}d,Key:%{private}d,Action:%{public}d)",
         keyEvent->GetId(), keyEvent->GetKeyCode(), keyEvent->GetKeyAction());
-    env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet);
+    TransmitPacket(packet, true);
+}
+
+// Moves are held back for about DEFAULT_BATCH_DEADLINE_MS and leave together in one frame. The
+// deadline runs on batchTimer_, not TimerManager, whose intervals are at least 50 ms; should it
+// run late, the next event flushes the overdue batch. Urgent events, such as button and key
+// transitions, flush the batch right behind them.
+void InputEventInterceptor::TransmitPacket(NetPacket &packet, bool urgent)
+{
+    CHKPV(env_);
+    if (peerSchema_ < INPUT_EVENT_BATCH_SCHEMA) {
+        SendInputPacket(packet);
+        return;
+    }
+    std::lock_guard<std::mutex> guard(batchMutex_);
+    if (urgent && batcher_.IsEmpty()) {
+        SendInputPacket(packet);
+        return;
+    }
+    if (!batcher_.IsEmpty() &&
+        (std::chrono::steady_clock::now() - batchStart_ >= std::chrono::milliseconds(DEFAULT_BATCH_DEADLINE_MS))) {
+        FlushBatch();
+    }
+    if (!batcher_.Append(packet)) {
+        FlushBatch();
+        if (!batcher_.Append(packet)) {
+            SendInputPacket(packet);
+            return;
+        }
+    }
+    if (urgent || batcher_.IsFull()) {
+        FlushBatch();
+    } else if (!batchTimerArmed_) {
+        // A deadline already running when its batch is flushed by someone else is
+        // recognised by its generation and ignored.
+        uint64_t generation = batchGeneration_;
+        batchStart_ = std::chrono::steady_clock::now();
+        int32_t ret = batchTimer_.Arm(std::chrono::milliseconds(DEFAULT_BATCH_DEADLINE_MS),
+            [this, generation]() {
+                std::lock_guard<std::mutex> guard(batchMutex_);
+                if (generation == batchGeneration_) {
+                    FlushBatch();
+                }
+            });
+        if (ret != RET_OK) {
+            FI_HILOGE("Failed to arm batch deadline, flush now");
+            FlushBatch();
+            return;
+        }
+        batchTimerArmed_ = true;
+    }
+}
+
+void InputEventInterceptor::FlushBatch()
+{
+    CHKPV(env_);
+    if (batchTimerArmed_) {
+        batchTimer_.Cancel();
+        batchTimerArmed_ = false;
+    }
+    ++batchGeneration_;
+    if (batcher_.IsEmpty()) {
+        return;
+    }
+    size_t nEvents = batcher_.GetEventCount();
+    NetPacket frame(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    if (batcher_.Flush(frame) != RET_OK) {
+        FI_HILOGE("Failed to flush batch of %{public}zu events", nEvents);
+        resetEncoder_ = true;
+        return;
+    }
+    nBatchedEvents_ += nEvents;
+    ++nBatchFrames_;
+    SendInputPacket(frame);
+}
+
+void InputEventInterceptor::SendInputPacket(NetPacket &packet)
+{
+    CHKPV(env_);
+    if (env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet) != RET_OK) {
+        // The peer decodes a compact pointer event against the one before it, so after
+        // a lost frame it can only resume from a keyframe.
+        FI_HILOGW("Failed to send input event, restart with a keyframe");
+        resetEncoder_ = true;
+    }
 }
 
 void InputEventInterceptor::TurnOffChannelScan()
@@ -16,7 +16,9 @@
 #undef LOG_TAG
 #define LOG_TAG "InputEventSampler"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include "input_event_transmission/input_event_sampler.h"
 #include "devicestatus_define.h"
 
@@ -24,6 +26,24 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
+namespace {
+constexpr int32_t DEFAULT_LINK_RTT_MS { 16 };
+constexpr int64_t MIN_WINDOW_US { 2000 };
+constexpr int64_t MAX_WINDOW_US { 16000 };
+constexpr int64_t RTT_WINDOW_DIVISOR { 4 };
+constexpr int64_t US_PER_MS { 1000 };
+constexpr double SLOW_VELOCITY { 0.5 };
+constexpr double FAST_VELOCITY { 4.0 };
+constexpr double VELOCITY_SMOOTHING { 0.25 };
+constexpr double MIN_VELOCITY_SPAN_MS { 0.5 };
+constexpr double NS_PER_SECOND { 1e9 };
+
+int64_t SteadyNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
 
 int32_t InputEventSampler::idealEventIntervalMS_ { 4 };
 int32_t InputEventSampler::expiredIntervalMS_ { 24 };
@@ -36,13 +56,25 @@ std::unordered_set<int32_t> InputEventSampler::filterPointerActions_ {
     MMI::PointerEvent::POINTER_ACTION_PULL_OUT_WINDOW,
 };
 
-InputEventSampler::InputEventSampler() { }
+InputEventSampler::InputEventSampler() : linkRttMs_(DEFAULT_LINK_RTT_MS)
+{
+    ResetStats();
+}
 
 void InputEventSampler::OnPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     if (IsSkipNeeded(pointerEvent)) {
         return;
     }
+    nInputEvents_.fetch_add(1, std::memory_order_relaxed);
+    if (mode_.load(std::memory_order_relaxed) == SamplingMode::ADAPTIVE) {
+        if (IsTouchPadEvent(pointerEvent)) {
+            ForwardEvent(pointerEvent, 0);
+        } else {
+            HandleAdaptiveMouseEvent(pointerEvent, std::chrono::steady_clock::now());
+        }
+        return;
+    }
     if (IsRawEventsExpired()) {
         ClearRawEvents();
     }
@@ -59,6 +91,49 @@ void InputEventSampler::SetPointerEventHandler(PointerEventHandler pointerEventH
     pointerEventHandler_ = pointerEventHandler;
 }
 
+void InputEventSampler::SetSamplingMode(SamplingMode mode)
+{
+    FI_HILOGI("Sampling mode:%{public}d", static_cast<int32_t>(mode));
+    mode_.store(mode, std::memory_order_relaxed);
+}
+
+void InputEventSampler::SetLinkRtt(int32_t rttMs)
+{
+    linkRttMs_.store(std::max(rttMs, 0), std::memory_order_relaxed);
+}
+
+InputEventSamplerStats InputEventSampler::GetStats() const
+{
+    InputEventSamplerStats stats {
+        .nInputEvents = nInputEvents_.load(std::memory_order_relaxed),
+        .nOutputEvents = nOutputEvents_.load(std::memory_order_relaxed),
+        .maxAddedLatencyUs = maxLatencyUs_.load(std::memory_order_relaxed),
+        .windowUs = windowUs_.load(std::memory_order_relaxed),
+        .linkRttMs = linkRttMs_.load(std::memory_order_relaxed),
+    };
+    double elapsed = static_cast<double>(SteadyNowNs() - statsStartNs_.load(std::memory_order_relaxed)) /
+        NS_PER_SECOND;
+    if (elapsed > 0.0) {
+        stats.inputRate = static_cast<double>(stats.nInputEvents) / elapsed;
+        stats.outputRate = static_cast<double>(stats.nOutputEvents) / elapsed;
+    }
+    if (stats.nOutputEvents > 0) {
+        stats.aggregationRatio = static_cast<double>(stats.nInputEvents) / stats.nOutputEvents;
+        stats.avgAddedLatencyUs = totalLatencyUs_.load(std::memory_order_relaxed) /
+            static_cast<int64_t>(stats.nOutputEvents);
+    }
+    return stats;
+}
+
+void InputEventSampler::ResetStats()
+{
+    statsStartNs_.store(SteadyNowNs(), std::memory_order_relaxed);
+    nInputEvents_.store(0, std::memory_order_relaxed);
+    nOutputEvents_.store(0, std::memory_order_relaxed);
+    totalLatencyUs_.store(0, std::memory_order_relaxed);
+    maxLatencyUs_.store(0, std::memory_order_relaxed);
+}
+
 bool InputEventSampler::IsTouchPadEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     if (pointerEvent == nullptr) {
@@ -179,6 +254,13 @@ void InputEventSampler::AggregateRawEvents(std::shared_ptr<MMI::PointerEvent> po
         std::lock_guard<std::mutex> guard(sampledEventMutex_);
         sampledEvents_.push(pointerEvent);
     }
+    {
+        std::lock_guard<std::mutex> guard(rawEventMutex_);
+        if (!rawEvents_.empty()) {
+            RecordLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - rawEvents_.front().rcvdTimeStamp).count());
+        }
+    }
     ClearRawEvents();
     UpdateAggregationTimeStamp();
     prefixRawDxSum_ = 0;
@@ -219,6 +301,7 @@ void InputEventSampler::OnDownSampledEvent()
     while (!sampledEvents_.empty()) {
         auto curEvent = sampledEvents_.front();
         sampledEvents_.pop();
+        nOutputEvents_.fetch_add(1, std::memory_order_relaxed);
         CHKPV(pointerEventHandler_);
         pointerEventHandler_(curEvent);
     }
@@ -248,6 +331,81 @@ bool InputEventSampler::IsAggregationIntervalMatched()
     return false;
 }
 
+void InputEventSampler::HandleAdaptiveMouseEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent,
+    std::chrono::steady_clock::time_point now)
+{
+    CHKPV(pointerEvent);
+    MMI::PointerEvent::PointerItem item;
+    if (!pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), item)) {
+        FI_HILOGE("Corrupted pointerEvent, skip");
+        return;
+    }
+    bool idle = (std::chrono::duration_cast<std::chrono::milliseconds>(
+        now - adaptive_.lastEventTime).count() > expiredIntervalMS_);
+    UpdateVelocity(item.GetRawDx(), item.GetRawDy(), now);
+    adaptive_.lastEventTime = now;
+    if (!adaptive_.hasPending) {
+        adaptive_.hasPending = true;
+        adaptive_.firstPendingTime = now;
+    }
+    adaptive_.pendingDx += item.GetRawDx();
+    adaptive_.pendingDy += item.GetRawDy();
+
+    int64_t windowUs = ComputeWindowUs();
+    windowUs_.store(windowUs, std::memory_order_relaxed);
+    int64_t heldUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        now - adaptive_.firstPendingTime).count();
+    if (!idle && (heldUs < windowUs) && !IsSpecialEvent(pointerEvent)) {
+        return;
+    }
+    MMI::PointerEvent::PointerItem aggregatedItem = item;
+    aggregatedItem.SetRawDx(adaptive_.pendingDx);
+    aggregatedItem.SetRawDy(adaptive_.pendingDy);
+    pointerEvent->UpdatePointerItem(item.GetPointerId(), aggregatedItem);
+    adaptive_.pendingDx = 0;
+    adaptive_.pendingDy = 0;
+    adaptive_.hasPending = false;
+    ForwardEvent(pointerEvent, heldUs);
+}
+
+void InputEventSampler::UpdateVelocity(int32_t rawDx, int32_t rawDy, std::chrono::steady_clock::time_point now)
+{
+    double spanMs = std::chrono::duration<double, std::milli>(now - adaptive_.lastEventTime).count();
+    double velocity = std::hypot(static_cast<double>(rawDx), static_cast<double>(rawDy)) /
+        std::max(spanMs, MIN_VELOCITY_SPAN_MS);
+    adaptive_.velocity += VELOCITY_SMOOTHING * (velocity - adaptive_.velocity);
+}
+
+int64_t InputEventSampler::ComputeWindowUs() const
+{
+    int64_t ceilingUs = std::clamp(linkRttMs_.load(std::memory_order_relaxed) * US_PER_MS / RTT_WINDOW_DIVISOR,
+        MIN_WINDOW_US, MAX_WINDOW_US);
+    if (adaptive_.velocity <= SLOW_VELOCITY) {
+        return MIN_WINDOW_US;
+    }
+    if (adaptive_.velocity >= FAST_VELOCITY) {
+        return ceilingUs;
+    }
+    double ratio = (adaptive_.velocity - SLOW_VELOCITY) / (FAST_VELOCITY - SLOW_VELOCITY);
+    return MIN_WINDOW_US + static_cast<int64_t>(ratio * static_cast<double>(ceilingUs - MIN_WINDOW_US));
+}
+
+void InputEventSampler::ForwardEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent, int64_t latencyUs)
+{
+    nOutputEvents_.fetch_add(1, std::memory_order_relaxed);
+    RecordLatency(latencyUs);
+    CHKPV(pointerEventHandler_);
+    pointerEventHandler_(pointerEvent);
+}
+
+void InputEventSampler::RecordLatency(int64_t latencyUs)
+{
+    totalLatencyUs_.fetch_add(latencyUs, std::memory_order_relaxed);
+    if (latencyUs > maxLatencyUs_.load(std::memory_order_relaxed)) {
+        maxLatencyUs_.store(latencyUs, std::memory_order_relaxed);
+    }
+}
+
 } // namespace Cooperate
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -15,6 +15,8 @@
 
 #include "mouse_location.h"
 
+#include <algorithm>
+
 #include "devicestatus_define.h"
 #include "dsoftbus_handler.h"
 #include "utility.h"
@@ -26,8 +28,16 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
+MouseLocation::MouseLocation(IContext *context) : context_(context), streams_(std::make_shared<RemoteStreams>()) {}
 
-MouseLocation::MouseLocation(IContext *context) : context_(context) {}
+MouseLocation::~MouseLocation()
+{
+    {
+        std::lock_guard guard(streams_->mutex);
+        streams_->encoders.clear();
+    }
+    flushTimer_.Cancel();
+}
 
 void MouseLocation::AddListener(const RegisterEventListenerEvent &event)
 {
@@ -43,6 +53,7 @@ void MouseLocation::AddListener(const RegisterEventListenerEvent &event)
     DSoftbusSubscribeMouseLocation softbusEvent {
         .networkId = localNetworkId_,
         .remoteNetworkId = event.networkId,
+        .supportStream = true,
     };
     if (SubscribeMouseLocation(softbusEvent) != RET_OK) {
         FI_HILOGE("SubscribeMouseLocation failed, networkId:%{public}s", Utility::Anonymize(event.networkId).c_str());
@@ -75,6 +86,7 @@ void MouseLocation::RemoveListener(const UnregisterEventListenerEvent &event)
     listeners_[event.networkId].erase(event.pid);
     if (listeners_[event.networkId].empty()) {
         listeners_.erase(event.networkId);
+        decoders_.erase(event.networkId);
     }
 }
 
@@ -93,6 +105,7 @@ void MouseLocation::OnClientDied(const ClientDiedEvent &event)
                 .remoteNetworkId = it->first,
             };
             UnSubscribeMouseLocation(softbusEvent);
+            decoders_.erase(it->first);
             it = listeners_.erase(it);
         } else {
             ++it;
@@ -107,10 +120,12 @@ void MouseLocation::OnSoftbusSessionClosed(const DSoftbusSessionClosed &notice)
     FI_HILOGI("Session to %{public}s closed", Utility::Anonymize(notice.networkId).c_str());
     if (remoteSubscribers_.find(notice.networkId) != remoteSubscribers_.end()) {
         remoteSubscribers_.erase(notice.networkId);
+        RemoveStream(notice.networkId);
         FI_HILOGI("Remove remote subscribers from %{public}s", Utility::Anonymize(notice.networkId).c_str());
     }
     if (listeners_.find(notice.networkId) != listeners_.end()) {
         listeners_.erase(notice.networkId);
+        decoders_.erase(notice.networkId);
         FI_HILOGI("Remove listeners listen to %{public}s", Utility::Anonymize(notice.networkId).c_str());
     }
 }
@@ -122,6 +137,14 @@ void MouseLocation::OnSubscribeMouseLocation(const DSoftbusSubscribeMouseLocatio
     CHKPV(context_);
     remoteSubscribers_.insert(notice.networkId);
     FI_HILOGI("Add subscriber for networkId:%{public}s successfully", Utility::Anonymize(notice.networkId).c_str());
+    RemoveStream(notice.networkId);
+    if (notice.supportStream && (streamFrameRate_ > 0)) {
+        std::lock_guard streamGuard(streams_->mutex);
+        ++streamSessionId_;
+        streams_->encoders.emplace(notice.networkId, MouseLocationStreamEncoder(streamSessionId_, streamFrameRate_));
+        FI_HILOGI("Stream mouse location to %{public}s, session:%{public}u, frameRate:%{public}d",
+            Utility::Anonymize(notice.networkId).c_str(), streamSessionId_, streamFrameRate_);
+    }
     DSoftbusReplySubscribeMouseLocation event = {
         .networkId = notice.remoteNetworkId,
         .remoteNetworkId = notice.networkId,
@@ -143,6 +166,7 @@ void MouseLocation::OnUnSubscribeMouseLocation(const DSoftbusUnSubscribeMouseLoc
         return;
     }
     remoteSubscribers_.erase(notice.networkId);
+    RemoveStream(notice.networkId);
     DSoftbusReplyUnSubscribeMouseLocation event = {
         .networkId = notice.remoteNetworkId,
         .remoteNetworkId = notice.networkId,
@@ -199,6 +223,39 @@ void MouseLocation::OnRemoteMouseLocation(const DSoftbusSyncMouseLocation &notic
     }
 }
 
+void MouseLocation::OnRemoteMouseLocationStream(const DSoftbusMouseLocationStream &notice)
+{
+    CALL_DEBUG_ENTER;
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = listeners_.find(notice.networkId);
+    if (iter == listeners_.end()) {
+        FI_HILOGE("No listener for networkId:%{public}s stored in listeners",
+            Utility::Anonymize(notice.networkId).c_str());
+        return;
+    }
+    StreamLocation location;
+    if (!decoders_[notice.networkId].Apply(notice.frame, location)) {
+        return;
+    }
+    LocationInfo locationInfo {
+        .displayX = location.displayX,
+        .displayY = location.displayY,
+        .displayWidth = location.displayWidth,
+        .displayHeight = location.displayHeight
+        };
+    for (auto pid : iter->second) {
+        ReportMouseLocationToListener(notice.networkId, locationInfo, pid);
+    }
+}
+
+void MouseLocation::SetStreamFrameRate(int32_t frameRate)
+{
+    CALL_INFO_TRACE;
+    std::lock_guard<std::mutex> guard(mutex_);
+    streamFrameRate_ = std::max(frameRate, 0);
+    FI_HILOGI("Stream frame rate:%{public}d", streamFrameRate_);
+}
+
 void MouseLocation::ProcessData(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     CALL_DEBUG_ENTER;
@@ -219,9 +276,17 @@ void MouseLocation::ProcessData(std::shared_ptr<MMI::PointerEvent> pointerEvent)
         FI_HILOGD("No remote subscriber");
         return;
     }
+    bool hasStream { false };
     for (const auto &networkId : remoteSubscribers_) {
+        if (StreamLocationToRemote(networkId, locationInfo)) {
+            hasStream = true;
+            continue;
+        }
         SyncLocationToRemote(networkId, locationInfo);
     }
+    if (hasStream) {
+        FlushStreams();
+    }
 }
 
 void MouseLocation::SyncLocationToRemote(const std::string &remoteNetworkId, const LocationInfo &locationInfo)
@@ -240,6 +305,66 @@ void MouseLocation::SyncLocationToRemote(const std::string &remoteNetworkId, con
     SyncMouseLocation(softbusEvent);
 }
 
+bool MouseLocation::StreamLocationToRemote(const std::string &remoteNetworkId, const LocationInfo &locationInfo)
+{
+    std::lock_guard guard(streams_->mutex);
+    auto iter = streams_->encoders.find(remoteNetworkId);
+    if (iter == streams_->encoders.end()) {
+        return false;
+    }
+    iter->second.Push(StreamLocation {
+        .displayX = locationInfo.displayX,
+        .displayY = locationInfo.displayY,
+        .displayWidth = locationInfo.displayWidth,
+        .displayHeight = locationInfo.displayHeight,
+    });
+    return true;
+}
+
+void MouseLocation::RemoveStream(const std::string &remoteNetworkId)
+{
+    std::lock_guard guard(streams_->mutex);
+    streams_->encoders.erase(remoteNetworkId);
+}
+
+void MouseLocation::FlushStreams()
+{
+    CALL_DEBUG_ENTER;
+    CHKPV(context_);
+    CHKPV(streams_);
+    std::lock_guard guard(streams_->mutex);
+    int64_t nextDelay { -1 };
+    int64_t now = Utility::GetSysClockTime();
+    for (auto &[networkId, encoder] : streams_->encoders) {
+        if (encoder.GetDelay(now) == 0) {
+            NetPacket packet(MessageId::DSOFTBUS_MOUSE_LOCATION_STREAM);
+            if (encoder.Encode(now, packet) && (SendPacket(context_, networkId, packet) != RET_OK)) {
+                encoder.RequestKeyframe();
+            }
+        }
+        int64_t delay = encoder.GetDelay(now);
+        if ((delay > 0) && ((nextDelay < 0) || (delay < nextDelay))) {
+            nextDelay = delay;
+        }
+    }
+    if ((nextDelay < 0) || streams_->flushScheduled) {
+        return;
+    }
+    // Coalesced locations still pending go out when their frame is due, even if the mouse stops.
+    int32_t ret = flushTimer_.Arm(std::chrono::microseconds(nextDelay), [this] {
+        {
+            std::lock_guard guard(streams_->mutex);
+            streams_->flushScheduled = false;
+        }
+        FlushStreams();
+    });
+    if (ret != RET_OK) {
+        FI_HILOGE("Failed to arm flush timer");
+        return;
+    }
+    streams_->flushScheduled = true;
+}
+
 int32_t MouseLocation::ReplySubscribeMouseLocation(const DSoftbusReplySubscribeMouseLocation &event)
 {
     CALL_INFO_TRACE;
@@ -276,7 +401,7 @@ int32_t MouseLocation::SubscribeMouseLocation(const DSoftbusSubscribeMouseLocati
 {
     CALL_INFO_TRACE;
     NetPacket packet(MessageId::DSOFTBUS_SUBSCRIBE_MOUSE_LOCATION);
-    packet << event.networkId << event.remoteNetworkId;
+    packet << event.networkId << event.remoteNetworkId << event.supportStream;
     if (packet.ChkRWError()) {
         FI_HILOGE("Failed to write data packet");
         return RET_ERR;
@@ -373,14 +498,19 @@ bool MouseLocation::HasLocalListener()
 }
 
 int32_t MouseLocation::SendPacket(const std::string &remoteNetworkId, NetPacket &packet)
+{
+    return SendPacket(context_, remoteNetworkId, packet);
+}
+
+int32_t MouseLocation::SendPacket(IContext *context, const std::string &remoteNetworkId, NetPacket &packet)
 {
     CALL_DEBUG_ENTER;
-    CHKPR(context_, RET_ERR);
-    if (!context_->GetDSoftbus().HasSessionExisted(remoteNetworkId)) {
+    CHKPR(context, RET_ERR);
+    if (!context->GetDSoftbus().HasSessionExisted(remoteNetworkId)) {
         FI_HILOGE("No session connected to %{public}s", Utility::Anonymize(remoteNetworkId).c_str());
         return RET_ERR;
     }
-    if (context_->GetDSoftbus().SendPacket(remoteNetworkId, packet) != RET_OK) {
+    if (context->GetDSoftbus().SendPacket(remoteNetworkId, packet) != RET_OK) {
         FI_HILOGE("SendPacket failed to %{public}s", Utility::Anonymize(remoteNetworkId).c_str());
         return RET_ERR;
     }
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mouse_location_stream.h"
+
+#include <limits>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "MouseLocationStream"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+constexpr int64_t MICROSECONDS_PER_SECOND { 1000000 };
+constexpr int32_t KEYFRAME_INTERVAL { 30 };
+
+bool IsSameLocation(const StreamLocation &lhs, const StreamLocation &rhs)
+{
+    return ((lhs.displayX == rhs.displayX) && (lhs.displayY == rhs.displayY) &&
+        (lhs.displayWidth == rhs.displayWidth) && (lhs.displayHeight == rhs.displayHeight));
+}
+
+bool IsDeltaInRange(int64_t delta)
+{
+    return ((delta >= std::numeric_limits<int16_t>::min()) && (delta <= std::numeric_limits<int16_t>::max()));
+}
+} // namespace
+
+MouseLocationStreamEncoder::MouseLocationStreamEncoder(uint16_t sessionId, int32_t frameRate)
+    : sessionId_(sessionId), interval_(frameRate > 0 ? MICROSECONDS_PER_SECOND / frameRate : 0)
+{}
+
+void MouseLocationStreamEncoder::Push(const StreamLocation &location)
+{
+    if (!needKeyframe_ && IsSameLocation(location, last_)) {
+        hasPending_ = false;
+        return;
+    }
+    pending_ = location;
+    hasPending_ = true;
+}
+
+int64_t MouseLocationStreamEncoder::GetDelay(int64_t now) const
+{
+    if (!hasPending_) {
+        return -1;
+    }
+    int64_t elapsed = now - lastFrameTime_;
+    return (elapsed >= interval_ ? 0 : interval_ - elapsed);
+}
+
+bool MouseLocationStreamEncoder::NeedKeyframe(const StreamLocation &location) const
+{
+    return (needKeyframe_ || (nDeltas_ + 1 >= KEYFRAME_INTERVAL) ||
+        (location.displayWidth != last_.displayWidth) || (location.displayHeight != last_.displayHeight) ||
+        !IsDeltaInRange(static_cast<int64_t>(location.displayX) - last_.displayX) ||
+        !IsDeltaInRange(static_cast<int64_t>(location.displayY) - last_.displayY));
+}
+
+bool MouseLocationStreamEncoder::Encode(int64_t now, NetPacket &packet)
+{
+    if (GetDelay(now) != 0) {
+        return false;
+    }
+    bool isKeyframe = NeedKeyframe(pending_);
+    uint8_t kind = (isKeyframe ? LocationFrame::KEYFRAME : LocationFrame::DELTA);
+    uint16_t seq = seq_ + 1;
+    packet << kind << sessionId_ << seq;
+    if (isKeyframe) {
+        packet << pending_.displayX << pending_.displayY << pending_.displayWidth << pending_.displayHeight;
+    } else {
+        packet << static_cast<int16_t>(pending_.displayX - last_.displayX) <<
+            static_cast<int16_t>(pending_.displayY - last_.displayY);
+    }
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Failed to write location frame");
+        return false;
+    }
+    seq_ = seq;
+    last_ = pending_;
+    lastFrameTime_ = now;
+    hasPending_ = false;
+    needKeyframe_ = false;
+    nDeltas_ = (isKeyframe ? 0 : nDeltas_ + 1);
+    return true;
+}
+
+int32_t MouseLocationStreamDecoder::ReadFrame(NetPacket &packet, LocationFrame &frame)
+{
+    packet >> frame.kind >> frame.sessionId >> frame.seq;
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Failed to read location frame header");
+        return RET_ERR;
+    }
+    if (frame.kind == LocationFrame::KEYFRAME) {
+        packet >> frame.location.displayX >> frame.location.displayY >>
+            frame.location.displayWidth >> frame.location.displayHeight;
+    } else if (frame.kind == LocationFrame::DELTA) {
+        int16_t deltaX { 0 };
+        int16_t deltaY { 0 };
+        packet >> deltaX >> deltaY;
+        frame.location.displayX = deltaX;
+        frame.location.displayY = deltaY;
+    } else {
+        FI_HILOGE("Unknown location frame kind:%{public}u", frame.kind);
+        return RET_ERR;
+    }
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Failed to read location frame");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+bool MouseLocationStreamDecoder::Apply(const LocationFrame &frame, StreamLocation &location)
+{
+    if (frame.kind == LocationFrame::KEYFRAME) {
+        synced_ = true;
+        sessionId_ = frame.sessionId;
+        seq_ = frame.seq;
+        last_ = frame.location;
+        location = last_;
+        return true;
+    }
+    if (!synced_ || (frame.sessionId != sessionId_) || (frame.seq != static_cast<uint16_t>(seq_ + 1))) {
+        FI_HILOGD("Drop location frame out of sequence, session:%{public}u, seq:%{public}u",
+            frame.sessionId, frame.seq);
+        synced_ = false;
+        ++nDropped_;
+        return false;
+    }
+    seq_ = frame.seq;
+    last_.displayX += frame.location.displayX;
+    last_.displayY += frame.location.displayY;
+    location = last_;
+    return true;
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -73,128 +73,48 @@ StateMachine::StateMachine(IContext *env)
     states_[COOPERATE_STATE_OUT] = std::make_shared<CooperateOut>(*this, env);
     states_[COOPERATE_STATE_IN] = std::make_shared<CooperateIn>(*this, env);
 
-    AddHandler(CooperateEventType::ADD_OBSERVER, [this](Context &context, const CooperateEvent &event) {
-        this->AddObserver(context, event);
-    });
-    AddHandler(CooperateEventType::REMOVE_OBSERVER, [this](Context &context, const CooperateEvent &event) {
-        this->RemoveObserver(context, event);
-    });
-    AddHandler(CooperateEventType::REGISTER_LISTENER, [this](Context &context, const CooperateEvent &event) {
-        this->RegisterListener(context, event);
-    });
-    AddHandler(CooperateEventType::UNREGISTER_LISTENER, [this](Context &context, const CooperateEvent &event) {
-        this->UnregisterListener(context, event);
-    });
-    AddHandler(CooperateEventType::REGISTER_HOTAREA_LISTENER, [this](Context &context, const CooperateEvent &event) {
-        this->RegisterHotAreaListener(context, event);
-    });
-    AddHandler(CooperateEventType::UNREGISTER_HOTAREA_LISTENER,
-        [this](Context &context, const CooperateEvent &event) {
-            this->UnregisterHotAreaListener(context, event);
-    });
-    AddHandler(CooperateEventType::ENABLE, [this](Context &context, const CooperateEvent &event) {
-        this->EnableCooperate(context, event);
-    });
-    AddHandler(CooperateEventType::DISABLE, [this](Context &context, const CooperateEvent &event) {
-        this->DisableCooperate(context, event);
-    });
-    AddHandler(CooperateEventType::START, [this](Context &context, const CooperateEvent &event) {
-        this->StartCooperate(context, event);
-    });
-    AddHandler(CooperateEventType::GET_COOPERATE_STATE, [this](Context &context, const CooperateEvent &event) {
-        this->GetCooperateState(context, event);
-    });
-    AddHandler(CooperateEventType::WITH_OPTIONS_START, [this](Context &context, const CooperateEvent &event) {
-        this->StartCooperateWithOptions(context, event);
-    });
-    AddHandler(CooperateEventType::REGISTER_EVENT_LISTENER,
-        [this](Context &context, const CooperateEvent &event) {
-            this->RegisterEventListener(context, event);
-    });
-    AddHandler(CooperateEventType::UNREGISTER_EVENT_LISTENER,
-        [this](Context &context, const CooperateEvent &event) {
-            this->UnregisterEventListener(context, event);
-    });
-    AddHandler(CooperateEventType::DDM_BOARD_ONLINE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnBoardOnline(context, event);
-    });
-    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnBoardOffline(context, event);
-    });
-    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnProfileChanged(context, event);
-    });
-    AddHandler(CooperateEventType::INPUT_POINTER_EVENT,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnPointerEvent(context, event);
-    });
-    AddHandler(CooperateEventType::APP_CLOSED, [this](Context &context, const CooperateEvent &event) {
-        this->OnProcessClientDied(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_SESSION_OPENED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusSessionOpened(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusSessionClosed(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_SUBSCRIBE_MOUSE_LOCATION,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusSubscribeMouseLocation(context, event);
-    });
+    AddHandler(CooperateEventType::ADD_OBSERVER, &StateMachine::AddObserver);
+    AddHandler(CooperateEventType::REMOVE_OBSERVER, &StateMachine::RemoveObserver);
+    AddHandler(CooperateEventType::REGISTER_LISTENER, &StateMachine::RegisterListener);
+    AddHandler(CooperateEventType::UNREGISTER_LISTENER, &StateMachine::UnregisterListener);
+    AddHandler(CooperateEventType::REGISTER_HOTAREA_LISTENER, &StateMachine::RegisterHotAreaListener);
+    AddHandler(CooperateEventType::UNREGISTER_HOTAREA_LISTENER, &StateMachine::UnregisterHotAreaListener);
+    AddHandler(CooperateEventType::ENABLE, &StateMachine::EnableCooperate);
+    AddHandler(CooperateEventType::DISABLE, &StateMachine::DisableCooperate);
+    AddHandler(CooperateEventType::START, &StateMachine::StartCooperate);
+    AddHandler(CooperateEventType::GET_COOPERATE_STATE, &StateMachine::GetCooperateState);
+    AddHandler(CooperateEventType::WITH_OPTIONS_START, &StateMachine::StartCooperateWithOptions);
+    AddHandler(CooperateEventType::REGISTER_EVENT_LISTENER, &StateMachine::RegisterEventListener);
+    AddHandler(CooperateEventType::UNREGISTER_EVENT_LISTENER, &StateMachine::UnregisterEventListener);
+    AddHandler(CooperateEventType::DDM_BOARD_ONLINE, &StateMachine::OnBoardOnline);
+    AddHandler(CooperateEventType::DDM_BOARD_OFFLINE, &StateMachine::OnBoardOffline);
+    AddHandler(CooperateEventType::DDP_COOPERATE_SWITCH_CHANGED, &StateMachine::OnProfileChanged);
+    AddHandler(CooperateEventType::INPUT_POINTER_EVENT, &StateMachine::OnPointerEvent);
+    AddHandler(CooperateEventType::APP_CLOSED, &StateMachine::OnProcessClientDied);
+    AddHandler(CooperateEventType::DSOFTBUS_SESSION_OPENED, &StateMachine::OnSoftbusSessionOpened);
+    AddHandler(CooperateEventType::DSOFTBUS_SESSION_CLOSED, &StateMachine::OnSoftbusSessionClosed);
+    AddHandler(CooperateEventType::DSOFTBUS_SUBSCRIBE_MOUSE_LOCATION, &StateMachine::OnSoftbusSubscribeMouseLocation);
     AddHandler(CooperateEventType::DSOFTBUS_UNSUBSCRIBE_MOUSE_LOCATION,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusUnSubscribeMouseLocation(context, event);
-    });
+        &StateMachine::OnSoftbusUnSubscribeMouseLocation);
     AddHandler(CooperateEventType::DSOFTBUS_REPLY_SUBSCRIBE_MOUSE_LOCATION,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusReplySubscribeMouseLocation(context, event);
-    });
+        &StateMachine::OnSoftbusReplySubscribeMouseLocation);
     AddHandler(CooperateEventType::DSOFTBUS_REPLY_UNSUBSCRIBE_MOUSE_LOCATION,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusReplyUnSubscribeMouseLocation(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_MOUSE_LOCATION,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnSoftbusMouseLocation(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStart(context, event);
-    });
-    AddHandler(CooperateEventType::INPUT_HOTPLUG_EVENT,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnHotPlugEvent(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_INPUT_DEV_HOT_PLUG,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteHotPlug(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_INPUT_DEV_SYNC,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteInputDevice(context, event);
-    });
-    AddHandler(CooperateEventType::STOP, [this](Context &context, const CooperateEvent &event) {
-        this->StopCooperate(context, event);
-    });
-    AddHandler(CooperateEventType::UPDATE_VIRTUAL_DEV_ID_MAP, [this](Context &context, const CooperateEvent &event) {
-        this->UpdateVirtualDeviceIdMap(context, event);
-    });
-    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS,
-        [this](Context &context, const CooperateEvent &event) {
-            this->OnRemoteStartWithOptions(context, event);
-    });
+        &StateMachine::OnSoftbusReplyUnSubscribeMouseLocation);
+    AddHandler(CooperateEventType::DSOFTBUS_MOUSE_LOCATION, &StateMachine::OnSoftbusMouseLocation);
+    AddHandler(CooperateEventType::DSOFTBUS_MOUSE_LOCATION_STREAM, &StateMachine::OnSoftbusMouseLocationStream);
+    AddHandler(CooperateEventType::DSOFTBUS_INPUT_EVENT_SCHEMA, &StateMachine::OnSoftbusInputEventSchema);
+    AddHandler(CooperateEventType::DSOFTBUS_START_COOPERATE, &StateMachine::OnRemoteStart);
+    AddHandler(CooperateEventType::INPUT_HOTPLUG_EVENT, &StateMachine::OnHotPlugEvent);
+    AddHandler(CooperateEventType::DSOFTBUS_INPUT_DEV_HOT_PLUG, &StateMachine::OnRemoteHotPlug);
+    AddHandler(CooperateEventType::DSOFTBUS_INPUT_DEV_SYNC, &StateMachine::OnRemoteInputDevice);
+    AddHandler(CooperateEventType::STOP, &StateMachine::StopCooperate);
+    AddHandler(CooperateEventType::UPDATE_VIRTUAL_DEV_ID_MAP, &StateMachine::UpdateVirtualDeviceIdMap);
+    AddHandler(CooperateEventType::DSOFTBUS_COOPERATE_WITH_OPTIONS, &StateMachine::OnRemoteStartWithOptions);
 }
 
 void StateMachine::OnEvent(Context &context, const CooperateEvent &event)
 {
-    if (auto iter = handlers_.find(event.type); iter != handlers_.end()) {
-        iter->second(context, event);
-    } else {
+    if (!handlers_.Dispatch(*this, context, event)) {
         Transfer(context, event);
     }
 }
@@ -221,9 +141,9 @@ void StateMachine::TransiteTo(Context &context, CooperateState state)
     }
 }
 
-void StateMachine::AddHandler(CooperateEventType event, std::function<void(Context&, const CooperateEvent&)> handler)
+void StateMachine::AddHandler(CooperateEventType event, CooperateEventTable<StateMachine, Context>::Handler handler)
 {
-    handlers_.emplace(event, handler);
+    handlers_.Register(event, handler);
 }
 
 void StateMachine::OnQuit(Context &context)
@@ -579,6 +499,20 @@ void StateMachine::OnSoftbusMouseLocation(Context &context, const CooperateEvent
     context.mouseLocation_.OnRemoteMouseLocation(notice);
 }
 
+void StateMachine::OnSoftbusMouseLocationStream(Context &context, const CooperateEvent &event)
+{
+    CALL_DEBUG_ENTER;
+    DSoftbusMouseLocationStream notice = std::get<DSoftbusMouseLocationStream>(event.event);
+    context.mouseLocation_.OnRemoteMouseLocationStream(notice);
+}
+
+void StateMachine::OnSoftbusInputEventSchema(Context &context, const CooperateEvent &event)
+{
+    CALL_DEBUG_ENTER;
+    DSoftbusInputEventSchema notice = std::get<DSoftbusInputEventSchema>(event.event);
+    context.inputEventInterceptor_.SetPeerSchema(notice.networkId, notice.schema);
+}
+
 void StateMachine::OnRemoteStart(Context &context, const CooperateEvent &event)
 {
     CALL_DEBUG_ENTER;
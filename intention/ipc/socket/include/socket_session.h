@@ -16,22 +16,33 @@
 #ifndef SOCKET_SESSION_H
 #define SOCKET_SESSION_H
 
+#include <atomic>
+#include <functional>
+
 #include "nocopyable.h"
 
 #include "i_epoll_event_source.h"
 #include "i_socket_session.h"
+#include "stream_send_queue.h"
 
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 class SocketSession final : public ISocketSession, public IEpollEventSource {
 public:
+    // Re-registers the session with the epoll instance that owns it, after GetEvents() changed.
+    using EpollUpdater = std::function<bool()>;
+
     SocketSession(const std::string &programName, int32_t moduleType,
                   int32_t tokenType, int32_t fd, int32_t uid, int32_t pid);
     DISALLOW_COPY_AND_MOVE(SocketSession);
     ~SocketSession();
 
     bool SendMsg(NetPacket &pkt) const override;
+    bool FlushPendingMsgs();
+    void AttachEpoll(EpollUpdater updater);
+    size_t GetSendQueueDepth() const;
+    uint64_t GetDroppedCount() const;
 
     int32_t GetUid() const override;
     int32_t GetPid() const override;
@@ -39,11 +50,13 @@ public:
     std::string GetProgramName() const override;
     void SetProgramName(const std::string &programName) override;
 
+    uint32_t GetEvents() const override;
     int32_t GetFd() const override;
     void Dispatch(const struct epoll_event &ev) override;
 
 private:
     bool SendMsg(const char *buf, size_t size) const;
+    void WatchWritable(bool enable);
 
 private:
     int32_t fd_ { -1 };
@@ -51,6 +64,9 @@ private:
     int32_t pid_ { -1 };
     int32_t tokenType_ { TokenType::TOKEN_INVALID };
     std::string programName_;
+    EpollUpdater epollUpdater_ { nullptr };
+    std::atomic<bool> watchingWritable_ { false };
+    mutable StreamSendQueue sendQueue_;
 };
 
 inline int32_t SocketSession::GetUid() const
@@ -68,6 +84,16 @@ inline int32_t SocketSession::GetFd() const
     return fd_;
 }
 
+inline size_t SocketSession::GetSendQueueDepth() const
+{
+    return sendQueue_.GetDepth();
+}
+
+inline uint64_t SocketSession::GetDroppedCount() const
+{
+    return sendQueue_.GetDroppedCount();
+}
+
 inline std::string SocketSession::GetProgramName() const
 {
     return programName_;
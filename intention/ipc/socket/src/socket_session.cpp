@@ -67,37 +67,42 @@ bool SocketSession::SendMsg(const char *buf, size_t size) const
         FI_HILOGE("The fd_ is less than 0");
         return false;
     }
+    return sendQueue_.Send(fd_, buf, size);
+}
 
-    int32_t idx = 0;
-    int32_t retryCount = 0;
-    const int32_t bufSize = static_cast<int32_t>(size);
-    int32_t remSize = bufSize;
-    FI_HILOGD("Rem size:%{public}d", remSize);
-    while (remSize > 0 && retryCount < SEND_RETRY_LIMIT) {
-        retryCount += 1;
-        FI_HILOGD("Send message to client (%{public}d, %{public}d)", fd_, pid_);
-        ssize_t count = send(fd_, &buf[idx], remSize, MSG_DONTWAIT | MSG_NOSIGNAL);
-        if (count < 0) {
-            if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
-                usleep(SEND_RETRY_SLEEP_TIME);
-                FI_HILOGW("Continue for errno EAGAIN|EINTR|EWOULDBLOCK, errno:%{public}d, pid:%{public}d", errno, pid_);
-                continue;
-            }
-            FI_HILOGE("Send return failed, error:%{public}d, fd:%{public}d, pid:%{public}d", errno, fd_, pid_);
-            return false;
-        }
-        idx += count;
-        remSize -= count;
-        if (remSize > 0) {
-            usleep(SEND_RETRY_SLEEP_TIME);
-        }
-    }
-    if (retryCount >= SEND_RETRY_LIMIT || remSize != 0) {
-        FI_HILOGE("Send too many times:%{public}d/%{public}d, size:%{public}d/%{public}d, fd:%{public}d,"
-            "pid:%{public}d", retryCount, SEND_RETRY_LIMIT, idx, bufSize, fd_, pid_);
+bool SocketSession::FlushPendingMsgs()
+{
+    if (fd_ < 0) {
         return false;
     }
-    return true;
+    return sendQueue_.Flush(fd_);
+}
+
+void SocketSession::AttachEpoll(EpollUpdater updater)
+{
+    epollUpdater_ = updater;
+    sendQueue_.SetWatcher([this](bool enable) {
+        WatchWritable(enable);
+    });
+}
+
+uint32_t SocketSession::GetEvents() const
+{
+    uint32_t events = IEpollEventSource::GetEvents();
+    return (watchingWritable_.load() ? (events | EPOLLOUT) : events);
+}
+
+void SocketSession::WatchWritable(bool enable)
+{
+    if ((epollUpdater_ == nullptr) || (fd_ < 0)) {
+        return;
+    }
+    // The owner of the registration re-adds it with GetEvents(), in whatever form
+    // of event data its loop dispatches on.
+    watchingWritable_.store(enable);
+    if (!epollUpdater_()) {
+        FI_HILOGE("Failed to update epoll events of session(%{public}d)", fd_);
+    }
 }
 
 std::string SocketSession::ToString() const
@@ -107,12 +112,17 @@ std::string SocketSession::ToString() const
         << ((fd_ < 0) ? ", closed" : ", opened")
         << ", pid = " << pid_
         << ", tokenType = " << tokenType_
+        << ", sendQueueDepth = " << sendQueue_.GetDepth()
+        << ", dropped = " << sendQueue_.GetDroppedCount()
         << std::endl;
     return oss.str();
 }
 
 void SocketSession::Dispatch(const struct epoll_event &ev)
 {
+    if (((ev.events & EPOLLOUT) == EPOLLOUT) && !FlushPendingMsgs()) {
+        FI_HILOGW("Failed to flush pending messages (%{public}d)", fd_);
+    }
     if ((ev.events & EPOLLIN) == EPOLLIN) {
         FI_HILOGD("Data received (%{public}d)", fd_);
     } else if ((ev.events & (EPOLLHUP | EPOLLERR)) != 0) {
@@ -170,6 +170,9 @@ void SocketSessionManager::DispatchOne()
     for (int32_t index = 0; index < cnt; ++index) {
         IEpollEventSource *source = reinterpret_cast<IEpollEventSource *>(evs[index].data.ptr);
         CHKPC(source);
+        if ((evs[index].events & EPOLLOUT) == EPOLLOUT) {
+            OnEpollOut(*source);
+        }
         if ((evs[index].events & EPOLLIN) == EPOLLIN) {
             OnEpollIn(*source);
         } else if ((evs[index].events & (EPOLLHUP | EPOLLERR)) != 0) {
@@ -208,6 +211,16 @@ void SocketSessionManager::OnEpollIn(IEpollEventSource &source)
     } while (numRead == sizeof(buf));
 }
 
+void SocketSessionManager::OnEpollOut(IEpollEventSource &source)
+{
+    CALL_DEBUG_ENTER;
+    auto session = FindSession(source.GetFd());
+    CHKPV(session);
+    if (!session->FlushPendingMsgs()) {
+        FI_HILOGE("Failed to flush pending messages of session(%{public}d)", source.GetFd());
+    }
+}
+
 void SocketSessionManager::ReleaseSession(int32_t fd)
 {
     CALL_DEBUG_ENTER;
@@ -311,6 +324,11 @@ bool SocketSessionManager::AddSession(std::shared_ptr<SocketSession> session)
         sessions_.erase(iter);
         return false;
     }
+    std::weak_ptr<SocketSession> weakSession = session;
+    session->AttachEpoll([this, weakSession] {
+        auto target = weakSession.lock();
+        return ((target != nullptr) && epollMgr_.Update(target));
+    });
     DumpSession("AddSession");
     return true;
 }
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "net_packet.h"
+#include "net_packet_view.h"
 #include "parcel.h"
 
 namespace OHOS {
@@ -33,10 +34,24 @@ public:
     virtual void OnBind(const std::string &networkId) = 0;
     virtual void OnShutdown(const std::string &networkId) = 0;
     virtual void OnConnected(const std::string &networkId) = 0;
-    virtual bool OnPacket(const std::string &networkId, NetPacket &packet) = 0;
+    virtual bool OnPacket(const std::string &networkId, NetPacketView &packet) = 0;
     virtual bool OnRawData(const std::string &networkId, const void *data, uint32_t dataLen) = 0;
 };
 
+struct DSoftbusLinkState {
+    // Whether anything was received from the peer recently.
+    bool alive { false };
+    // Milliseconds since anything was received from the peer, -1 if nothing has been.
+    int64_t idleMs { -1 };
+    // Smoothed heart beat round-trip time and its variation, -1 until the peer has
+    // answered a heart beat.
+    int32_t rttMs { -1 };
+    int32_t rttVarMs { -1 };
+    // Current heart beat interval, 0 if no heart beat is running.
+    int32_t heartBeatIntervalMs { 0 };
+    uint32_t nLostHeartBeats { 0 };
+};
+
 class IDSoftbusAdapter {
 public:
     IDSoftbusAdapter() = default;
@@ -54,6 +69,7 @@ public:
     virtual void CloseAllSessions() = 0;
     virtual void StartHeartBeat(const std::string &networkId) = 0;
     virtual void StopHeartBeat(const std::string &networkId) = 0;
+    virtual int32_t GetLinkState(const std::string &networkId, DSoftbusLinkState &state) = 0;
 
     virtual int32_t SendPacket(const std::string &networkId, NetPacket &packet) = 0;
     virtual int32_t SendParcel(const std::string &networkId, Parcel &parcel) = 0;
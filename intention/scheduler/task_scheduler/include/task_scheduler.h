@@ -16,63 +16,47 @@
 #ifndef TASK_SCHEDULER_H
 #define TASK_SCHEDULER_H
 
+#include <atomic>
 #include <cinttypes>
 #include <functional>
-#include <future>
-#include <memory>
-#include <mutex>
-#include <queue>
+
+#include "nocopyable.h"
 
 #include "i_task_scheduler.h"
-#include "id_factory.h"
 #include "include/util.h"
 
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
-class TaskScheduler final : public ITaskScheduler,
-                            public IdFactory<int32_t> {
+/**
+ * Runs posted tasks on a single worker thread.
+ *
+ * Tasks are linked into an intrusive lock-free MPSC queue. Posting signals the eventfd returned
+ * by GetReadFd() only when the worker has not been signaled since it last drained the queue, so
+ * a burst of posts costs one write. The worker calls ProcessTasks() when the fd is readable.
+ * PostSyncTask runs the callback inline when called on the worker thread; otherwise it waits on
+ * a task object cached per calling thread, so a sync call does not allocate.
+ */
+class TaskScheduler final : public ITaskScheduler {
 public:
-    struct TaskData {
-        uint64_t tid { 0 };
-        int32_t taskId { 0 };
-    };
-    class Task : public std::enable_shared_from_this<Task> {
+    class Task {
     public:
-        using Promise = std::promise<int32_t>;
-        using Future = std::future<int32_t>;
-        using TaskPtr = std::shared_ptr<TaskScheduler::Task>;
-        Task(int32_t id, DTaskCallback fun, Promise *promise = nullptr)
-            : id_(id), fun_(fun), promise_(promise) {}
-        ~Task() = default;
+        Task() = default;
+        virtual ~Task() = default;
+        DISALLOW_COPY_AND_MOVE(Task);
 
-        TaskPtr GetSharedPtr()
-        {
-            return shared_from_this();
-        }
-        int32_t GetId() const
-        {
-            return id_;
-        }
-        void SetWaited()
-        {
-            hasWaited_ = true;
-        }
-        void ProcessTask();
+        virtual void Run() = 0;
+        virtual void Discard() = 0;
 
     private:
-        int32_t id_ { 0 };
-        std::atomic_bool hasWaited_ { false };
-        DTaskCallback fun_ { nullptr };
-        Promise* promise_ { nullptr };
+        friend class TaskScheduler;
+        std::atomic<Task *> next_ { nullptr };
     };
-    using TaskPtr = Task::TaskPtr;
-    using Promise = Task::Promise;
-    using Future = Task::Future;
 
 public:
     TaskScheduler() = default;
     ~TaskScheduler();
+    DISALLOW_COPY_AND_MOVE(TaskScheduler);
 
     bool Init();
     void ProcessTasks();
@@ -81,26 +65,34 @@ public:
 
     int32_t GetReadFd() const
     {
-        return fds_[0];
+        return eventFd_;
     }
     void SetWorkerThreadId(uint64_t tid)
     {
         workerThreadId_ = tid;
     }
-    bool IsCallFromWorkerThread() const
-    {
-        return (GetThisThreadId() == workerThreadId_);
-    }
+    bool IsCallFromWorkerThread() const;
 
 private:
-    void PopPendingTaskList(std::vector<TaskPtr> &tasks);
-    TaskPtr PostTask(DTaskCallback callback, Promise *promise = nullptr);
+    class StubTask final : public Task {
+    public:
+        void Run() override {}
+        void Discard() override {}
+    };
+
+    bool PostTask(Task *task);
+    void Push(Task *task);
+    Task* Pop();
+    void Wakeup();
 
 private:
     uint64_t workerThreadId_ { 0 };
-    int32_t fds_[2] {};
-    std::mutex mux_;
-    std::queue<TaskPtr> tasks_;
+    int32_t eventFd_ { -1 };
+    std::atomic<size_t> pendingCount_ { 0 };
+    std::atomic_bool signaled_ { false };
+    StubTask stub_;
+    std::atomic<Task *> head_ { &stub_ };
+    Task *tail_ { &stub_ };
 };
 } // namespace DeviceStatus
 } // namespace Msdp
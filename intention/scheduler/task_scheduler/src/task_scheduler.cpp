@@ -15,8 +15,13 @@
 
 #include "task_scheduler.h"
 
-#include <fcntl.h>
-#include <sys/syscall.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+
+#include <sys/eventfd.h>
 #include <unistd.h>
 
 #include "devicestatus_define.h"
@@ -27,55 +32,188 @@
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
+namespace {
+constexpr size_t MAX_TASKS_LIMIT { 1000 };
+constexpr size_t ONCE_PROCESS_TASK_LIMIT { 64 };
+constexpr std::chrono::milliseconds SYNC_TASK_TIMEOUT { 3000 };
 
-void TaskScheduler::Task::ProcessTask()
+uint64_t CurrentThreadId()
 {
-    CALL_DEBUG_ENTER;
-    if (hasWaited_) {
-        FI_HILOGE("Expired tasks will be discarded, id:%{public}d", id_);
-        return;
+    thread_local uint64_t tid = GetThisThreadId();
+    return tid;
+}
+
+class AsyncTask final : public TaskScheduler::Task {
+public:
+    explicit AsyncTask(DTaskCallback callback) : callback_(std::move(callback)) {}
+    ~AsyncTask() = default;
+    DISALLOW_COPY_AND_MOVE(AsyncTask);
+
+    void Run() override
+    {
+        int32_t ret = callback_();
+        FI_HILOGD("Process async task, ret:%{public}d", ret);
+        delete this;
     }
-    int32_t ret = fun_();
-    std::string taskType = ((promise_ == nullptr) ? "Async" : "Sync");
-    FI_HILOGD("process:%{public}s, task id:%{public}d, ret:%{public}d", taskType.c_str(), id_, ret);
-    if (!hasWaited_ && promise_ != nullptr) {
-        promise_->set_value(ret);
+
+    void Discard() override
+    {
+        delete this;
     }
-}
+
+private:
+    DTaskCallback callback_;
+};
+
+/*
+ * A sync task takes over the callback of the waiting caller. It is cached per calling thread and
+ * reused by the next call, unless the caller gives up waiting; the task then belongs to the
+ * scheduler, which deletes it instead of running it, or once it has run if it was already running.
+ */
+class SyncTask final : public TaskScheduler::Task {
+public:
+    SyncTask() = default;
+    ~SyncTask() = default;
+    DISALLOW_COPY_AND_MOVE(SyncTask);
+
+    void Prepare(DTaskCallback callback)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        callback_ = std::move(callback);
+        state_ = State::PENDING;
+        result_ = RET_ERR;
+    }
+
+    void Run() override
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (state_ == State::CANCELLED) {
+                FI_HILOGE("Expired tasks will be discarded");
+                callback_ = nullptr;
+            } else {
+                state_ = State::RUNNING;
+            }
+        }
+        if (callback_ == nullptr) {
+            delete this;
+            return;
+        }
+        int32_t ret = callback_();
+        callback_ = nullptr;
+        Complete(ret);
+    }
+
+    void Discard() override
+    {
+        bool cancelled = false;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            cancelled = (state_ == State::CANCELLED);
+        }
+        if (cancelled) {
+            delete this;
+        } else {
+            Complete(ETASKS_POST_SYNCTASK_FAIL);
+        }
+    }
+
+    // Returns false if the caller gave up waiting; the task must not be touched afterwards.
+    bool Wait(int32_t &result)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto isDone = [this] {
+            return (state_ == State::DONE);
+        };
+        if (!cond_.wait_for(lock, SYNC_TASK_TIMEOUT, isDone)) {
+            // Whether or not it has started, the task is left to the scheduler.
+            state_ = State::CANCELLED;
+            return false;
+        }
+        result = result_;
+        return true;
+    }
+
+private:
+    enum class State {
+        PENDING,
+        RUNNING,
+        DONE,
+        CANCELLED,
+    };
+
+    void Complete(int32_t result)
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (state_ != State::CANCELLED) {
+                result_ = result;
+                state_ = State::DONE;
+                cond_.notify_one();
+                return;
+            }
+        }
+        FI_HILOGW("Task completed after the caller timed out, ret:%{public}d", result);
+        delete this;
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    State state_ { State::DONE };
+    int32_t result_ { RET_ERR };
+    DTaskCallback callback_ { nullptr };
+};
+} // namespace
 
 TaskScheduler::~TaskScheduler()
 {
-    if (fds_[0] >= 0) {
-        if (close(fds_[0]) < 0) {
-            FI_HILOGE("Close fds_[0] failed, err:%{public}s, fds_[0]:%{public}d", strerror(errno), fds_[0]);
-        }
-        fds_[0] = -1;
+    for (Task *task = Pop(); task != nullptr; task = Pop()) {
+        task->Discard();
     }
-    if (fds_[1] >= 0) {
-        if (close(fds_[1]) < 0) {
-            FI_HILOGE("Close fds_[1] failed, err:%{public}s, fds_[1]:%{public}d", strerror(errno), fds_[1]);
+    if (eventFd_ >= 0) {
+        if (close(eventFd_) < 0) {
+            FI_HILOGE("Close eventFd_ failed, err:%{public}s, eventFd_:%{public}d", strerror(errno), eventFd_);
         }
-        fds_[1] = -1;
+        eventFd_ = -1;
     }
 }
 
 bool TaskScheduler::Init()
 {
     CALL_DEBUG_ENTER;
-    if (::pipe2(fds_, O_CLOEXEC | O_NONBLOCK) != 0) {
-        FI_HILOGE("pipe2 failed, errno:%{public}s", ::strerror(errno));
+    eventFd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (eventFd_ < 0) {
+        FI_HILOGE("eventfd failed, errno:%{public}s", ::strerror(errno));
         return false;
     }
     return true;
 }
 
+bool TaskScheduler::IsCallFromWorkerThread() const
+{
+    return (CurrentThreadId() == workerThreadId_);
+}
+
 void TaskScheduler::ProcessTasks()
 {
     CALL_DEBUG_ENTER;
-    std::vector<TaskPtr> tasks;
-    PopPendingTaskList(tasks);
-    for (const auto &it : tasks) {
-        it->ProcessTask();
+    eventfd_t value = 0;
+    if ((::eventfd_read(eventFd_, &value) != 0) && (errno != EAGAIN)) {
+        FI_HILOGE("eventfd_read failed, errno:%{public}s", ::strerror(errno));
+    }
+    // Clearing the flag before draining makes any post that races with the drain signal again.
+    signaled_.exchange(false, std::memory_order_acq_rel);
+
+    for (size_t count = 0; count < ONCE_PROCESS_TASK_LIMIT; ++count) {
+        Task *task = Pop();
+        if (task == nullptr) {
+            return;
+        }
+        pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+        task->Run();
+    }
+    if (pendingCount_.load(std::memory_order_relaxed) > 0) {
+        Wakeup();
     }
 }
 
@@ -86,72 +224,96 @@ int32_t TaskScheduler::PostSyncTask(DTaskCallback cb)
     if (IsCallFromWorkerThread()) {
         return cb();
     }
-    Promise promise;
-    Future future = promise.get_future();
-    auto task = PostTask(cb, &promise);
-    CHKPR(task, ETASKS_POST_SYNCTASK_FAIL);
-
-    static constexpr int32_t timeout = 3000;
-    std::chrono::milliseconds span(timeout);
-    auto res = future.wait_for(span);
-    task->SetWaited();
-    if (res == std::future_status::timeout) {
+    thread_local std::unique_ptr<SyncTask> cachedTask;
+    if (cachedTask == nullptr) {
+        cachedTask = std::make_unique<SyncTask>();
+    }
+    cachedTask->Prepare(std::move(cb));
+    if (!PostTask(cachedTask.get())) {
+        return ETASKS_POST_SYNCTASK_FAIL;
+    }
+    int32_t result = RET_ERR;
+    if (!cachedTask->Wait(result)) {
         FI_HILOGE("Task timeout");
+        static_cast<void>(cachedTask.release());
         return ETASKS_WAIT_TIMEOUT;
-    } else if (res == std::future_status::deferred) {
-        FI_HILOGE("Task deferred");
-        return ETASKS_WAIT_DEFERRED;
     }
-    return future.get();
+    return result;
 }
 
 int32_t TaskScheduler::PostAsyncTask(DTaskCallback callback)
 {
     CHKPR(callback, ERROR_NULL_POINTER);
-    auto task = PostTask(callback);
+    auto task = new (std::nothrow) AsyncTask(std::move(callback));
     CHKPR(task, ETASKS_POST_ASYNCTASK_FAIL);
+    if (!PostTask(task)) {
+        delete task;
+        return ETASKS_POST_ASYNCTASK_FAIL;
+    }
     return RET_OK;
 }
 
-void TaskScheduler::PopPendingTaskList(std::vector<TaskPtr> &tasks)
+bool TaskScheduler::PostTask(Task *task)
 {
-    static constexpr int32_t onceProcessTaskLimit = 10;
-    std::lock_guard<std::mutex> guard(mux_);
-    for (int32_t i = 0; i < onceProcessTaskLimit; i++) {
-        if (tasks_.empty()) {
-            break;
-        }
-        auto firstTask = tasks_.front();
-        CHKPB(firstTask);
-        RecoveryId(firstTask->GetId());
-        tasks.push_back(firstTask->GetSharedPtr());
-        tasks_.pop();
+    if (eventFd_ < 0) {
+        FI_HILOGE("TaskScheduler is not initialized");
+        return false;
     }
+    size_t count = pendingCount_.fetch_add(1, std::memory_order_relaxed);
+    if (count >= MAX_TASKS_LIMIT) {
+        pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+        FI_HILOGE("The task queue is full, size:%{public}zu/%{public}zu", count, MAX_TASKS_LIMIT);
+        return false;
+    }
+    Push(task);
+    if (!signaled_.exchange(true, std::memory_order_acq_rel)) {
+        Wakeup();
+    }
+    return true;
 }
 
-TaskScheduler::TaskPtr TaskScheduler::PostTask(DTaskCallback callback, Promise *promise)
+void TaskScheduler::Push(Task *task)
 {
-    FI_HILOGD("tasks_ size:%{public}zu", tasks_.size());
-    static constexpr int32_t maxTasksLimit = 1000;
-    std::lock_guard<std::mutex> guard(mux_);
-    size_t tsize = tasks_.size();
-    if (tsize > maxTasksLimit) {
-        FI_HILOGE("The task queue is full, size:%{public}zu/%{public}d", tsize, maxTasksLimit);
-        return nullptr;
+    task->next_.store(nullptr, std::memory_order_relaxed);
+    Task *prev = head_.exchange(task, std::memory_order_acq_rel);
+    prev->next_.store(task, std::memory_order_release);
+}
+
+TaskScheduler::Task* TaskScheduler::Pop()
+{
+    Task *tail = tail_;
+    Task *next = tail->next_.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+        if (next == nullptr) {
+            return nullptr;
+        }
+        tail_ = next;
+        tail = next;
+        next = next->next_.load(std::memory_order_acquire);
+    }
+    if (next != nullptr) {
+        tail_ = next;
+        return tail;
     }
-    int32_t id = GenerateId();
-    TaskData data = { GetThisThreadId(), id };
-    ssize_t res = write(fds_[1], &data, sizeof(data));
-    if (res == -1) {
-        RecoveryId(id);
-        FI_HILOGE("Pipeline writes failed, errno:%{public}d", errno);
+    if (tail != head_.load(std::memory_order_acquire)) {
+        // A producer is between swapping the head and linking its task; it signals again after.
         return nullptr;
     }
-    TaskPtr task = std::make_shared<Task>(id, callback, promise);
-    tasks_.push(task);
-    std::string taskType = ((promise == nullptr) ? "Async" : "Sync");
-    FI_HILOGD("Post %{public}s", taskType.c_str());
-    return task->GetSharedPtr();
+    Push(&stub_);
+    next = tail->next_.load(std::memory_order_acquire);
+    if (next != nullptr) {
+        tail_ = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+void TaskScheduler::Wakeup()
+{
+    signaled_.store(true, std::memory_order_release);
+    if (::eventfd_write(eventFd_, 1) != 0) {
+        FI_HILOGE("eventfd_write failed, errno:%{public}s", ::strerror(errno));
+    }
 }
 } // namespace DeviceStatus
 } // namespace Msdp
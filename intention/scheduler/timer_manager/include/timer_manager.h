@@ -18,12 +18,11 @@
 
 #include <future>
 #include <functional>
-#include <list>
-#include <memory>
 
 #include "nocopyable.h"
 
 #include "i_context.h"
+#include "timer_wheel.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -45,15 +44,6 @@ public:
     int32_t GetTimerFd() const;
 
 private:
-    struct TimerItem {
-        int32_t id { 0 };
-        int32_t intervalMs { 0 };
-        int32_t callbackCount { 0 };
-        int32_t repeatCount { 0 };
-        int64_t nextCallTime { 0 };
-        std::function<void()> callback { nullptr };
-    };
-
     int32_t OnInit(IContext *context);
     int32_t OnAddTimer(int32_t intervalMs, int32_t repeatCount, std::function<void()> callback);
     int32_t OnProcessTimers();
@@ -61,18 +51,14 @@ private:
     int32_t OnRemoveTimer(int32_t timerId);
     bool OnIsExist(int32_t timerId) const;
     int32_t RunIsExist(std::packaged_task<bool(int32_t)> &task, int32_t timerId) const;
-    int32_t TakeNextTimerId();
     int32_t AddTimerInternal(int32_t intervalMs, int32_t repeatCount, std::function<void()> callback);
-    int32_t ResetTimerInternal(int32_t timerId);
-    int32_t RemoveTimerInternal(int32_t timerId);
-    void InsertTimerInternal(std::unique_ptr<TimerItem> &timer);
-    void ProcessTimersInternal();
     int64_t CalcNextDelayInternal();
     int32_t ArmTimer();
 
     int32_t timerFd_ { -1 };
+    int64_t armedTime_ { -1 };
     IContext *context_ { nullptr };
-    std::list<std::unique_ptr<TimerItem>> timers_;
+    TimerWheel timerWheel_;
 };
 
 inline int32_t TimerManager::GetTimerFd() const
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+/**
+ * Hierarchical timer wheel with millisecond ticks.
+ *
+ * Four levels of 64 slots cover about 4.6 hours. A timer is linked into the slot of the level
+ * that matches its distance from the wheel clock and moves down a level whenever the clock
+ * reaches the start of its slot, so add, remove and reset are O(1). Empty ticks are skipped
+ * with per-level occupancy bitmaps, and all timers due on the same tick run in one pass.
+ * Timer ids stay valid until the timer is removed or has fired for the last time.
+ */
+class TimerWheel final {
+public:
+    TimerWheel() = default;
+    ~TimerWheel() = default;
+    DISALLOW_COPY_AND_MOVE(TimerWheel);
+
+    int32_t AddTimer(int64_t nowTime, int32_t intervalMs, int32_t repeatCount, std::function<void()> callback);
+    int32_t RemoveTimer(int32_t timerId);
+    int32_t ResetTimer(int64_t nowTime, int32_t timerId);
+    bool IsExist(int32_t timerId) const;
+    size_t GetTimerCount() const;
+    void ProcessTimers(int64_t nowTime);
+    int64_t GetNextExpireTime() const;
+
+private:
+    struct Link {
+        Link *prev { this };
+        Link *next { this };
+    };
+
+    struct TimerNode : public Link {
+        uint32_t index { 0 };
+        uint32_t generation { 0 };
+        bool active { false };
+        uint8_t level { 0 };
+        uint8_t slot { 0 };
+        int32_t intervalMs { 0 };
+        int32_t repeatCount { 0 };
+        int32_t callbackCount { 0 };
+        int64_t expireTime { 0 };
+        std::function<void()> callback { nullptr };
+    };
+
+    static constexpr size_t WHEEL_BITS { 6 };
+    static constexpr size_t WHEEL_SIZE { size_t(1U) << WHEEL_BITS };
+    static constexpr size_t N_LEVELS { 4 };
+    static constexpr uint8_t DUE_LEVEL { N_LEVELS };
+
+    static int32_t GetTimerId(const TimerNode &node);
+    TimerNode* FindTimer(int32_t timerId);
+    const TimerNode* FindTimer(int32_t timerId) const;
+    TimerNode* AllocTimer();
+    void FreeTimer(TimerNode &node);
+    void Place(TimerNode &node);
+    void Unlink(TimerNode &node);
+    void Cascade(size_t level);
+    void RunDueTimers();
+    int64_t NextEventTime() const;
+
+    int64_t current_ { 0 };
+    size_t count_ { 0 };
+    std::deque<TimerNode> nodes_;
+    std::vector<uint32_t> freeNodes_;
+    std::array<uint64_t, N_LEVELS> bitmaps_ {};
+    std::array<std::array<Link, WHEEL_SIZE>, N_LEVELS> slots_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // TIMER_WHEEL_H
@@ -15,8 +15,6 @@
 
 #include "timer_manager.h"
 
-#include <numeric>
-
 #include <sys/timerfd.h>
 
 #include "devicestatus_define.h"
@@ -35,7 +33,6 @@ constexpr int32_t NONEXISTENT_ID { -1 };
 constexpr int32_t MIN_INTERVAL { 50 };
 constexpr int32_t TIME_CONVERSION { 1000 };
 constexpr int32_t MAX_INTERVAL_MS { 600000 };
-constexpr size_t MAX_TIMER_COUNT { 64 };
 } // namespace
 
 int32_t TimerManager::OnInit(IContext *context)
@@ -86,7 +83,7 @@ int32_t TimerManager::AddTimerAsync(int32_t intervalMs, int32_t repeatCount, std
 
 int32_t TimerManager::OnRemoveTimer(int32_t timerId)
 {
-    int32_t ret = RemoveTimerInternal(timerId);
+    int32_t ret = timerWheel_.RemoveTimer(timerId);
     if (ret == RET_OK) {
         ArmTimer();
     }
@@ -113,7 +110,7 @@ int32_t TimerManager::RemoveTimerAsync(int32_t timerId)
 
 int32_t TimerManager::OnResetTimer(int32_t timerId)
 {
-    int32_t ret = ResetTimerInternal(timerId);
+    int32_t ret = timerWheel_.ResetTimer(GetMillisTime(), timerId);
     ArmTimer();
     return ret;
 }
@@ -129,12 +126,7 @@ int32_t TimerManager::ResetTimer(int32_t timerId)
 
 bool TimerManager::OnIsExist(int32_t timerId) const
 {
-    for (auto iter = timers_.begin(); iter != timers_.end(); ++iter) {
-        if ((*iter)->id == timerId) {
-            return true;
-        }
-    }
-    return false;
+    return timerWheel_.IsExist(timerId);
 }
 
 bool TimerManager::IsExist(int32_t timerId) const
@@ -157,7 +149,8 @@ bool TimerManager::IsExist(int32_t timerId) const
 
 int32_t TimerManager::OnProcessTimers()
 {
-    ProcessTimersInternal();
+    armedTime_ = -1;
+    timerWheel_.ProcessTimers(GetMillisTime());
     ArmTimer();
     return RET_OK;
 }
@@ -177,20 +170,6 @@ int32_t TimerManager::RunIsExist(std::packaged_task<bool(int32_t)> &task, int32_
     return RET_OK;
 }
 
-int32_t TimerManager::TakeNextTimerId()
-{
-    uint64_t timerSlot = std::accumulate(timers_.cbegin(), timers_.cend(), uint64_t(0U),
-        [] (uint64_t s, const auto &timer) {
-            return (s |= (uint64_t(1U) << timer->id));
-        });
-    for (size_t tmpCount = 0; tmpCount < MAX_TIMER_COUNT; ++tmpCount) {
-        if ((timerSlot & (uint64_t(1U) << tmpCount)) == 0) {
-            return tmpCount;
-        }
-    }
-    return NONEXISTENT_ID;
-}
-
 int32_t TimerManager::AddTimerInternal(int32_t intervalMs, int32_t repeatCount, std::function<void()> callback)
 {
     CALL_DEBUG_ENTER;
@@ -202,112 +181,20 @@ int32_t TimerManager::AddTimerInternal(int32_t intervalMs, int32_t repeatCount,
     if (!callback) {
         return NONEXISTENT_ID;
     }
-    int32_t nextTimerId = TakeNextTimerId();
-    if (nextTimerId < 0) {
-        return NONEXISTENT_ID;
-    }
-    auto timer = std::make_unique<TimerItem>();
-    timer->id = nextTimerId;
-    timer->repeatCount = repeatCount;
-    timer->intervalMs = intervalMs;
-    timer->callbackCount = 0;
-    int64_t nowTime = GetMillisTime();
-    if (!AddInt64(nowTime, timer->intervalMs, timer->nextCallTime)) {
-        FI_HILOGE("The addition of nextCallTime in TimerItem overflows");
-        return NONEXISTENT_ID;
-    }
-    timer->callback = callback;
-    InsertTimerInternal(timer);
-    return nextTimerId;
-}
-
-int32_t TimerManager::RemoveTimerInternal(int32_t timerId)
-{
-    for (auto iter = timers_.begin(); iter != timers_.end(); ++iter) {
-        if ((*iter)->id == timerId) {
-            timers_.erase(iter);
-            return RET_OK;
-        }
-    }
-    return RET_ERR;
-}
-
-int32_t TimerManager::ResetTimerInternal(int32_t timerId)
-{
-    for (auto iter = timers_.begin(); iter!= timers_.end(); ++iter) {
-        if ((*iter)->id == timerId) {
-            auto timer = std::move(*iter);
-            timers_.erase(iter);
-            int64_t nowTime = GetMillisTime();
-            if (!AddInt64(nowTime, timer->intervalMs, timer->nextCallTime)) {
-                FI_HILOGE("The addition of nextCallTime in TimerItem overflows");
-                return RET_ERR;
-            }
-            timer->callbackCount = 0;
-            InsertTimerInternal(timer);
-            return RET_OK;
-        }
-    }
-    return RET_ERR;
-}
-
-void TimerManager::InsertTimerInternal(std::unique_ptr<TimerItem> &timer)
-{
-    for (auto iter = timers_.begin(); iter != timers_.end(); ++iter) {
-        if ((*iter)->nextCallTime > timer->nextCallTime) {
-            timers_.insert(iter, std::move(timer));
-            return;
-        }
-    }
-    timers_.push_back(std::move(timer));
+    return timerWheel_.AddTimer(GetMillisTime(), intervalMs, repeatCount, callback);
 }
 
 int64_t TimerManager::CalcNextDelayInternal()
 {
     int64_t delayTime = MIN_DELAY;
-    if (!timers_.empty()) {
+    int64_t nextTime = timerWheel_.GetNextExpireTime();
+    if (nextTime >= 0) {
         int64_t nowTime = GetMillisTime();
-        const auto &items = *timers_.begin();
-        if (nowTime >= items->nextCallTime) {
-            delayTime = 0;
-        } else {
-            delayTime = items->nextCallTime - nowTime;
-        }
+        delayTime = ((nowTime >= nextTime) ? 0 : (nextTime - nowTime));
     }
     return delayTime;
 }
 
-void TimerManager::ProcessTimersInternal()
-{
-    if (timers_.empty()) {
-        return;
-    }
-    int64_t presentTime = GetMillisTime();
-    for (;;) {
-        auto tIter = timers_.begin();
-        if (tIter == timers_.end()) {
-            break;
-        }
-        if ((*tIter)->nextCallTime > presentTime) {
-            break;
-        }
-        auto currentTimer = std::move(*tIter);
-        timers_.erase(tIter);
-        ++currentTimer->callbackCount;
-        if ((currentTimer->repeatCount >= 1) && (currentTimer->callbackCount >= currentTimer->repeatCount)) {
-            currentTimer->callback();
-            continue;
-        }
-        if (!AddInt64(currentTimer->nextCallTime, currentTimer->intervalMs, currentTimer->nextCallTime)) {
-            FI_HILOGE("The addition of nextCallTime in TimerItem overflows");
-            return;
-        }
-        auto callback = currentTimer->callback;
-        InsertTimerInternal(currentTimer);
-        callback();
-    }
-}
-
 int32_t TimerManager::ArmTimer()
 {
     CALL_DEBUG_ENTER;
@@ -315,6 +202,10 @@ int32_t TimerManager::ArmTimer()
         FI_HILOGE("TimerManager is not initialized");
         return RET_ERR;
     }
+    int64_t nextTime = timerWheel_.GetNextExpireTime();
+    if (nextTime == armedTime_) {
+        return RET_OK;
+    }
     struct itimerspec tspec {};
     int64_t expire = CalcNextDelayInternal();
     FI_HILOGD("The next expire %{public}" PRId64, expire);
@@ -329,8 +220,10 @@ int32_t TimerManager::ArmTimer()
 
     if (timerfd_settime(timerFd_, 0, &tspec, NULL) != 0) {
         FI_HILOGE("Timer: the timerfd_settime is error");
+        armedTime_ = -1;
         return RET_ERR;
     }
+    armedTime_ = nextTime;
     return RET_OK;
 }
 } // namespace DeviceStatus
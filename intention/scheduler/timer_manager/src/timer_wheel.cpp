@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timer_wheel.h"
+
+#include <algorithm>
+
+#include "devicestatus_define.h"
+#include "include/util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "TimerWheel"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int32_t NONEXISTENT_ID { -1 };
+constexpr uint32_t INDEX_BITS { 16 };
+constexpr uint32_t INDEX_MASK { (uint32_t(1U) << INDEX_BITS) - 1 };
+constexpr uint32_t GENERATION_MASK { 0x7FFF };
+constexpr size_t MAX_TIMER_COUNT { size_t(INDEX_MASK) + 1 };
+constexpr uint32_t BITMAP_BITS { 64 };
+
+inline uint64_t RotateRight(uint64_t value, uint32_t shift)
+{
+    shift %= BITMAP_BITS;
+    return ((shift == 0) ? value : ((value >> shift) | (value << (BITMAP_BITS - shift))));
+}
+} // namespace
+
+int32_t TimerWheel::AddTimer(int64_t nowTime, int32_t intervalMs, int32_t repeatCount,
+    std::function<void()> callback)
+{
+    if (!callback) {
+        return NONEXISTENT_ID;
+    }
+    int64_t expireTime = 0;
+    if (!AddInt64(nowTime, intervalMs, expireTime)) {
+        FI_HILOGE("The addition of expireTime overflows");
+        return NONEXISTENT_ID;
+    }
+    if (count_ == 0) {
+        current_ = std::max(current_, nowTime);
+    }
+    TimerNode *node = AllocTimer();
+    if (node == nullptr) {
+        FI_HILOGE("The number of timers exceeds limit(%{public}zu)", MAX_TIMER_COUNT);
+        return NONEXISTENT_ID;
+    }
+    node->intervalMs = intervalMs;
+    node->repeatCount = repeatCount;
+    node->callbackCount = 0;
+    node->expireTime = std::max(expireTime, current_ + 1);
+    node->callback = std::move(callback);
+    Place(*node);
+    return GetTimerId(*node);
+}
+
+int32_t TimerWheel::RemoveTimer(int32_t timerId)
+{
+    TimerNode *node = FindTimer(timerId);
+    if (node == nullptr) {
+        return RET_ERR;
+    }
+    Unlink(*node);
+    FreeTimer(*node);
+    return RET_OK;
+}
+
+int32_t TimerWheel::ResetTimer(int64_t nowTime, int32_t timerId)
+{
+    TimerNode *node = FindTimer(timerId);
+    if (node == nullptr) {
+        return RET_ERR;
+    }
+    int64_t expireTime = 0;
+    if (!AddInt64(nowTime, node->intervalMs, expireTime)) {
+        FI_HILOGE("The addition of expireTime overflows");
+        return RET_ERR;
+    }
+    Unlink(*node);
+    node->callbackCount = 0;
+    node->expireTime = std::max(expireTime, current_ + 1);
+    Place(*node);
+    return RET_OK;
+}
+
+bool TimerWheel::IsExist(int32_t timerId) const
+{
+    return (FindTimer(timerId) != nullptr);
+}
+
+size_t TimerWheel::GetTimerCount() const
+{
+    return count_;
+}
+
+void TimerWheel::ProcessTimers(int64_t nowTime)
+{
+    for (;;) {
+        int64_t nextTime = NextEventTime();
+        if ((nextTime < 0) || (nextTime > nowTime)) {
+            break;
+        }
+        current_ = nextTime;
+        for (size_t level = N_LEVELS - 1; level > 0; --level) {
+            uint64_t levelMask = (uint64_t(1U) << (WHEEL_BITS * level)) - 1;
+            if ((static_cast<uint64_t>(current_) & levelMask) == 0) {
+                Cascade(level);
+            }
+        }
+        RunDueTimers();
+    }
+    current_ = std::max(current_, nowTime);
+}
+
+int64_t TimerWheel::GetNextExpireTime() const
+{
+    return NextEventTime();
+}
+
+int32_t TimerWheel::GetTimerId(const TimerNode &node)
+{
+    return static_cast<int32_t>((node.generation << INDEX_BITS) | node.index);
+}
+
+TimerWheel::TimerNode* TimerWheel::FindTimer(int32_t timerId)
+{
+    return const_cast<TimerNode *>(static_cast<const TimerWheel *>(this)->FindTimer(timerId));
+}
+
+const TimerWheel::TimerNode* TimerWheel::FindTimer(int32_t timerId) const
+{
+    if (timerId < 0) {
+        return nullptr;
+    }
+    uint32_t index = static_cast<uint32_t>(timerId) & INDEX_MASK;
+    uint32_t generation = static_cast<uint32_t>(timerId) >> INDEX_BITS;
+    if (index >= nodes_.size()) {
+        return nullptr;
+    }
+    const TimerNode &node = nodes_[index];
+    return ((node.active && (node.generation == generation)) ? &node : nullptr);
+}
+
+TimerWheel::TimerNode* TimerWheel::AllocTimer()
+{
+    TimerNode *node = nullptr;
+    if (!freeNodes_.empty()) {
+        node = &nodes_[freeNodes_.back()];
+        freeNodes_.pop_back();
+    } else if (nodes_.size() < MAX_TIMER_COUNT) {
+        node = &nodes_.emplace_back();
+        node->index = static_cast<uint32_t>(nodes_.size() - 1);
+    } else {
+        return nullptr;
+    }
+    node->active = true;
+    ++count_;
+    return node;
+}
+
+void TimerWheel::FreeTimer(TimerNode &node)
+{
+    node.active = false;
+    node.generation = (node.generation + 1) & GENERATION_MASK;
+    node.callback = nullptr;
+    freeNodes_.push_back(node.index);
+    --count_;
+}
+
+void TimerWheel::Place(TimerNode &node)
+{
+    int64_t expireTime = node.expireTime;
+    int64_t delta = expireTime - current_;
+    size_t level = 0;
+    while ((level + 1 < N_LEVELS) && (delta >= (int64_t(1) << (WHEEL_BITS * (level + 1))))) {
+        ++level;
+    }
+    int64_t range = (int64_t(1) << (WHEEL_BITS * N_LEVELS)) - 1;
+    if (delta > range) {
+        // Parked in the farthest slot, it is placed again once the wheel gets there.
+        expireTime = current_ + range;
+    }
+    size_t slot = (static_cast<uint64_t>(expireTime) >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1);
+    Link &head = slots_[level][slot];
+    node.level = static_cast<uint8_t>(level);
+    node.slot = static_cast<uint8_t>(slot);
+    node.prev = head.prev;
+    node.next = &head;
+    head.prev->next = &node;
+    head.prev = &node;
+    bitmaps_[level] |= (uint64_t(1U) << slot);
+}
+
+void TimerWheel::Unlink(TimerNode &node)
+{
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = &node;
+    node.next = &node;
+    if (node.level < N_LEVELS) {
+        Link &head = slots_[node.level][node.slot];
+        if (head.next == &head) {
+            bitmaps_[node.level] &= ~(uint64_t(1U) << node.slot);
+        }
+    }
+}
+
+void TimerWheel::Cascade(size_t level)
+{
+    size_t slot = (static_cast<uint64_t>(current_) >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1);
+    if ((bitmaps_[level] & (uint64_t(1U) << slot)) == 0) {
+        return;
+    }
+    Link &head = slots_[level][slot];
+    while (head.next != &head) {
+        TimerNode &node = static_cast<TimerNode &>(*head.next);
+        Unlink(node);
+        Place(node);
+    }
+}
+
+void TimerWheel::RunDueTimers()
+{
+    size_t slot = static_cast<uint64_t>(current_) & (WHEEL_SIZE - 1);
+    Link &head = slots_[0][slot];
+    if (head.next == &head) {
+        return;
+    }
+    Link due;
+    due.next = head.next;
+    due.prev = head.prev;
+    due.next->prev = &due;
+    due.prev->next = &due;
+    head.next = &head;
+    head.prev = &head;
+    bitmaps_[0] &= ~(uint64_t(1U) << slot);
+    for (Link *link = due.next; link != &due; link = link->next) {
+        static_cast<TimerNode *>(link)->level = DUE_LEVEL;
+    }
+
+    while (due.next != &due) {
+        TimerNode &node = static_cast<TimerNode &>(*due.next);
+        Unlink(node);
+        ++node.callbackCount;
+        if ((node.repeatCount >= 1) && (node.callbackCount >= node.repeatCount)) {
+            auto callback = std::move(node.callback);
+            FreeTimer(node);
+            callback();
+            continue;
+        }
+        int64_t expireTime = 0;
+        if (!AddInt64(node.expireTime, node.intervalMs, expireTime)) {
+            FI_HILOGE("The addition of expireTime overflows");
+            FreeTimer(node);
+            continue;
+        }
+        node.expireTime = std::max(expireTime, current_ + 1);
+        Place(node);
+        auto callback = node.callback;
+        callback();
+    }
+}
+
+int64_t TimerWheel::NextEventTime() const
+{
+    int64_t nextTime = -1;
+    for (size_t level = 0; level < N_LEVELS; ++level) {
+        if (bitmaps_[level] == 0) {
+            continue;
+        }
+        size_t shift = WHEEL_BITS * level;
+        uint64_t position = static_cast<uint64_t>(current_) >> shift;
+        uint64_t pending = RotateRight(bitmaps_[level], static_cast<uint32_t>((position + 1) & (WHEEL_SIZE - 1)));
+        uint64_t distance = static_cast<uint64_t>(__builtin_ctzll(pending)) + 1;
+        int64_t eventTime = static_cast<int64_t>((position + distance) << shift);
+        if ((nextTime < 0) || (eventTime < nextTime)) {
+            nextTime = eventTime;
+        }
+    }
+    return nextTime;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POSTURE_CACHE_H
+#define POSTURE_CACHE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Keeps the rotation-vector sensor running while posture is being queried and
+// caches its latest quaternion. Readers of a fresh sample take no lock; the
+// sensor is started on demand and stopped once nobody has asked for posture
+// for an idle grace period.
+class PostureCache final {
+public:
+    struct Sample {
+        float x { 0.0F };
+        float y { 0.0F };
+        float z { 0.0F };
+        float w { 0.0F };
+    };
+
+    struct Options {
+        int64_t staleNs { 0 };
+        int32_t idleGraceMs { 0 };
+    };
+
+    using StartSensor = std::function<int32_t()>;
+    using StopSensor = std::function<void()>;
+
+    PostureCache(StartSensor startSensor, StopSensor stopSensor, const Options &options);
+    ~PostureCache();
+    DISALLOW_COPY_AND_MOVE(PostureCache);
+
+    // Holds the sensor on until the matching Release().
+    int32_t Acquire();
+    void Release();
+
+    // Returns the latest sample if it is no older than the staleness bound,
+    // otherwise waits up to @timeoutMs for the sensor to report one.
+    int32_t GetLatest(Sample &sample, int32_t timeoutMs);
+    // Called on the sensor thread for every report.
+    void Update(const Sample &sample);
+
+    bool IsActive() const;
+
+private:
+    bool ReadSample(Sample &sample, int64_t &sampleTime) const;
+    void RunIdleMonitor();
+    // Returns true once the sensor is off and the idle monitor may exit.
+    bool StopIdleSensor(std::unique_lock<std::mutex> &lock);
+    static int64_t Now();
+
+private:
+    StartSensor startSensor_;
+    StopSensor stopSensor_;
+    const Options options_;
+
+    // Sequence lock over the sample fields: odd while a write is in progress.
+    std::atomic<uint32_t> seq_ { 0 };
+    std::atomic<float> x_ { 0.0F };
+    std::atomic<float> y_ { 0.0F };
+    std::atomic<float> z_ { 0.0F };
+    std::atomic<float> w_ { 0.0F };
+    std::atomic<int64_t> sampleTime_ { 0 };
+
+    std::atomic<bool> active_ { false };
+    std::atomic<int64_t> lastUse_ { 0 };
+    std::atomic<int32_t> nWaiters_ { 0 };
+    std::mutex mutex_;
+    std::condition_variable sampleCv_;
+    std::condition_variable idleCv_;
+    int32_t nUsers_ { 0 };
+    bool stopping_ { false };
+    std::thread idleMonitor_;
+};
+
+inline bool PostureCache::IsActive() const
+{
+    return active_.load(std::memory_order_acquire);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // POSTURE_CACHE_H
\ No newline at end of file
@@ -26,10 +26,12 @@
 #include "motion_callback_stub.h"
 #endif
 #include "i_plugin.h"
+#include "posture_cache.h"
 
 #ifdef DEVICE_STATUS_SENSOR_ENABLE
 #include "sensor_agent.h"
 #include "sensor_agent_type.h"
+#include "sensor_manager.h"
 #endif
 
 namespace OHOS {
@@ -64,7 +66,7 @@ struct DevStaCallbackCmp {
 class StationaryServer {
 public:
     StationaryServer();
-    ~StationaryServer() = default;
+    ~StationaryServer();
     DISALLOW_COPY_AND_MOVE(StationaryServer);
 
     int32_t SubscribeStationaryCallback(CallingContext &context, int32_t type, int32_t event,
@@ -105,6 +107,10 @@ private:
     sptr<IRemoteObject::DeathRecipient> devStaCBDeathRecipient_ { nullptr };
 #endif
     DeviceStatusManager manager_;
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+    std::unique_ptr<SensorManager> postureSensor_;
+    std::unique_ptr<PostureCache> postureCache_;
+#endif
 };
 } // namespace DeviceStatus
 } // namespace Msdp
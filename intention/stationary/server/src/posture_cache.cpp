@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "posture_cache.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PostureCache"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int64_t NS_PER_MS { 1000000 };
+} // namespace
+
+PostureCache::PostureCache(StartSensor startSensor, StopSensor stopSensor, const Options &options)
+    : startSensor_(std::move(startSensor)), stopSensor_(std::move(stopSensor)), options_(options)
+{}
+
+PostureCache::~PostureCache()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stopping_ = true;
+    }
+    idleCv_.notify_all();
+    if (idleMonitor_.joinable()) {
+        idleMonitor_.join();
+    }
+    if (active_.exchange(false, std::memory_order_acq_rel) && (stopSensor_ != nullptr)) {
+        stopSensor_();
+    }
+}
+
+int32_t PostureCache::Acquire()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (stopping_) {
+        return RET_ERR;
+    }
+    if (!active_.load(std::memory_order_acquire)) {
+        if (idleMonitor_.joinable()) {
+            idleMonitor_.join();
+        }
+        CHKPR(startSensor_, RET_ERR);
+        int32_t ret = startSensor_();
+        if (ret != RET_OK) {
+            FI_HILOGE("Failed to start posture sensor, ret:%{public}d", ret);
+            return ret;
+        }
+        active_.store(true, std::memory_order_release);
+        idleMonitor_ = std::thread([this] { this->RunIdleMonitor(); });
+        FI_HILOGI("Posture sensor started");
+    }
+    ++nUsers_;
+    lastUse_.store(Now(), std::memory_order_relaxed);
+    return RET_OK;
+}
+
+void PostureCache::Release()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (nUsers_ > 0) {
+        --nUsers_;
+    }
+    lastUse_.store(Now(), std::memory_order_relaxed);
+}
+
+int32_t PostureCache::GetLatest(Sample &sample, int32_t timeoutMs)
+{
+    int64_t now = Now();
+    lastUse_.store(now, std::memory_order_relaxed);
+    int64_t sampleTime { 0 };
+    if (IsActive() && ReadSample(sample, sampleTime) && ((now - sampleTime) <= options_.staleNs)) {
+        return RET_OK;
+    }
+    int32_t ret = Acquire();
+    if (ret != RET_OK) {
+        return ret;
+    }
+    bool hasSample { false };
+    nWaiters_.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        sampleCv_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this, &sample, &sampleTime, &hasSample] {
+            hasSample = ReadSample(sample, sampleTime);
+            return (hasSample && ((Now() - sampleTime) <= options_.staleNs));
+        });
+    }
+    nWaiters_.fetch_sub(1);
+    Release();
+    // Like a one-shot read, fall back to the last report when no fresh one arrives in time.
+    return (hasSample ? RET_OK : RET_ERR);
+}
+
+void PostureCache::Update(const Sample &sample)
+{
+    uint32_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    x_.store(sample.x, std::memory_order_relaxed);
+    y_.store(sample.y, std::memory_order_relaxed);
+    z_.store(sample.z, std::memory_order_relaxed);
+    w_.store(sample.w, std::memory_order_relaxed);
+    sampleTime_.store(Now(), std::memory_order_relaxed);
+    seq_.store(seq + 2);
+
+    if (nWaiters_.load() > 0) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        sampleCv_.notify_all();
+    }
+}
+
+bool PostureCache::ReadSample(Sample &sample, int64_t &sampleTime) const
+{
+    uint32_t seq { 0 };
+    do {
+        seq = seq_.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        sample.x = x_.load(std::memory_order_relaxed);
+        sample.y = y_.load(std::memory_order_relaxed);
+        sample.z = z_.load(std::memory_order_relaxed);
+        sample.w = w_.load(std::memory_order_relaxed);
+        sampleTime = sampleTime_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while (((seq & 1U) != 0) || (seq_.load(std::memory_order_relaxed) != seq));
+    return (sampleTime != 0);
+}
+
+void PostureCache::RunIdleMonitor()
+{
+    const int64_t graceNs = static_cast<int64_t>(options_.idleGraceMs) * NS_PER_MS;
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stopping_) {
+        int64_t remainingNs = graceNs - (Now() - lastUse_.load(std::memory_order_relaxed));
+        if ((nUsers_ == 0) && (remainingNs <= 0)) {
+            if (StopIdleSensor(lock)) {
+                return;
+            }
+            continue;
+        }
+        if ((nUsers_ > 0) || (remainingNs <= 0)) {
+            remainingNs = graceNs;
+        }
+        idleCv_.wait_for(lock, std::chrono::nanoseconds(std::max<int64_t>(remainingNs, NS_PER_MS)));
+    }
+}
+
+bool PostureCache::StopIdleSensor(std::unique_lock<std::mutex> &lock)
+{
+    // Sensor callbacks block on mutex_ in Update(), do not hold it while the sensor is being stopped.
+    lock.unlock();
+    if (stopSensor_ != nullptr) {
+        stopSensor_();
+    }
+    lock.lock();
+    if ((nUsers_ > 0) && !stopping_) {
+        // Acquired while the sensor was being stopped, it is still taken as active.
+        lock.unlock();
+        int32_t ret = ((startSensor_ != nullptr) ? startSensor_() : RET_ERR);
+        lock.lock();
+        if (ret == RET_OK) {
+            return false;
+        }
+        FI_HILOGE("Failed to restart posture sensor, ret:%{public}d", ret);
+    }
+    // No reports arrive once the sensor is stopped, drop the last one so that
+    // it is not served after the next start.
+    sampleTime_.store(0, std::memory_order_relaxed);
+    active_.store(false, std::memory_order_release);
+    FI_HILOGI("Posture sensor stopped after idle for %{public}d ms", options_.idleGraceMs);
+    return true;
+}
+
+int64_t PostureCache::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -17,7 +17,7 @@
 
 #include <chrono>
 #include <cmath>
-#include <condition_variable>
+#include <thread>
 #include <tokenid_kit.h>
 
 #include "hisysevent.h"
@@ -54,6 +54,8 @@ constexpr int32_t RET_NO_SUPPORT = 801;
 constexpr int32_t RET_NO_SYSTEM_API = 202;
 constexpr int32_t SENSOR_SAMPLING_INTERVAL = 10000000;
 constexpr int32_t WAIT_SENSOR_DATA_TIMEOUT_MS = 200;
+constexpr int64_t POSTURE_STALE_NS = 50000000;
+constexpr int32_t POSTURE_IDLE_GRACE_MS = 2000;
 constexpr int32_t ROTATION_MAT_LEN = 3;
 constexpr int32_t MAT_IDX_0 = 0;
 constexpr int32_t MAT_IDX_1 = 1;
@@ -61,21 +63,29 @@ constexpr int32_t MAT_IDX_2 = 2;
 constexpr float DOUBLE_FACTOR = 2.0F;
 constexpr float PI = 3.141592653589846;
 constexpr float EPSILON_FLOAT = 1e-6;
-std::optional<RotationVectorData> cacheRotVecData_;
-std::mutex g_mtx;
-std::condition_variable g_cv;
+std::atomic<PostureCache *> g_postureCache { nullptr };
+// Sensor callbacks that may still be using the cache loaded from g_postureCache.
+std::atomic<int32_t> g_nPostureCallbacks { 0 };
 } // namespace
 
 static void OnReceivedData(SensorEvent *event)
 {
-    if (event == nullptr) {
+    if ((event == nullptr) || (event->data == nullptr)) {
         return;
     }
     if (event->sensorTypeId == SENSOR_TYPE_ID_ROTATION_VECTOR) {
-        std::unique_lock lockGrd(g_mtx);
-        RotationVectorData *data = reinterpret_cast<RotationVectorData *>(event->data);
-        cacheRotVecData_ = std::make_optional(*data);
-        g_cv.notify_all();
+        g_nPostureCallbacks.fetch_add(1);
+        PostureCache *postureCache = g_postureCache.load();
+        if (postureCache != nullptr) {
+            RotationVectorData *data = reinterpret_cast<RotationVectorData *>(event->data);
+            PostureCache::Sample sample;
+            sample.x = data->x;
+            sample.y = data->y;
+            sample.z = data->z;
+            sample.w = data->w;
+            postureCache->Update(sample);
+        }
+        g_nPostureCallbacks.fetch_sub(1);
     }
 }
 
@@ -113,6 +123,35 @@ StationaryServer::StationaryServer()
     };
     devStaCBDeathRecipient_ = new (std::nothrow) RemoteDevStaCallbackDeathRecipient(deathRecipientCB);
 #endif
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+    postureSensor_ = std::make_unique<SensorManager>(SENSOR_TYPE_ID_ROTATION_VECTOR, SENSOR_SAMPLING_INTERVAL);
+    postureSensor_->SetCallback(&OnReceivedData);
+    PostureCache::Options options;
+    options.staleNs = POSTURE_STALE_NS;
+    options.idleGraceMs = POSTURE_IDLE_GRACE_MS;
+    postureCache_ = std::make_unique<PostureCache>(
+        [this] {
+            int32_t ret = postureSensor_->StartSensor();
+            if (ret != RET_OK) {
+                postureSensor_->StopSensor();
+            }
+            return ret;
+        },
+        [this] { postureSensor_->StopSensor(); }, options);
+    g_postureCache.store(postureCache_.get(), std::memory_order_release);
+#endif
+}
+
+StationaryServer::~StationaryServer()
+{
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+    g_postureCache.store(nullptr);
+    // Wait for callbacks that loaded the cache before it was unpublished.
+    while (g_nPostureCallbacks.load() > 0) {
+        std::this_thread::yield();
+    }
+    postureCache_.reset();
+#endif
 }
 
 int32_t StationaryServer::SubscribeStationaryCallback(CallingContext &context, int32_t type, int32_t event,
@@ -168,22 +207,24 @@ int32_t StationaryServer::GetDevicePostureDataSync(CallingContext &context, Devi
 #ifndef DEVICE_STATUS_SENSOR_ENABLE
     return RET_NO_SUPPORT;
 #else
-    if (!SensorManager::IsSupportedSensor(SENSOR_TYPE_ID_ROTATION_VECTOR)) {
+    static const bool isSupported = SensorManager::IsSupportedSensor(SENSOR_TYPE_ID_ROTATION_VECTOR);
+    if (!isSupported) {
         FI_HILOGE("rotation vector sensor is not supported");
         return RET_NO_SUPPORT;
     }
-    // 订阅sensor获取四元数
-    SensorManager sensorManager(SENSOR_TYPE_ID_ROTATION_VECTOR, SENSOR_SAMPLING_INTERVAL);
-    sensorManager.SetCallback(&OnReceivedData);
-    sensorManager.StartSensor();
-    std::unique_lock lockGrd(g_mtx);
-    g_cv.wait_for(lockGrd, std::chrono::milliseconds(WAIT_SENSOR_DATA_TIMEOUT_MS));
-    sensorManager.StopSensor();
-    // 数据转换
-    if (cacheRotVecData_ == std::nullopt) {
+    CHKPR(postureCache_, RET_ERR);
+    // 订阅sensor获取四元数，传感器在空闲一段时间后才关闭
+    PostureCache::Sample sample;
+    if (postureCache_->GetLatest(sample, WAIT_SENSOR_DATA_TIMEOUT_MS) != RET_OK) {
         return RET_ERR;
     }
-    TransQuaternionsToZXYRot(cacheRotVecData_.value(), data);
+    // 数据转换
+    RotationVectorData quaternions {};
+    quaternions.x = sample.x;
+    quaternions.y = sample.y;
+    quaternions.z = sample.z;
+    quaternions.w = sample.w;
+    TransQuaternionsToZXYRot(quaternions, data);
     return RET_OK;
 #endif
 }
@@ -20,7 +20,9 @@
 #include <cmath>
 #include <cstdio>
 #include <iostream>
+#include <vector>
 
+#include "algo_kernel.h"
 #include "devicestatus_common.h"
 #include "devicestatus_data_define.h"
 #include "devicestatus_msdp_interface.h"
@@ -38,6 +40,12 @@ public:
     virtual bool Init(Type type) = 0;
     void Unsubscribe(int32_t sensorTypeId);
     void RegisterCallback(const std::shared_ptr<IMsdp::MsdpAlgoCallback> callback);
+    // In batch mode the algorithm receives all samples of a wakeup in one callback.
+    // Must be set before Init().
+    void SetBatchMode(bool batchMode);
+    // Runs the algorithm over every sample of @window in order, with the same
+    // result as passing them to StartAlgorithm() one at a time.
+    void ProcessWindow(const AccelWindow &window);
 
 protected:
     enum {
@@ -53,9 +61,6 @@ protected:
         float x { 0.0 };
         float y { 0.0 };
         float z { 0.0 };
-        double resultantAcc { 0.0 };
-        double pitch { 0.0 };
-        double roll { 0.0 };
     } algoPara_ {};
     int32_t state_ { UNKNOWN };
     int32_t counter_ { COUNTER_THRESHOLD };
@@ -67,11 +72,24 @@ protected:
 
     virtual bool StartAlgorithm(int32_t sensorTypeId, AccelData* sensorData) = 0;
     bool SetData(int32_t sensorTypeId, AccelData* sensorData);
+    bool Subscribe(int32_t type);
     virtual void ExecuteOperation() = 0;
+    virtual void JudgeWindow(const AccelWindow &window, SampleVerdict *verdicts) = 0;
+    virtual void ApplyVerdict(SampleVerdict verdict) = 0;
+    void UpdateState(SampleVerdict verdict, int32_t enterState, int32_t exitState, Type type);
     void UpdateStateAndReport(OnChangedValue value, int32_t state, Type type);
 
+    bool batchMode_ { false };
     SensorCallback algoCallback_ { nullptr };
     std::shared_ptr<IMsdp::MsdpAlgoCallback> callback_ { nullptr };
+
+private:
+    void ProcessBatch(int32_t sensorTypeId, AccelData* sensorData, size_t count);
+
+    std::vector<float> windowX_;
+    std::vector<float> windowY_;
+    std::vector<float> windowZ_;
+    std::vector<SampleVerdict> verdicts_;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
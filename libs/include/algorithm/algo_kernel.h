@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_KERNEL_H
+#define ALGO_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// A window of accelerometer samples in structure-of-arrays layout, in the axes of the sensor.
+struct AccelWindow {
+    const float *x { nullptr };
+    const float *y { nullptr };
+    const float *z { nullptr };
+    size_t count { 0 };
+};
+
+// What a posture algorithm makes of one accelerometer sample.
+enum SampleVerdict : int8_t {
+    // The sample is invalid or ignored, and leaves the algorithm as it is.
+    VERDICT_SKIP = -1,
+    VERDICT_OUT,
+    VERDICT_IN
+};
+
+// Per-sample judgements of the posture algorithms. The scalar overloads take one sample in the
+// axes of the algorithm, as set by AlgoBase::SetData(). The window overloads take samples in the
+// axes of the sensor, check and swap them the same way, and evaluate four samples at a time with
+// SSE2 or NEON where available. Samples that come too close to a threshold for the vector math
+// to decide are judged again by the scalar overload, so both give the same verdicts.
+class AlgoKernel {
+public:
+    static SampleVerdict JudgeAbsoluteStill(float x, float y, float z);
+    static SampleVerdict JudgeHorizontal(float x, float y, float z);
+    static SampleVerdict JudgeVertical(float x, float y, float z);
+
+    static void JudgeAbsoluteStill(const AccelWindow &window, SampleVerdict *verdicts);
+    static void JudgeHorizontal(const AccelWindow &window, SampleVerdict *verdicts);
+    static void JudgeVertical(const AccelWindow &window, SampleVerdict *verdicts);
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // ALGO_KERNEL_H
\ No newline at end of file
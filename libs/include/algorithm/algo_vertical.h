@@ -31,6 +31,8 @@ public:
 private:
     bool StartAlgorithm(int32_t sensorTypeId, AccelData* sensorData) override;
     void ExecuteOperation() override;
+    void JudgeWindow(const AccelWindow &window, SampleVerdict *verdicts) override;
+    void ApplyVerdict(SampleVerdict verdict) override;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
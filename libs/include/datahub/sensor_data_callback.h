@@ -18,8 +18,8 @@
 
 #ifdef DEVICE_STATUS_SENSOR_ENABLE
 #include <atomic>
-#include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -29,6 +29,7 @@
 #include "sensor_agent_type.h"
 
 #include "devicestatus_data_define.h"
+#include "spsc_ring.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -41,17 +42,33 @@ public:
     void Init();
     bool Unregister();
     bool SubscribeSensorEvent(int32_t sensorTypeId, SensorCallback callback);
+    // Like SubscribeSensorEvent(), but @callback receives every sample queued since
+    // the last wakeup in one call.
+    bool SubscribeSensorBatch(int32_t sensorTypeId, SensorBatchCallback callback);
     bool UnsubscribeSensorEvent(int32_t sensorTypeId, SensorCallback callback);
     bool PushData(int32_t sensorTypeId, uint8_t* data);
+    uint64_t GetDroppedCount() const;
+    uint64_t GetWakeupCount() const;
 
 private:
-    bool PopData(int32_t sensorTypeId, AccelData& data);
+    struct Subscriber {
+        SensorCallback callback { nullptr };
+        SensorBatchCallback batchCallback { nullptr };
+    };
+    using Subscribers = std::map<int32_t, Subscriber>;
+
+    bool AddSubscriber(int32_t sensorTypeId, const Subscriber &subscriber);
     void AlgorithmLoop();
+    void WaitForData();
     void HandleSensorEvent();
-    bool NotifyCallback(int32_t sensorTypeId, AccelData* data);
+    bool NotifyCallback(int32_t sensorTypeId, AccelData* data, size_t count);
+    void WaitForDispatch();
+
+    static constexpr size_t ACCEL_RING_CAPACITY { 64 };
 
     struct SensorUser user_ = {.name = {0}, .callback = nullptr, .userData = nullptr};
-    std::list<AccelData> accelDataList_;
+    // Filled by the sensor callback thread and drained by the algorithm thread.
+    SpscRing<AccelData, ACCEL_RING_CAPACITY> accelRing_;
     std::unique_ptr<std::thread> algorithmThread_ { nullptr };
     sem_t sem_ = {};
     std::mutex callbackMutex_;
@@ -59,8 +76,22 @@ private:
     std::mutex initMutex_;
     std::mutex sensorMutex_;
     std::atomic<bool> alive_ { true };
-    std::map<int32_t, SensorCallback> algoMap_;
+    std::atomic<bool> idle_ { false };
+    std::atomic<uint32_t> dispatchSeq_ { 0 };
+    std::atomic<uint64_t> nDropped_ { 0 };
+    std::atomic<uint64_t> nWakeups_ { 0 };
+    std::shared_ptr<const Subscribers> subscribers_ { std::make_shared<Subscribers>() };
 };
+
+inline uint64_t SensorDataCallback::GetDroppedCount() const
+{
+    return nDropped_.load(std::memory_order_relaxed);
+}
+
+inline uint64_t SensorDataCallback::GetWakeupCount() const
+{
+    return nWakeups_.load(std::memory_order_relaxed);
+}
 #define SENSOR_DATA_CB OHOS::Singleton<SensorDataCallback>::GetInstance()
 } // namespace DeviceStatus
 } // namespace Msdp
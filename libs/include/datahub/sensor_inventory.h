@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SENSOR_INVENTORY_H
+#define SENSOR_INVENTORY_H
+
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+class ISensorProvider {
+public:
+    ISensorProvider() = default;
+    virtual ~ISensorProvider() = default;
+
+    virtual bool GetSensorTypeIds(std::vector<int32_t> &sensorTypeIds) = 0;
+    virtual bool ActivateSensor(int32_t sensorTypeId) = 0;
+    virtual bool DeactivateSensor(int32_t sensorTypeId) = 0;
+};
+
+// Talks to the sensor service and feeds samples into SENSOR_DATA_CB.
+class SensorAgentProvider final : public ISensorProvider {
+public:
+    SensorAgentProvider() = default;
+    ~SensorAgentProvider() = default;
+
+    bool GetSensorTypeIds(std::vector<int32_t> &sensorTypeIds) override;
+    bool ActivateSensor(int32_t sensorTypeId) override;
+    bool DeactivateSensor(int32_t sensorTypeId) override;
+};
+
+// Caches the sensors present on the device and shares one activation of each
+// sensor among all the algorithms that read it.
+class SensorInventory final {
+public:
+    explicit SensorInventory(std::shared_ptr<ISensorProvider> provider);
+    ~SensorInventory() = default;
+    DISALLOW_COPY_AND_MOVE(SensorInventory);
+
+    bool HasSensor(int32_t sensorTypeId);
+    // The first acquirer activates the sensor, the last releaser deactivates it.
+    bool Acquire(int32_t sensorTypeId);
+    bool Release(int32_t sensorTypeId);
+    // Call when a sensor is plugged in or out, the next lookup reloads the inventory.
+    void OnSensorPlug();
+
+private:
+    bool LoadSensorTypeIds();
+
+    std::shared_ptr<ISensorProvider> provider_ { nullptr };
+    std::mutex mutex_;
+    bool loaded_ { false };
+    std::set<int32_t> sensorTypeIds_;
+    std::map<int32_t, int32_t> refCounts_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DEVICE_STATUS_SENSOR_ENABLE
+#endif // SENSOR_INVENTORY_H
\ No newline at end of file
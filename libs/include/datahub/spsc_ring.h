@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Fixed-capacity single-producer/single-consumer ring. Push() may only be
+// called from one thread and Pop() from one other thread at a time.
+template<typename T, size_t Capacity>
+class SpscRing {
+    static_assert((Capacity != 0) && ((Capacity & (Capacity - 1)) == 0), "Capacity must be a power of two");
+
+public:
+    bool Push(const T &item);
+    // Moves up to @maxItems items into @items and returns how many were moved.
+    size_t Pop(T *items, size_t maxItems);
+    bool IsEmpty() const;
+    size_t GetSize() const;
+
+private:
+    static constexpr size_t MASK { Capacity - 1 };
+
+    T items_[Capacity] {};
+    alignas(64) std::atomic<size_t> head_ { 0 };
+    alignas(64) std::atomic<size_t> tail_ { 0 };
+};
+
+template<typename T, size_t Capacity>
+bool SpscRing<T, Capacity>::Push(const T &item)
+{
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if ((tail - head_.load(std::memory_order_acquire)) >= Capacity) {
+        return false;
+    }
+    items_[tail & MASK] = item;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T, size_t Capacity>
+size_t SpscRing<T, Capacity>::Pop(T *items, size_t maxItems)
+{
+    size_t head = head_.load(std::memory_order_relaxed);
+    size_t count = tail_.load(std::memory_order_acquire) - head;
+    if (count > maxItems) {
+        count = maxItems;
+    }
+    for (size_t index = 0; index < count; ++index) {
+        items[index] = items_[(head + index) & MASK];
+    }
+    head_.store(head + count, std::memory_order_release);
+    return count;
+}
+
+template<typename T, size_t Capacity>
+bool SpscRing<T, Capacity>::IsEmpty() const
+{
+    return (head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire));
+}
+
+template<typename T, size_t Capacity>
+size_t SpscRing<T, Capacity>::GetSize() const
+{
+    return (tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire));
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // SPSC_RING_H
\ No newline at end of file
@@ -30,6 +30,7 @@
 #include "devicestatus_data_define.h"
 #include "devicestatus_msdp_interface.h"
 #include "sensor_data_callback.h"
+#include "sensor_inventory.h"
 #include "stationary_data.h"
 
 namespace OHOS {
@@ -37,7 +38,8 @@ namespace Msdp {
 namespace DeviceStatus {
 class AlgoMgr final : public IMsdp {
 public:
-    AlgoMgr() = default;
+    AlgoMgr();
+    explicit AlgoMgr(std::shared_ptr<ISensorProvider> sensorProvider);
     virtual ~AlgoMgr() = default;
 
     bool Init();
@@ -55,6 +57,7 @@ public:
     bool CheckSensorTypeId(int32_t sensorTypeId);
     bool StartSensor(Type type);
     int32_t GetSensorTypeId(Type type);
+    void OnSensorPlug();
 private:
     int32_t type_[Type::TYPE_MAX] { 0 };
     std::shared_ptr<MsdpAlgoCallback> callback_ { nullptr };
@@ -64,6 +67,7 @@ private:
     std::shared_ptr<AlgoVertical> verticalPosition_ { nullptr };
     std::map<Type, int32_t> callAlgoNums_ {};
     Type algoType_ { TYPE_INVALID };
+    SensorInventory sensors_;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -44,6 +44,7 @@ constexpr int32_t COUNTER_THRESHOLD = VALID_TIME_THRESHOLD / ACC_SAMPLE_PERIOD;
 
 #ifdef DEVICE_STATUS_SENSOR_ENABLE
 using SensorCallback = std::function<void(int32_t, AccelData*)>;
+using SensorBatchCallback = std::function<void(int32_t, AccelData*, size_t)>;
 #endif // DEVICE_STATUS_SENSOR_ENABLE
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -16,9 +16,15 @@
 #ifndef DEVICESTATUS_DATA_PARSE_H
 #define DEVICESTATUS_DATA_PARSE_H
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include <sys/stat.h>
+
 #include "stationary_data.h"
 
 namespace OHOS {
@@ -34,12 +40,27 @@ public:
     int32_t CreateJsonFile();
 
 private:
+    // Mock values of every type, parsed from one version of the data file.
+    struct MockData {
+        dev_t dev { 0 };
+        ino_t ino { 0 };
+        off_t size { 0 };
+        struct timespec mtime {};
+        // An empty entry stands for an item that is not a number.
+        std::array<std::vector<std::optional<int32_t>>, Type::TYPE_MAX> values;
+    };
+
     bool CheckFileDir(const std::string &filePath, const std::string &dir);
-    bool CheckFileSize(const std::string &filePath);
     bool CheckFileExtendName(const std::string &filePath, const std::string &checkExtension);
-    std::string ReadFile(const std::string &filePath);
-    std::string ReadJsonFile(const std::string &filePath);
-    static std::vector<int32_t> tempcount_;
+    bool UpdateMockData(const std::string &filePath);
+    std::unique_ptr<MockData> LoadMockData(const std::string &filePath);
+    static bool ParseMockData(const char *json, size_t jsonLen, MockData &mockData);
+    static bool IsSameFile(const MockData &mockData, const struct stat &statBuf);
+    bool GetNextValue(const MockData &mockData, Type type, Data &data);
+
+    std::mutex mutex_;
+    std::unique_ptr<MockData> mockData_;
+    std::array<uint32_t, Type::TYPE_MAX> cursors_ {};
 };
 } // namespace DeviceStatus
 } // namespace Msdp
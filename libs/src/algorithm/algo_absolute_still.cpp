@@ -35,7 +35,7 @@ bool AlgoAbsoluteStill::Init(Type type)
         FI_HILOGE("algoCallback is nullptr");
         return false;
     }
-    SENSOR_DATA_CB.SubscribeSensorEvent(type, algoCallback_);
+    Subscribe(type);
     return true;
 }
 
@@ -53,25 +53,17 @@ bool AlgoAbsoluteStill::StartAlgorithm(int32_t sensorTypeId, AccelData* sensorDa
 void AlgoAbsoluteStill::ExecuteOperation()
 {
     CALL_DEBUG_ENTER;
-    algoPara_.resultantAcc =
-        sqrt((algoPara_.x * algoPara_.x) + (algoPara_.y * algoPara_.y) + (algoPara_.z * algoPara_.z));
-    FI_HILOGD("resultantAcc:%{public}f", algoPara_.resultantAcc);
-    if ((algoPara_.resultantAcc > RESULTANT_ACC_LOW_THRHD) && (algoPara_.resultantAcc < RESULTANT_ACC_UP_THRHD)) {
-        if (state_ == STILL) {
-            return;
-        }
-        counter_--;
-        if (counter_ == 0) {
-            counter_ = COUNTER_THRESHOLD;
-            UpdateStateAndReport(VALUE_ENTER, STILL, TYPE_ABSOLUTE_STILL);
-        }
-    } else {
-        counter_ = COUNTER_THRESHOLD;
-        if (state_ == UNSTILL) {
-            return;
-        }
-        UpdateStateAndReport(VALUE_EXIT, UNSTILL, TYPE_ABSOLUTE_STILL);
-    }
+    ApplyVerdict(AlgoKernel::JudgeAbsoluteStill(algoPara_.x, algoPara_.y, algoPara_.z));
+}
+
+void AlgoAbsoluteStill::JudgeWindow(const AccelWindow &window, SampleVerdict *verdicts)
+{
+    AlgoKernel::JudgeAbsoluteStill(window, verdicts);
+}
+
+void AlgoAbsoluteStill::ApplyVerdict(SampleVerdict verdict)
+{
+    UpdateState(verdict, STILL, UNSTILL, TYPE_ABSOLUTE_STILL);
 }
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -32,6 +32,50 @@ void AlgoBase::Unsubscribe(int32_t sensorTypeId)
     SENSOR_DATA_CB.UnsubscribeSensorEvent(sensorTypeId, algoCallback_);
 }
 
+void AlgoBase::SetBatchMode(bool batchMode)
+{
+    batchMode_ = batchMode;
+}
+
+bool AlgoBase::Subscribe(int32_t type)
+{
+    CHKPF(algoCallback_);
+    if (!batchMode_) {
+        return SENSOR_DATA_CB.SubscribeSensorEvent(type, algoCallback_);
+    }
+    return SENSOR_DATA_CB.SubscribeSensorBatch(type,
+        [this](int32_t sensorTypeId, AccelData* sensorData, size_t count) {
+            this->ProcessBatch(sensorTypeId, sensorData, count);
+        });
+}
+
+void AlgoBase::ProcessBatch(int32_t sensorTypeId, AccelData* sensorData, size_t count)
+{
+    if (sensorTypeId != SENSOR_TYPE_ID_ACCELEROMETER) {
+        FI_HILOGE("sensorTypeId:%{public}d", sensorTypeId);
+        return;
+    }
+    CHKPV(sensorData);
+    windowX_.resize(count);
+    windowY_.resize(count);
+    windowZ_.resize(count);
+    for (size_t index = 0; index < count; ++index) {
+        windowX_[index] = sensorData[index].x;
+        windowY_[index] = sensorData[index].y;
+        windowZ_[index] = sensorData[index].z;
+    }
+    ProcessWindow(AccelWindow { windowX_.data(), windowY_.data(), windowZ_.data(), count });
+}
+
+void AlgoBase::ProcessWindow(const AccelWindow &window)
+{
+    verdicts_.resize(window.count);
+    JudgeWindow(window, verdicts_.data());
+    for (SampleVerdict verdict : verdicts_) {
+        ApplyVerdict(verdict);
+    }
+}
+
 bool AlgoBase::SetData(int32_t sensorTypeId, AccelData* sensorData)
 {
     CALL_DEBUG_ENTER;
@@ -41,9 +85,9 @@ bool AlgoBase::SetData(int32_t sensorTypeId, AccelData* sensorData)
     }
     CHKPF(sensorData);
     AccelData* data = sensorData;
-    if ((abs(data->x) > ACC_VALID_THRHD) ||
-        (abs(data->y) > ACC_VALID_THRHD) ||
-        (abs(data->z) > ACC_VALID_THRHD)) {
+    if ((std::abs(data->x) > ACC_VALID_THRHD) ||
+        (std::abs(data->y) > ACC_VALID_THRHD) ||
+        (std::abs(data->z) > ACC_VALID_THRHD)) {
         FI_HILOGE("Acc data is invalid");
         return false;
     }
@@ -61,6 +105,29 @@ void AlgoBase::RegisterCallback(const std::shared_ptr<IMsdp::MsdpAlgoCallback> c
     callback_ = callback;
 }
 
+void AlgoBase::UpdateState(SampleVerdict verdict, int32_t enterState, int32_t exitState, Type type)
+{
+    if (verdict == VERDICT_SKIP) {
+        return;
+    }
+    if (verdict == VERDICT_IN) {
+        if (state_ == enterState) {
+            return;
+        }
+        counter_--;
+        if (counter_ == 0) {
+            counter_ = COUNTER_THRESHOLD;
+            UpdateStateAndReport(VALUE_ENTER, enterState, type);
+        }
+    } else {
+        counter_ = COUNTER_THRESHOLD;
+        if (state_ == exitState) {
+            return;
+        }
+        UpdateStateAndReport(VALUE_EXIT, exitState, type);
+    }
+}
+
 void AlgoBase::UpdateStateAndReport(OnChangedValue value, int32_t state, Type type)
 {
     CALL_DEBUG_ENTER;
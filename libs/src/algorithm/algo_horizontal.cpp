@@ -32,7 +32,7 @@ bool AlgoHorizontal::Init(Type type)
         return this->StartAlgorithm(sensorTypeId, sensorData);
     };
     CHKPF(algoCallback_);
-    SENSOR_DATA_CB.SubscribeSensorEvent(type, algoCallback_);
+    Subscribe(type);
     return true;
 }
 
@@ -50,29 +50,17 @@ bool AlgoHorizontal::StartAlgorithm(int32_t sensorTypeId, AccelData* sensorData)
 void AlgoHorizontal::ExecuteOperation()
 {
     CALL_DEBUG_ENTER;
-    algoPara_.pitch = -atan2(algoPara_.y, algoPara_.z) * (ANGLE_180_DEGREE / PI);
-    algoPara_.roll = atan2(algoPara_.x, algoPara_.z) * (ANGLE_180_DEGREE / PI);
-    FI_HILOGD("pitch:%{public}f, roll:%{public}f", algoPara_.pitch, algoPara_.roll);
+    ApplyVerdict(AlgoKernel::JudgeHorizontal(algoPara_.x, algoPara_.y, algoPara_.z));
+}
 
-    if ((((abs(algoPara_.pitch) > ANGLE_HOR_LOW_THRHD) && (abs(algoPara_.pitch) < ANGLE_HOR_UP_THRHD)) &&
-        ((abs(algoPara_.roll) > ANGLE_HOR_LOW_THRHD) && (abs(algoPara_.roll) < ANGLE_HOR_UP_THRHD))) ||
-        (((abs(algoPara_.pitch) > 0) && (abs(algoPara_.pitch) < ANGLE_HOR_FLIPPED_THRHD)) &&
-        ((abs(algoPara_.roll) > 0) && (abs(algoPara_.roll) < ANGLE_VER_FLIPPED_THRHD)))) {
-        if (state_ == HORIZONTAL) {
-            return;
-        }
-        counter_--;
-        if (counter_ == 0) {
-            counter_ = COUNTER_THRESHOLD;
-            UpdateStateAndReport(VALUE_ENTER, HORIZONTAL, TYPE_HORIZONTAL_POSITION);
-        }
-    } else {
-        counter_ = COUNTER_THRESHOLD;
-        if (state_ == NON_HORIZONTAL) {
-            return;
-        }
-        UpdateStateAndReport(VALUE_EXIT, NON_HORIZONTAL, TYPE_HORIZONTAL_POSITION);
-    }
+void AlgoHorizontal::JudgeWindow(const AccelWindow &window, SampleVerdict *verdicts)
+{
+    AlgoKernel::JudgeHorizontal(window, verdicts);
+}
+
+void AlgoHorizontal::ApplyVerdict(SampleVerdict verdict)
+{
+    UpdateState(verdict, HORIZONTAL, NON_HORIZONTAL, TYPE_HORIZONTAL_POSITION);
 }
 } // namespace DeviceStatus
 } // namespace Msdp
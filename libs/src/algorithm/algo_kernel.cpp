@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo_kernel.h"
+
+#include <cmath>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define ALGO_KERNEL_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define ALGO_KERNEL_SSE2
+#endif
+
+#if defined(ALGO_KERNEL_NEON) || defined(ALGO_KERNEL_SSE2)
+#define ALGO_KERNEL_VECTOR
+#endif
+
+#include "devicestatus_data_define.h"
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "AlgoKernel"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr float JUDGE_FLOAT { 1e-6 };
+
+bool IsBetween(double value, double low, double up)
+{
+    return ((value > low) && (value < up));
+}
+
+using SampleJudge = SampleVerdict (*)(float x, float y, float z);
+
+// Judges one sample of @window the way AlgoBase::SetData() and ExecuteOperation() do.
+SampleVerdict JudgeSample(const AccelWindow &window, size_t index, SampleJudge judge)
+{
+    if ((std::abs(window.x[index]) > ACC_VALID_THRHD) ||
+        (std::abs(window.y[index]) > ACC_VALID_THRHD) ||
+        (std::abs(window.z[index]) > ACC_VALID_THRHD)) {
+        return VERDICT_SKIP;
+    }
+    return judge(window.y[index], window.x[index], -window.z[index]);
+}
+
+#ifdef ALGO_KERNEL_VECTOR
+constexpr size_t N_LANES { 4 };
+constexpr float PI_FLOAT { 3.14159265358979F };
+constexpr float TAN_PI_8 { 0.414213562373095F };
+constexpr float ATAN_COEF_0 { 8.05374449538e-2F };
+constexpr float ATAN_COEF_1 { -1.38776856032e-1F };
+constexpr float ATAN_COEF_2 { 1.99777106478e-1F };
+constexpr float ATAN_COEF_3 { -3.33329491539e-1F };
+// Vector results closer than this to a threshold are left to the scalar judgement. The vector
+// magnitude is within a few ulp of the scalar one, and the vector angles within 1e-4 degree.
+constexpr float ACC_MARGIN { 1e-3F };
+constexpr float ANGLE_MARGIN { 1e-2F };
+
+#if defined(ALGO_KERNEL_NEON)
+using FloatVec = float32x4_t;
+using MaskVec = uint32x4_t;
+
+inline FloatVec Load(const float *data) { return vld1q_f32(data); }
+inline FloatVec Splat(float value) { return vdupq_n_f32(value); }
+inline MaskVec NoLane() { return vdupq_n_u32(0); }
+inline FloatVec Add(FloatVec a, FloatVec b) { return vaddq_f32(a, b); }
+inline FloatVec Sub(FloatVec a, FloatVec b) { return vsubq_f32(a, b); }
+inline FloatVec Mul(FloatVec a, FloatVec b) { return vmulq_f32(a, b); }
+inline FloatVec Div(FloatVec a, FloatVec b) { return vdivq_f32(a, b); }
+inline FloatVec Sqrt(FloatVec a) { return vsqrtq_f32(a); }
+inline FloatVec Neg(FloatVec a) { return vnegq_f32(a); }
+inline FloatVec Abs(FloatVec a) { return vabsq_f32(a); }
+inline FloatVec Min(FloatVec a, FloatVec b) { return vminq_f32(a, b); }
+inline FloatVec Max(FloatVec a, FloatVec b) { return vmaxq_f32(a, b); }
+inline MaskVec Equal(FloatVec a, FloatVec b) { return vceqq_f32(a, b); }
+inline MaskVec Greater(FloatVec a, FloatVec b) { return vcgtq_f32(a, b); }
+inline MaskVec GreaterEqual(FloatVec a, FloatVec b) { return vcgeq_f32(a, b); }
+inline MaskVec Less(FloatVec a, FloatVec b) { return vcltq_f32(a, b); }
+inline MaskVec LessEqual(FloatVec a, FloatVec b) { return vcleq_f32(a, b); }
+inline MaskVec And(MaskVec a, MaskVec b) { return vandq_u32(a, b); }
+inline MaskVec Or(MaskVec a, MaskVec b) { return vorrq_u32(a, b); }
+inline MaskVec Not(MaskVec a) { return vmvnq_u32(a); }
+inline MaskVec Bits(uint32_t bits) { return vdupq_n_u32(bits); }
+inline bool AnyLane(MaskVec mask) { return (vmaxvq_u32(mask) != 0); }
+inline FloatVec Select(MaskVec mask, FloatVec a, FloatVec b) { return vbslq_f32(mask, a, b); }
+inline void Store(MaskVec mask, uint32_t *data) { vst1q_u32(data, mask); }
+#else
+using FloatVec = __m128;
+using MaskVec = __m128;
+
+inline FloatVec Load(const float *data) { return _mm_loadu_ps(data); }
+inline FloatVec Splat(float value) { return _mm_set1_ps(value); }
+inline MaskVec NoLane() { return _mm_setzero_ps(); }
+inline FloatVec Add(FloatVec a, FloatVec b) { return _mm_add_ps(a, b); }
+inline FloatVec Sub(FloatVec a, FloatVec b) { return _mm_sub_ps(a, b); }
+inline FloatVec Mul(FloatVec a, FloatVec b) { return _mm_mul_ps(a, b); }
+inline FloatVec Div(FloatVec a, FloatVec b) { return _mm_div_ps(a, b); }
+inline FloatVec Sqrt(FloatVec a) { return _mm_sqrt_ps(a); }
+inline FloatVec Neg(FloatVec a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0F)); }
+inline FloatVec Abs(FloatVec a) { return _mm_andnot_ps(_mm_set1_ps(-0.0F), a); }
+inline FloatVec Min(FloatVec a, FloatVec b) { return _mm_min_ps(a, b); }
+inline FloatVec Max(FloatVec a, FloatVec b) { return _mm_max_ps(a, b); }
+inline MaskVec Equal(FloatVec a, FloatVec b) { return _mm_cmpeq_ps(a, b); }
+inline MaskVec Greater(FloatVec a, FloatVec b) { return _mm_cmpgt_ps(a, b); }
+inline MaskVec GreaterEqual(FloatVec a, FloatVec b) { return _mm_cmpge_ps(a, b); }
+inline MaskVec Less(FloatVec a, FloatVec b) { return _mm_cmplt_ps(a, b); }
+inline MaskVec LessEqual(FloatVec a, FloatVec b) { return _mm_cmple_ps(a, b); }
+inline MaskVec And(MaskVec a, MaskVec b) { return _mm_and_ps(a, b); }
+inline MaskVec Or(MaskVec a, MaskVec b) { return _mm_or_ps(a, b); }
+inline MaskVec Not(MaskVec a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+inline MaskVec Bits(uint32_t bits) { return _mm_castsi128_ps(_mm_set1_epi32(static_cast<int32_t>(bits))); }
+inline bool AnyLane(MaskVec mask) { return (_mm_movemask_ps(mask) != 0); }
+inline FloatVec Select(MaskVec mask, FloatVec a, FloatVec b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+inline void Store(MaskVec mask, uint32_t *data)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data), _mm_castps_si128(mask));
+}
+#endif // ALGO_KERNEL_NEON
+
+// Verdicts on four samples. Lanes not in @decided are judged again by the scalar code.
+struct LaneVerdicts {
+    MaskVec skip;
+    MaskVec in;
+    MaskVec decided;
+};
+
+using LaneJudge = LaneVerdicts (*)(FloatVec x, FloatVec y, FloatVec z);
+
+MaskVec IsBetween(FloatVec value, float low, float up)
+{
+    return And(Greater(value, Splat(low)), Less(value, Splat(up)));
+}
+
+// Lanes of @value at least @margin away from @threshold. NaN lanes are not.
+MaskVec IsFarFrom(FloatVec value, float threshold, float margin)
+{
+    return GreaterEqual(Abs(Sub(value, Splat(threshold))), Splat(margin));
+}
+
+MaskVec IsOrdered(FloatVec x, FloatVec y, FloatVec z)
+{
+    return And(And(Equal(x, x), Equal(y, y)), Equal(z, z));
+}
+
+// |atan2(y, z)| in degrees, reduced into [0, tan(pi/8)] and approximated as in Cephes atanf().
+// NaN where both @y and @z are zero.
+FloatVec AbsAtan2Degree(FloatVec y, FloatVec z)
+{
+    FloatVec absY = Abs(y);
+    FloatVec absZ = Abs(z);
+    FloatVec one = Splat(1.0F);
+    FloatVec ratio = Div(Min(absY, absZ), Max(absY, absZ));
+    MaskVec reduced = Greater(ratio, Splat(TAN_PI_8));
+    FloatVec t = Select(reduced, Div(Sub(ratio, one), Add(ratio, one)), ratio);
+    FloatVec t2 = Mul(t, t);
+    FloatVec poly = Add(Mul(Splat(ATAN_COEF_0), t2), Splat(ATAN_COEF_1));
+    poly = Add(Mul(poly, t2), Splat(ATAN_COEF_2));
+    poly = Add(Mul(poly, t2), Splat(ATAN_COEF_3));
+    FloatVec angle = Add(Mul(Mul(poly, t2), t), t);
+    angle = Add(angle, Select(reduced, Splat(PI_FLOAT / 4), Splat(0.0F)));
+    angle = Select(Greater(absY, absZ), Sub(Splat(PI_FLOAT / 2), angle), angle);
+    angle = Select(Less(z, Splat(0.0F)), Sub(Splat(PI_FLOAT), angle), angle);
+    return Mul(angle, Splat(static_cast<float>(ANGLE_180_DEGREE / PI)));
+}
+
+LaneVerdicts JudgeAbsoluteStillLanes(FloatVec x, FloatVec y, FloatVec z)
+{
+    FloatVec resultantAcc = Sqrt(Add(Add(Mul(x, x), Mul(y, y)), Mul(z, z)));
+    LaneVerdicts verdicts;
+    verdicts.skip = NoLane();
+    verdicts.in = IsBetween(resultantAcc, RESULTANT_ACC_LOW_THRHD, RESULTANT_ACC_UP_THRHD);
+    verdicts.decided = And(IsFarFrom(resultantAcc, RESULTANT_ACC_LOW_THRHD, ACC_MARGIN),
+        IsFarFrom(resultantAcc, RESULTANT_ACC_UP_THRHD, ACC_MARGIN));
+    return verdicts;
+}
+
+MaskVec IsFarFromHorizontal(FloatVec angle)
+{
+    return And(And(IsFarFrom(angle, 0.0F, ANGLE_MARGIN), IsFarFrom(angle, ANGLE_HOR_FLIPPED_THRHD, ANGLE_MARGIN)),
+        And(IsFarFrom(angle, ANGLE_HOR_LOW_THRHD, ANGLE_MARGIN), IsFarFrom(angle, ANGLE_HOR_UP_THRHD, ANGLE_MARGIN)));
+}
+
+LaneVerdicts JudgeHorizontalLanes(FloatVec x, FloatVec y, FloatVec z)
+{
+    FloatVec pitch = AbsAtan2Degree(y, z);
+    FloatVec roll = AbsAtan2Degree(x, z);
+    LaneVerdicts verdicts;
+    verdicts.skip = NoLane();
+    verdicts.in = Or(
+        And(IsBetween(pitch, ANGLE_HOR_LOW_THRHD, ANGLE_HOR_UP_THRHD),
+            IsBetween(roll, ANGLE_HOR_LOW_THRHD, ANGLE_HOR_UP_THRHD)),
+        And(IsBetween(pitch, 0.0F, ANGLE_HOR_FLIPPED_THRHD), IsBetween(roll, 0.0F, ANGLE_VER_FLIPPED_THRHD)));
+    verdicts.decided = And(And(IsFarFromHorizontal(pitch), IsFarFromHorizontal(roll)), IsOrdered(x, y, z));
+    return verdicts;
+}
+
+MaskVec IsFarFromVertical(FloatVec angle)
+{
+    return And(IsFarFrom(angle, ANGLE_VER_LOW_THRHD, ANGLE_MARGIN), IsFarFrom(angle, ANGLE_VER_UP_THRHD, ANGLE_MARGIN));
+}
+
+LaneVerdicts JudgeVerticalLanes(FloatVec x, FloatVec y, FloatVec z)
+{
+    FloatVec pitch = AbsAtan2Degree(y, z);
+    FloatVec roll = AbsAtan2Degree(x, z);
+    FloatVec judge = Splat(JUDGE_FLOAT);
+    LaneVerdicts verdicts;
+    verdicts.skip = And(LessEqual(Abs(y), judge), LessEqual(Abs(z), judge));
+    verdicts.in = Or(IsBetween(pitch, ANGLE_VER_LOW_THRHD, ANGLE_VER_UP_THRHD),
+        IsBetween(roll, ANGLE_VER_LOW_THRHD, ANGLE_VER_UP_THRHD));
+    verdicts.decided = And(And(IsFarFromVertical(pitch), IsFarFromVertical(roll)), IsOrdered(x, y, z));
+    return verdicts;
+}
+
+// Judges the samples of @window four at a time, and returns how many it has judged.
+size_t JudgeLanes(const AccelWindow &window, SampleVerdict *verdicts, LaneJudge laneJudge, SampleJudge judge)
+{
+    FloatVec accValid = Splat(ACC_VALID_THRHD);
+    size_t index = 0;
+    for (; index + N_LANES <= window.count; index += N_LANES) {
+        FloatVec rawX = Load(window.x + index);
+        FloatVec rawY = Load(window.y + index);
+        FloatVec rawZ = Load(window.z + index);
+        MaskVec invalid = Or(Or(Greater(Abs(rawX), accValid), Greater(Abs(rawY), accValid)),
+            Greater(Abs(rawZ), accValid));
+        LaneVerdicts lanes = laneJudge(rawY, rawX, Neg(rawZ));
+        MaskVec skip = Or(lanes.skip, invalid);
+        // All ones reads as VERDICT_SKIP, one as VERDICT_IN and zero as VERDICT_OUT.
+        uint32_t laneVerdicts[N_LANES];
+        Store(Or(skip, And(lanes.in, Bits(VERDICT_IN))), laneVerdicts);
+        for (size_t lane = 0; lane < N_LANES; ++lane) {
+            verdicts[index + lane] = static_cast<SampleVerdict>(static_cast<int32_t>(laneVerdicts[lane]));
+        }
+        MaskVec pending = Not(Or(skip, lanes.decided));
+        if (!AnyLane(pending)) {
+            continue;
+        }
+        uint32_t pendingLanes[N_LANES];
+        Store(pending, pendingLanes);
+        for (size_t lane = 0; lane < N_LANES; ++lane) {
+            if (pendingLanes[lane] != 0) {
+                verdicts[index + lane] = JudgeSample(window, index + lane, judge);
+            }
+        }
+    }
+    return index;
+}
+#endif // ALGO_KERNEL_VECTOR
+
+bool CheckWindow(const AccelWindow &window, SampleVerdict *verdicts)
+{
+    CHKPF(window.x);
+    CHKPF(window.y);
+    CHKPF(window.z);
+    CHKPF(verdicts);
+    return true;
+}
+} // namespace
+
+SampleVerdict AlgoKernel::JudgeAbsoluteStill(float x, float y, float z)
+{
+    double resultantAcc = std::sqrt((x * x) + (y * y) + (z * z));
+    return (IsBetween(resultantAcc, RESULTANT_ACC_LOW_THRHD, RESULTANT_ACC_UP_THRHD) ? VERDICT_IN : VERDICT_OUT);
+}
+
+SampleVerdict AlgoKernel::JudgeHorizontal(float x, float y, float z)
+{
+    double pitch = std::abs(-std::atan2(y, z) * (ANGLE_180_DEGREE / PI));
+    double roll = std::abs(std::atan2(x, z) * (ANGLE_180_DEGREE / PI));
+    if ((IsBetween(pitch, ANGLE_HOR_LOW_THRHD, ANGLE_HOR_UP_THRHD) &&
+        IsBetween(roll, ANGLE_HOR_LOW_THRHD, ANGLE_HOR_UP_THRHD)) ||
+        (IsBetween(pitch, 0, ANGLE_HOR_FLIPPED_THRHD) && IsBetween(roll, 0, ANGLE_VER_FLIPPED_THRHD))) {
+        return VERDICT_IN;
+    }
+    return VERDICT_OUT;
+}
+
+SampleVerdict AlgoKernel::JudgeVertical(float x, float y, float z)
+{
+    if ((std::abs(y) <= JUDGE_FLOAT) && (std::abs(z) <= JUDGE_FLOAT)) {
+        return VERDICT_SKIP;
+    }
+    double pitch = std::abs(-std::atan2(y, z) * (ANGLE_180_DEGREE / PI));
+    double roll = std::abs(std::atan2(x, z) * (ANGLE_180_DEGREE / PI));
+    if (IsBetween(pitch, ANGLE_VER_LOW_THRHD, ANGLE_VER_UP_THRHD) ||
+        IsBetween(roll, ANGLE_VER_LOW_THRHD, ANGLE_VER_UP_THRHD)) {
+        return VERDICT_IN;
+    }
+    return VERDICT_OUT;
+}
+
+void AlgoKernel::JudgeAbsoluteStill(const AccelWindow &window, SampleVerdict *verdicts)
+{
+    if (!CheckWindow(window, verdicts)) {
+        return;
+    }
+    size_t index = 0;
+#ifdef ALGO_KERNEL_VECTOR
+    index = JudgeLanes(window, verdicts, &JudgeAbsoluteStillLanes, &AlgoKernel::JudgeAbsoluteStill);
+#endif // ALGO_KERNEL_VECTOR
+    for (; index < window.count; ++index) {
+        verdicts[index] = JudgeSample(window, index, &AlgoKernel::JudgeAbsoluteStill);
+    }
+}
+
+void AlgoKernel::JudgeHorizontal(const AccelWindow &window, SampleVerdict *verdicts)
+{
+    if (!CheckWindow(window, verdicts)) {
+        return;
+    }
+    size_t index = 0;
+#ifdef ALGO_KERNEL_VECTOR
+    index = JudgeLanes(window, verdicts, &JudgeHorizontalLanes, &AlgoKernel::JudgeHorizontal);
+#endif // ALGO_KERNEL_VECTOR
+    for (; index < window.count; ++index) {
+        verdicts[index] = JudgeSample(window, index, &AlgoKernel::JudgeHorizontal);
+    }
+}
+
+void AlgoKernel::JudgeVertical(const AccelWindow &window, SampleVerdict *verdicts)
+{
+    if (!CheckWindow(window, verdicts)) {
+        return;
+    }
+    size_t index = 0;
+#ifdef ALGO_KERNEL_VECTOR
+    index = JudgeLanes(window, verdicts, &JudgeVerticalLanes, &AlgoKernel::JudgeVertical);
+#endif // ALGO_KERNEL_VECTOR
+    for (; index < window.count; ++index) {
+        verdicts[index] = JudgeSample(window, index, &AlgoKernel::JudgeVertical);
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
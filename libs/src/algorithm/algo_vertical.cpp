@@ -24,10 +24,6 @@
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
-namespace {
-constexpr float JUDGE_FLOAT { 1e-6 };
-} // namespace
-
 bool AlgoVertical::Init(Type type)
 {
     CALL_DEBUG_ENTER;
@@ -35,7 +31,7 @@ bool AlgoVertical::Init(Type type)
         return this->StartAlgorithm(sensorTypeId, sensorData);
     };
     CHKPF(algoCallback_);
-    SENSOR_DATA_CB.SubscribeSensorEvent(type, algoCallback_);
+    Subscribe(type);
     return true;
 }
 
@@ -53,30 +49,17 @@ bool AlgoVertical::StartAlgorithm(int32_t sensorTypeId, AccelData* sensorData)
 void AlgoVertical::ExecuteOperation()
 {
     CALL_DEBUG_ENTER;
-    if ((abs(algoPara_.y) <= JUDGE_FLOAT) && (abs(algoPara_.z) <= JUDGE_FLOAT)) {
-        return;
-    }
-    algoPara_.pitch = -atan2(algoPara_.y, algoPara_.z) * (ANGLE_180_DEGREE / PI);
-    algoPara_.roll = atan2(algoPara_.x, algoPara_.z) * (ANGLE_180_DEGREE / PI);
-    FI_HILOGD("pitch:%{public}f, roll:%{public}f", algoPara_.pitch, algoPara_.roll);
+    ApplyVerdict(AlgoKernel::JudgeVertical(algoPara_.x, algoPara_.y, algoPara_.z));
+}
 
-    if (((abs(algoPara_.pitch) > ANGLE_VER_LOW_THRHD) && (abs(algoPara_.pitch) < ANGLE_VER_UP_THRHD)) ||
-        ((abs(algoPara_.roll) > ANGLE_VER_LOW_THRHD) && (abs(algoPara_.roll) < ANGLE_VER_UP_THRHD))) {
-        if (state_ == VERTICAL) {
-            return;
-        }
-        counter_--;
-        if (counter_ == 0) {
-            counter_ = COUNTER_THRESHOLD;
-            UpdateStateAndReport(VALUE_ENTER, VERTICAL, TYPE_VERTICAL_POSITION);
-        }
-    } else {
-        counter_ = COUNTER_THRESHOLD;
-        if (state_ == NON_VERTICAL) {
-            return;
-        }
-        UpdateStateAndReport(VALUE_EXIT, NON_VERTICAL, TYPE_VERTICAL_POSITION);
-    }
+void AlgoVertical::JudgeWindow(const AccelWindow &window, SampleVerdict *verdicts)
+{
+    AlgoKernel::JudgeVertical(window, verdicts);
+}
+
+void AlgoVertical::ApplyVerdict(SampleVerdict verdict)
+{
+    UpdateState(verdict, VERTICAL, NON_VERTICAL, TYPE_VERTICAL_POSITION);
 }
 } // namespace DeviceStatus
 } // namespace Msdp
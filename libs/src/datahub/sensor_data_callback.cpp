@@ -30,12 +30,17 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace {
 constexpr int32_t RATE_MILLISEC { 100100100 };
+constexpr size_t MAX_BATCH_SIZE { 16 };
+thread_local bool g_onAlgorithmThread { false };
 } // namespace
 
 SensorDataCallback::SensorDataCallback() {}
 SensorDataCallback::~SensorDataCallback()
 {
-    algoMap_.clear();
+    {
+        std::lock_guard lock(callbackMutex_);
+        subscribers_ = std::make_shared<Subscribers>();
+    }
     alive_ = false;
     CHKPV(algorithmThread_);
     if (!algorithmThread_->joinable()) {
@@ -44,7 +49,6 @@ SensorDataCallback::~SensorDataCallback()
     }
     sem_post(&sem_);
     algorithmThread_->join();
-    accelDataList_.clear();
 }
 
 void SensorDataCallback::Init()
@@ -85,34 +89,88 @@ bool SensorDataCallback::Unregister()
 bool SensorDataCallback::SubscribeSensorEvent(int32_t sensorTypeId, SensorCallback callback)
 {
     CALL_DEBUG_ENTER;
+    Subscriber subscriber;
+    subscriber.callback = callback;
+    return AddSubscriber(sensorTypeId, subscriber);
+}
+
+bool SensorDataCallback::SubscribeSensorBatch(int32_t sensorTypeId, SensorBatchCallback callback)
+{
+    CALL_DEBUG_ENTER;
+    Subscriber subscriber;
+    subscriber.batchCallback = callback;
+    return AddSubscriber(sensorTypeId, subscriber);
+}
+
+bool SensorDataCallback::AddSubscriber(int32_t sensorTypeId, const Subscriber &subscriber)
+{
     std::lock_guard lock(callbackMutex_);
-    auto ret = algoMap_.insert(std::pair(sensorTypeId, callback));
-    if (ret.second) {
-        return true;
+    if (subscribers_->find(sensorTypeId) != subscribers_->end()) {
+        FI_HILOGE("SensorCallback is duplicated");
+        return false;
     }
-    FI_HILOGE("SensorCallback is duplicated");
-    return false;
+    auto subscribers = std::make_shared<Subscribers>(*subscribers_);
+    subscribers->emplace(sensorTypeId, subscriber);
+    subscribers_ = subscribers;
+    return true;
 }
 
 bool SensorDataCallback::UnsubscribeSensorEvent(int32_t sensorTypeId, SensorCallback callback)
 {
     CALL_DEBUG_ENTER;
-    std::lock_guard lock(callbackMutex_);
-    auto callbackIter = algoMap_.find(sensorTypeId);
-    if (callbackIter != algoMap_.end()) {
+    {
+        std::lock_guard lock(callbackMutex_);
+        if (subscribers_->find(sensorTypeId) == subscribers_->end()) {
+            return true;
+        }
         FI_HILOGE("Erase sensorTypeId:%{public}d", sensorTypeId);
-        algoMap_.erase(callbackIter);
+        auto subscribers = std::make_shared<Subscribers>(*subscribers_);
+        subscribers->erase(sensorTypeId);
+        subscribers_ = subscribers;
     }
+    // Callers free the subscriber right after this returns, so make sure the
+    // algorithm thread is not still running it from an older snapshot.
+    WaitForDispatch();
     return true;
 }
 
-bool SensorDataCallback::NotifyCallback(int32_t sensorTypeId, AccelData* data)
+void SensorDataCallback::WaitForDispatch()
+{
+    if (g_onAlgorithmThread) {
+        return;
+    }
+    uint32_t seq = dispatchSeq_.load(std::memory_order_acquire);
+    if ((seq & 1U) == 0) {
+        return;
+    }
+    while (dispatchSeq_.load(std::memory_order_acquire) == seq) {
+        std::this_thread::yield();
+    }
+}
+
+bool SensorDataCallback::NotifyCallback(int32_t sensorTypeId, AccelData* data, size_t count)
 {
     CHKPF(data);
-    std::lock_guard lock(callbackMutex_);
-    for (auto iter = algoMap_.begin(); iter != algoMap_.end(); ++iter) {
-        (iter->second)(sensorTypeId, data);
+    // Mark the dispatch before taking the snapshot, see WaitForDispatch().
+    dispatchSeq_.fetch_add(1);
+    std::shared_ptr<const Subscribers> subscribers;
+    {
+        std::lock_guard lock(callbackMutex_);
+        subscribers = subscribers_;
+    }
+    for (const auto &[type, subscriber] : *subscribers) {
+        if (subscriber.batchCallback != nullptr) {
+            subscriber.batchCallback(sensorTypeId, data, count);
+            continue;
+        }
+        if (subscriber.callback == nullptr) {
+            continue;
+        }
+        for (size_t index = 0; index < count; ++index) {
+            subscriber.callback(sensorTypeId, &data[index]);
+        }
     }
+    dispatchSeq_.fetch_add(1, std::memory_order_release);
     return true;
 }
 
@@ -128,31 +186,22 @@ bool SensorDataCallback::PushData(int32_t sensorTypeId, uint8_t* data)
         return false;
     }
     {
+        // Only serializes producers, the algorithm thread drains the ring without it.
         std::lock_guard lock(dataMutex_);
-        accelDataList_.emplace_back(*acclData);
+        if (!accelRing_.Push(*acclData)) {
+            nDropped_.fetch_add(1, std::memory_order_relaxed);
+            FI_HILOGD("Accel ring is full, drop data");
+            return false;
+        }
         FI_HILOGD("ACCEL pushData:x:%{public}f, y:%{public}f, z:%{public}f, PushData sensorTypeId:%{public}d",
             acclData->x, acclData->y, acclData->z, sensorTypeId);
     }
-    sem_post(&sem_);
-    return true;
-}
-
-bool SensorDataCallback::PopData(int32_t sensorTypeId, AccelData& data)
-{
-    CALL_DEBUG_ENTER;
-    if (sensorTypeId != SENSOR_TYPE_ID_ACCELEROMETER) {
-        FI_HILOGE("Invalid sensorTypeId:%{public}d", sensorTypeId);
-        return false;
-    }
-    std::lock_guard lock(dataMutex_);
-    if (accelDataList_.empty()) {
-        FI_HILOGE("No accel data");
-        return false;
+    // Wake the algorithm thread only when it is about to sleep, samples that
+    // arrive while it is draining are picked up by the same wakeup.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_.exchange(false)) {
+        sem_post(&sem_);
     }
-    data = accelDataList_.front();
-    accelDataList_.pop_front();
-    FI_HILOGD("ACCEL popData:x:%{public}f, y:%{public}f, z:%{public}f, PopData sensorTypeId:%{public}d",
-        data.x, data.y, data.z, sensorTypeId);
     return true;
 }
 
@@ -208,18 +257,33 @@ void SensorDataCallback::AlgorithmLoop()
 {
     SetThreadName(std::string("os_loop_sensor"));
     CALL_DEBUG_ENTER;
+    g_onAlgorithmThread = true;
     while (alive_) {
-        sem_wait(&sem_);
         HandleSensorEvent();
+        WaitForData();
+    }
+}
+
+void SensorDataCallback::WaitForData()
+{
+    idle_.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    // If data raced in, either take the idle flag back ourselves or absorb the
+    // post of the producer that already took it.
+    if (accelRing_.IsEmpty() || !idle_.exchange(false)) {
+        sem_wait(&sem_);
+        nWakeups_.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
 void SensorDataCallback::HandleSensorEvent()
 {
     CALL_DEBUG_ENTER;
-    AccelData acclData;
-    if (PopData(SENSOR_TYPE_ID_ACCELEROMETER, acclData)) {
-        NotifyCallback(SENSOR_TYPE_ID_ACCELEROMETER, static_cast<AccelData*>(&acclData));
+    AccelData batch[MAX_BATCH_SIZE];
+    size_t count = accelRing_.Pop(batch, MAX_BATCH_SIZE);
+    while ((count > 0) && alive_) {
+        NotifyCallback(SENSOR_TYPE_ID_ACCELEROMETER, batch, count);
+        count = accelRing_.Pop(batch, MAX_BATCH_SIZE);
     }
 }
 } // namespace DeviceStatus
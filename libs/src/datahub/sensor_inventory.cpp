@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+#include "sensor_inventory.h"
+
+#include "devicestatus_define.h"
+#include "sensor_data_callback.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorInventory"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+
+bool SensorAgentProvider::GetSensorTypeIds(std::vector<int32_t> &sensorTypeIds)
+{
+    int32_t count = -1;
+    SensorInfo *sensorInfo = nullptr;
+    int32_t ret = GetAllSensors(&sensorInfo, &count);
+    if (ret != 0) {
+        FI_HILOGE("Get all sensors failed");
+        return false;
+    }
+    CHKPF(sensorInfo);
+    SensorInfo *pt = sensorInfo + count;
+    for (SensorInfo *ps = sensorInfo; ps < pt; ++ps) {
+        sensorTypeIds.push_back(ps->sensorTypeId);
+    }
+    return true;
+}
+
+bool SensorAgentProvider::ActivateSensor(int32_t sensorTypeId)
+{
+    SENSOR_DATA_CB.Init();
+    return SENSOR_DATA_CB.RegisterCallbackSensor(sensorTypeId);
+}
+
+bool SensorAgentProvider::DeactivateSensor(int32_t sensorTypeId)
+{
+    return SENSOR_DATA_CB.UnregisterCallbackSensor(sensorTypeId);
+}
+
+SensorInventory::SensorInventory(std::shared_ptr<ISensorProvider> provider)
+    : provider_(provider)
+{}
+
+bool SensorInventory::HasSensor(int32_t sensorTypeId)
+{
+    std::lock_guard lock(mutex_);
+    if (!loaded_ && !LoadSensorTypeIds()) {
+        return false;
+    }
+    if (sensorTypeIds_.find(sensorTypeId) == sensorTypeIds_.end()) {
+        FI_HILOGE("No sensor of sensorTypeId:%{public}d", sensorTypeId);
+        return false;
+    }
+    return true;
+}
+
+bool SensorInventory::LoadSensorTypeIds()
+{
+    CHKPF(provider_);
+    std::vector<int32_t> sensorTypeIds;
+    if (!provider_->GetSensorTypeIds(sensorTypeIds)) {
+        FI_HILOGE("Failed to get sensors");
+        return false;
+    }
+    sensorTypeIds_ = std::set<int32_t>(sensorTypeIds.begin(), sensorTypeIds.end());
+    loaded_ = true;
+    FI_HILOGI("Loaded %{public}zu sensor types", sensorTypeIds_.size());
+    return true;
+}
+
+bool SensorInventory::Acquire(int32_t sensorTypeId)
+{
+    std::lock_guard lock(mutex_);
+    CHKPF(provider_);
+    if (auto iter = refCounts_.find(sensorTypeId); iter != refCounts_.end()) {
+        ++iter->second;
+        return true;
+    }
+    if (!provider_->ActivateSensor(sensorTypeId)) {
+        FI_HILOGE("Failed to activate sensorTypeId:%{public}d", sensorTypeId);
+        // The sensor may have gone away without a plug event reaching us.
+        loaded_ = false;
+        return false;
+    }
+    refCounts_.emplace(sensorTypeId, 1);
+    return true;
+}
+
+bool SensorInventory::Release(int32_t sensorTypeId)
+{
+    std::lock_guard lock(mutex_);
+    CHKPF(provider_);
+    auto iter = refCounts_.find(sensorTypeId);
+    if (iter == refCounts_.end()) {
+        FI_HILOGE("SensorTypeId:%{public}d is not active", sensorTypeId);
+        return false;
+    }
+    if (--iter->second > 0) {
+        return true;
+    }
+    refCounts_.erase(iter);
+    if (!provider_->DeactivateSensor(sensorTypeId)) {
+        FI_HILOGE("Failed to deactivate sensorTypeId:%{public}d", sensorTypeId);
+        return false;
+    }
+    return true;
+}
+
+void SensorInventory::OnSensorPlug()
+{
+    std::lock_guard lock(mutex_);
+    FI_HILOGI("Sensor plugged, drop the cached inventory");
+    loaded_ = false;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DEVICE_STATUS_SENSOR_ENABLE
\ No newline at end of file
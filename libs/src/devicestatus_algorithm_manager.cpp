@@ -34,6 +34,10 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 
+AlgoMgr::AlgoMgr() : AlgoMgr(std::make_shared<SensorAgentProvider>()) {}
+
+AlgoMgr::AlgoMgr(std::shared_ptr<ISensorProvider> sensorProvider) : sensors_(sensorProvider) {}
+
 bool AlgoMgr::StartSensor(Type type)
 {
     CALL_DEBUG_ENTER;
@@ -46,9 +50,7 @@ bool AlgoMgr::StartSensor(Type type)
         FI_HILOGE("Sensor type mismatch");
         return false;
     }
-
-    SENSOR_DATA_CB.Init();
-    if (!SENSOR_DATA_CB.RegisterCallbackSensor(sensorType)) {
+    if (!sensors_.Acquire(sensorType)) {
         FI_HILOGE("Failed to register callback sensor");
         return false;
     }
@@ -95,22 +97,13 @@ ErrCode AlgoMgr::UnregisterCallback()
 
 bool AlgoMgr::CheckSensorTypeId(int32_t sensorTypeId)
 {
-    int32_t count = -1;
-    SensorInfo *sensorInfo = nullptr;
-    int32_t ret = GetAllSensors(&sensorInfo, &count);
-    if (ret != 0) {
-        FI_HILOGE("Get all sensors failed");
-        return false;
-    }
-    SensorInfo *pt = sensorInfo + count;
-    for (SensorInfo *ps = sensorInfo; ps < pt; ++ps) {
-        if (ps->sensorTypeId == sensorTypeId) {
-            FI_HILOGI("Get sensor sensorTypeId: %{public}d", sensorTypeId);
-            return true;
-        }
-    }
-    FI_HILOGE("Get sensor failed");
-    return false;
+    return sensors_.HasSensor(sensorTypeId);
+}
+
+void AlgoMgr::OnSensorPlug()
+{
+    CALL_DEBUG_ENTER;
+    sensors_.OnSensorPlug();
 }
 
 int32_t AlgoMgr::GetSensorTypeId(Type type)
@@ -137,16 +130,23 @@ int32_t AlgoMgr::GetSensorTypeId(Type type)
 ErrCode AlgoMgr::Enable(Type type)
 {
     CALL_DEBUG_ENTER;
+    std::lock_guard lock(mutex_);
+    // The sensor is already shared with this type, only count the caller.
+    if (auto iter = callAlgoNums_.find(type); (iter != callAlgoNums_.end()) && (iter->second > 0)) {
+        iter->second++;
+        algoType_ = type;
+        return RET_OK;
+    }
     if (!StartSensor(type)) {
         FI_HILOGE("sensor init failed");
         return RET_ERR;
     }
-    std::lock_guard lock(mutex_);
     switch (type) {
         case Type::TYPE_ABSOLUTE_STILL: {
             if (still_ == nullptr) {
                 FI_HILOGE("still_ is nullptr");
                 still_ = std::make_shared<AlgoAbsoluteStill>();
+                still_->SetBatchMode(true);
                 still_->Init(type);
                 callAlgoNums_[type] = 0;
             }
@@ -157,6 +157,7 @@ ErrCode AlgoMgr::Enable(Type type)
             if (horizontalPosition_ == nullptr) {
                 FI_HILOGE("horizontalPosition_ is nullptr");
                 horizontalPosition_ = std::make_shared<AlgoHorizontal>();
+                horizontalPosition_->SetBatchMode(true);
                 horizontalPosition_->Init(type);
                 callAlgoNums_[type] = 0;
             }
@@ -167,6 +168,7 @@ ErrCode AlgoMgr::Enable(Type type)
             if (verticalPosition_ == nullptr) {
                 FI_HILOGE("verticalPosition_ is nullptr");
                 verticalPosition_ = std::make_shared<AlgoVertical>();
+                verticalPosition_->SetBatchMode(true);
                 verticalPosition_->Init(type);
                 callAlgoNums_[type] = 0;
             }
@@ -241,7 +243,7 @@ ErrCode AlgoMgr::UnregisterSensor(Type type)
         FI_HILOGE("Failed to get sensorType");
         return false;
     }
-    if (!SENSOR_DATA_CB.UnregisterCallbackSensor(sensorType)) {
+    if (!sensors_.Release(sensorType)) {
         FI_HILOGE("Failed to unregister callback sensor");
         return false;
     }
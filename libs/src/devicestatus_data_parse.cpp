@@ -15,16 +15,18 @@
 
 #include "devicestatus_data_parse.h"
 
+#include <climits>
+
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 #include "devicestatus_data_define.h"
 #include "devicestatus_errors.h"
 #include "fi_log.h"
 #include "json_parser.h"
-#include "utility.h"
 
 #undef LOG_TAG
 #define LOG_TAG "DeviceStatusDataParse"
@@ -34,15 +36,11 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace {
 constexpr int32_t FILE_SIZE_MAX { 0x5000 };
-constexpr int32_t READ_DATA_BUFF_SIZE { 256 };
 const std::string MSDP_DATA_PATH { "/data/msdp/device_status_data.json" };
 const std::string MSDP_DATA_DIR { "/data/msdp" };
 constexpr uint64_t DOMAIN_ID { 0xD002220 };
 } // namespace
 
-std::vector<int32_t> DeviceStatusDataParse::tempcount_ =
-    std::vector<int32_t> (static_cast<int32_t>(Type::TYPE_MAX), static_cast<int32_t>(TypeValue::INVALID));
-
 int32_t DeviceStatusDataParse::CreateJsonFile()
 {
     int32_t fd = open(MSDP_DATA_PATH.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP);
@@ -68,111 +66,165 @@ int32_t DeviceStatusDataParse::CreateJsonFile()
 
 bool DeviceStatusDataParse::ParseDeviceStatusData(Type type, Data& data)
 {
-    std::string jsonBuf = ReadJsonFile(MSDP_DATA_PATH.c_str());
-    if (jsonBuf.empty()) {
+    data.type = type;
+    data.value = OnChangedValue::VALUE_INVALID;
+    std::lock_guard guard(mutex_);
+    if (!UpdateMockData(MSDP_DATA_PATH)) {
         FI_HILOGE("Read json failed, errno:%{public}d", errno);
-        data.type = type;
-        data.value = OnChangedValue::VALUE_INVALID;
         return false;
     }
-    return DeviceStatusDataInit(jsonBuf, true, type, data);
+    return GetNextValue(*mockData_, type, data);
 }
 
 bool DeviceStatusDataParse::DeviceStatusDataInit(const std::string& fileData, bool logStatus, Type& type,
     Data& data)
 {
     CALL_DEBUG_ENTER;
-    JsonParser parser(fileData.c_str());
     data.type = type;
     data.value = OnChangedValue::VALUE_INVALID;
-    if (cJSON_IsArray(parser.Get())) {
-        FI_HILOGE("parser is array");
-        return false;
-    }
-
-    if (type < Type::TYPE_ABSOLUTE_STILL || type >= Type::TYPE_MAX) {
-        FI_HILOGE("type error");
-        return false;
-    }
-
-    cJSON* mockarray = cJSON_GetObjectItem(parser.Get(), DeviceStatusJson[type].json.c_str());
-    if (!cJSON_IsArray(mockarray)) {
-        FI_HILOGE("mockarray is not array");
-        return false;
-    }
-    int32_t jsonsize = cJSON_GetArraySize(mockarray);
-    if (jsonsize == 0) {
-        FI_HILOGE("Json size is zero");
-        return false;
-    }
-    tempcount_[type] = tempcount_[type] % jsonsize;
-    cJSON* mockvalue = cJSON_GetArrayItem(mockarray, tempcount_[type]);
-    tempcount_[type]++;
-    data.type = type;
-    if (mockvalue == nullptr || !cJSON_IsNumber(mockvalue)) {
-        FI_HILOGE("Json parser number is failed");
+    MockData mockData;
+    if (!ParseMockData(fileData.c_str(), fileData.size(), mockData)) {
         return false;
     }
-    data.value = static_cast<OnChangedValue>(mockvalue->valueint);
-    FI_HILOGD("type:%{public}d, status:%{public}d", data.type, data.value);
-    return true;
+    std::lock_guard guard(mutex_);
+    return GetNextValue(mockData, type, data);
 }
 
 bool DeviceStatusDataParse::DisableCount(const Type type)
 {
     CALL_DEBUG_ENTER;
-    if (tempcount_.size() <= static_cast<size_t>(type)) {
-        FI_HILOGE("The index is out of bounds, size is %{public}zu", tempcount_.size());
+    std::lock_guard guard(mutex_);
+    if (cursors_.size() <= static_cast<size_t>(type)) {
+        FI_HILOGE("The index is out of bounds, size is %{public}zu", cursors_.size());
         return false;
     }
-    tempcount_[static_cast<int32_t>(type)] = static_cast<int32_t>(TypeValue::INVALID);
+    cursors_[type] = 0;
     return true;
 }
 
-std::string DeviceStatusDataParse::ReadJsonFile(const std::string &filePath)
+bool DeviceStatusDataParse::UpdateMockData(const std::string &filePath)
 {
-    if (filePath.empty()) {
-        FI_HILOGE("Path is empty");
-        return {};
+    struct stat statBuf {};
+    if (stat(filePath.c_str(), &statBuf) != 0) {
+        FI_HILOGE("File not exist");
+        mockData_ = nullptr;
+        return false;
     }
+    if ((mockData_ != nullptr) && IsSameFile(*mockData_, statBuf)) {
+        return true;
+    }
+    mockData_ = LoadMockData(filePath);
+    return (mockData_ != nullptr);
+}
+
+std::unique_ptr<DeviceStatusDataParse::MockData> DeviceStatusDataParse::LoadMockData(const std::string &filePath)
+{
+    CALL_DEBUG_ENTER;
     char realPath[PATH_MAX] = { 0 };
     if (realpath(filePath.c_str(), realPath) == nullptr) {
         FI_HILOGE("Path is error, %{public}d", errno);
-        return {};
+        return nullptr;
     }
     if (!CheckFileDir(realPath, MSDP_DATA_DIR)) {
         FI_HILOGE("File dir is invalid");
-        return {};
+        return nullptr;
     }
     if (!CheckFileExtendName(realPath, "json")) {
         FI_HILOGE("Unable to parse files other than json format");
-        return {};
+        return nullptr;
     }
-    if (!Utility::DoesFileExist(filePath.c_str())) {
-        FI_HILOGE("File not exist");
-        return {};
+    int32_t fd = open(realPath, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        FI_HILOGE("Open failed, errno:%{public}d", errno);
+        return nullptr;
     }
-    if (!CheckFileSize(filePath)) {
+    fdsan_exchange_owner_tag(fd, 0, DOMAIN_ID);
+    auto mockData = std::make_unique<MockData>();
+    struct stat statBuf {};
+    void *addr = MAP_FAILED;
+    if ((fstat(fd, &statBuf) != 0) || (statBuf.st_size <= 0) || (statBuf.st_size > FILE_SIZE_MAX)) {
         FI_HILOGE("File size out of read range");
-        return {};
+    } else {
+        addr = mmap(nullptr, static_cast<size_t>(statBuf.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
     }
-    return ReadFile(realPath);
+    fdsan_close_with_tag(fd, DOMAIN_ID);
+    if (addr == MAP_FAILED) {
+        return nullptr;
+    }
+    mockData->dev = statBuf.st_dev;
+    mockData->ino = statBuf.st_ino;
+    mockData->size = statBuf.st_size;
+    mockData->mtime = statBuf.st_mtim;
+    // A file that does not parse is remembered as well, with no values, so
+    // that it is not parsed again until it changes.
+    if (!ParseMockData(static_cast<const char *>(addr), static_cast<size_t>(statBuf.st_size), *mockData)) {
+        FI_HILOGE("Parse mock data failed");
+    }
+    if (munmap(addr, static_cast<size_t>(statBuf.st_size)) != 0) {
+        FI_HILOGW("Unmap file failed, errno:%{public}d", errno);
+    }
+    return mockData;
 }
 
-bool DeviceStatusDataParse::CheckFileDir(const std::string& filePath, const std::string& dir)
+bool DeviceStatusDataParse::ParseMockData(const char *json, size_t jsonLen, MockData &mockData)
 {
-    if (filePath.compare(0, MSDP_DATA_DIR.size(), MSDP_DATA_DIR) != 0) {
-        FI_HILOGE("FilePath dir is invalid");
+    JsonParser parser(json, jsonLen);
+    if ((parser.Get() == nullptr) || cJSON_IsArray(parser.Get())) {
+        FI_HILOGE("parser is not object");
         return false;
     }
+    for (int32_t type = Type::TYPE_ABSOLUTE_STILL; type < Type::TYPE_MAX; ++type) {
+        cJSON* mockarray = cJSON_GetObjectItem(parser.Get(), DeviceStatusJson[type].json.c_str());
+        if (!cJSON_IsArray(mockarray)) {
+            continue;
+        }
+        auto &values = mockData.values[type];
+        cJSON* mockvalue = nullptr;
+        cJSON_ArrayForEach(mockvalue, mockarray) {
+            if (cJSON_IsNumber(mockvalue)) {
+                values.emplace_back(mockvalue->valueint);
+            } else {
+                values.emplace_back(std::nullopt);
+            }
+        }
+    }
     return true;
 }
 
-bool DeviceStatusDataParse::CheckFileSize(const std::string& filePath)
+bool DeviceStatusDataParse::IsSameFile(const MockData &mockData, const struct stat &statBuf)
 {
-    int32_t fileSize = Utility::GetFileSize(filePath);
-    if ((fileSize <= 0) || (fileSize > FILE_SIZE_MAX)) {
-        FI_HILOGE("File size out of read range");
+    return ((mockData.dev == statBuf.st_dev) && (mockData.ino == statBuf.st_ino) &&
+        (mockData.size == statBuf.st_size) && (mockData.mtime.tv_sec == statBuf.st_mtim.tv_sec) &&
+        (mockData.mtime.tv_nsec == statBuf.st_mtim.tv_nsec));
+}
+
+bool DeviceStatusDataParse::GetNextValue(const MockData &mockData, Type type, Data &data)
+{
+    if (type < Type::TYPE_ABSOLUTE_STILL || type >= Type::TYPE_MAX) {
+        FI_HILOGE("type error");
+        return false;
+    }
+    const auto &values = mockData.values[type];
+    if (values.empty()) {
+        FI_HILOGE("mockarray of type:%{public}d is empty", type);
+        return false;
+    }
+    uint32_t &cursor = cursors_[type];
+    cursor = cursor % values.size();
+    const auto &mockvalue = values[cursor++];
+    if (!mockvalue.has_value()) {
+        FI_HILOGE("Json parser number is failed");
+        return false;
+    }
+    data.value = static_cast<OnChangedValue>(*mockvalue);
+    FI_HILOGD("type:%{public}d, status:%{public}d", data.type, data.value);
+    return true;
+}
+
+bool DeviceStatusDataParse::CheckFileDir(const std::string& filePath, const std::string& dir)
+{
+    if (filePath.compare(0, MSDP_DATA_DIR.size(), MSDP_DATA_DIR) != 0) {
+        FI_HILOGE("FilePath dir is invalid");
         return false;
     }
     return true;
@@ -187,25 +239,6 @@ bool DeviceStatusDataParse::CheckFileExtendName(const std::string& filePath, con
     }
     return (filePath.substr(pos + 1, filePath.npos) == checkExtension);
 }
-
-std::string DeviceStatusDataParse::ReadFile(const std::string &filePath)
-{
-    CALL_DEBUG_ENTER;
-    FILE* fp = fopen(filePath.c_str(), "r");
-    if (fp == nullptr) {
-        FI_HILOGE("Open failed");
-        return {};
-    }
-    std::string dataStr;
-    char buf[READ_DATA_BUFF_SIZE] = { 0 };
-    while (fgets(buf, sizeof(buf), fp) != nullptr) {
-        dataStr += buf;
-    }
-    if (fclose(fp) != 0) {
-        FI_HILOGW("Close file failed");
-    }
-    return dataStr;
-}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
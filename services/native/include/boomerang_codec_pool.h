@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BOOMERANG_CODEC_POOL_H
+#define BOOMERANG_CODEC_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "devicestatus_napi_manager.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+inline constexpr size_t DEFAULT_CODEC_WORKERS { 2 };
+inline constexpr size_t DEFAULT_CODEC_QUEUE_CAPACITY { 8 };
+inline constexpr size_t DEFAULT_MAX_CONCURRENT_CODEC_CALLS { 2 };
+
+struct BoomerangCodecPoolOptions {
+    size_t nWorkers { DEFAULT_CODEC_WORKERS };
+    // Jobs waiting for a worker; submissions beyond this are rejected.
+    size_t queueCapacity { DEFAULT_CODEC_QUEUE_CAPACITY };
+    // Codec calls allowed to run at the same time, counting both workers and
+    // callers of Decode().
+    size_t maxConcurrentCalls { DEFAULT_MAX_CONCURRENT_CODEC_CALLS };
+};
+
+struct BoomerangCodecPoolMetrics {
+    size_t depth { 0 };
+    size_t peakDepth { 0 };
+    size_t peakRunning { 0 };
+    uint64_t nSubmitted { 0 };
+    uint64_t nCompleted { 0 };
+    uint64_t nRejected { 0 };
+    // Time from submitting a job until its result is handed to the caller.
+    int64_t lastLatencyUs { 0 };
+    int64_t maxLatencyUs { 0 };
+    int64_t avgLatencyUs { 0 };
+};
+
+// Runs boomerang image encoding and decoding on a few worker threads, so that
+// a large pixel map occupies a worker instead of the thread that submitted it.
+// Results are handed to the completion of each job on the worker thread.
+class BoomerangCodecPool final {
+public:
+    using EncodeDone = std::function<void(std::shared_ptr<Media::PixelMap> resultPixelMap)>;
+    using DecodeDone = std::function<void(const std::string &metadata)>;
+
+    explicit BoomerangCodecPool(const BoomerangCodec &codec, const BoomerangCodecPoolOptions &options = {});
+    ~BoomerangCodecPool();
+    DISALLOW_COPY_AND_MOVE(BoomerangCodecPool);
+
+    int32_t SubmitEncode(std::shared_ptr<Media::PixelMap> pixelMap, const std::string &metadata, EncodeDone done);
+    int32_t SubmitDecode(std::shared_ptr<Media::PixelMap> pixelMap, DecodeDone done);
+    // Decodes on the calling thread, waiting for a free slot if the pool is
+    // already running as many codec calls as allowed.
+    void Decode(std::shared_ptr<Media::PixelMap> &pixelMap, std::string &metadata);
+    // Discards pending jobs and stops the workers once the jobs in hand are
+    // done. Does not wait for the workers.
+    void Stop();
+    BoomerangCodecPoolMetrics GetMetrics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Job {
+        std::shared_ptr<Media::PixelMap> pixelMap;
+        std::string metadata;
+        EncodeDone encodeDone;
+        DecodeDone decodeDone;
+        Clock::time_point submitTime;
+    };
+
+    int32_t Submit(Job &&job);
+    void Execute(Job &job);
+    void AcquireSlot();
+    void ReleaseSlot();
+    void OnCompleted(const Job &job);
+    void Run();
+
+private:
+    const BoomerangCodec codec_;
+    const BoomerangCodecPoolOptions options_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Job> jobs_;
+    bool stopping_ { false };
+    mutable std::mutex slotMutex_;
+    std::condition_variable slotCv_;
+    size_t nRunning_ { 0 };
+    size_t peakRunning_ { 0 };
+    BoomerangCodecPoolMetrics metrics_;
+    int64_t sumLatencyUs_ { 0 };
+    std::vector<std::thread> workers_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // BOOMERANG_CODEC_POOL_H
\ No newline at end of file
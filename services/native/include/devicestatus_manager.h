@@ -23,8 +23,10 @@
 #include <iostream>
 #include "accesstoken_kit.h"
 
+#include "boomerang_codec_pool.h"
 #include "boomerang_data.h"
 #include "devicestatus_msdp_client_impl.h"
+#include "devicestatus_notifier.h"
 #include "iremote_boomerang_callback.h"
 #include "iremote_dev_sta_callback.h"
 #include "stationary_data.h"
@@ -126,6 +128,7 @@ private:
 #ifdef BOOMERANG_ONESTEP
     int32_t GetFocuseWindowId(int32_t &windowId, std::string &bundleName);
 #endif
+    BoomerangCodecPool &GetCodecPool();
     int32_t GetBundleNameByCallback(std::string &bundleName);
     int32_t GetBundleNameByApplink(std::string &bundleName, const std::string &metadata);
 #ifdef BOOMERANG_ONESTEP
@@ -159,6 +162,9 @@ private:
     std::atomic<bool> hasSubmitted_ { false };
     static std::mutex g_mutex_;
     std::recursive_mutex countMutex_;
+    std::once_flag codecPoolFlag_;
+    std::unique_ptr<BoomerangCodecPool> codecPool_;
+    DeviceStatusNotifier notifier_;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
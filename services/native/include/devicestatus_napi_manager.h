@@ -16,6 +16,8 @@
 #ifndef DEVICESTATUS_NAPI_MANAGER_H
 #define DEVICESTATUS_NAPI_MANAGER_H
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include "pixel_map.h"
 
@@ -27,6 +29,11 @@ typedef void (*EncodeImageFunc)(std::shared_ptr<Media::PixelMap> &pixelMap, cons
                                 std::shared_ptr<Media::PixelMap> &resultPixelMap);
 typedef void (*DecodeImageFunc)(std::shared_ptr<Media::PixelMap> &pixelMap, std::string &content);
 
+struct BoomerangCodec {
+    EncodeImageFunc encode { nullptr };
+    DecodeImageFunc decode { nullptr };
+};
+
 class BoomerangAlgoManager {
 public:
     BoomerangAlgoManager() {};
@@ -34,7 +41,12 @@ public:
     static bool EncodeImage(std::shared_ptr<Media::PixelMap> &pixelMap, const std::string &content,
                             std::shared_ptr<Media::PixelMap> &resultPixelMap);
     static bool DecodeImage(std::shared_ptr<Media::PixelMap> &pixelMap, std::string &content);
+    // Loads the algorithm library on first success and keeps it resident.
+    static bool Load();
+    static BoomerangCodec GetCodec();
 private:
+    static std::mutex loadMutex_;
+    static std::atomic<bool> loaded_;
     static void *boomerangAlgoHandle_;
     static EncodeImageFunc boomerangAlgoEncodeImageHandle_;
     static DecodeImageFunc boomerangAlgoDecodeImageHandle_;
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DEVICESTATUS_NOTIFIER_H
+#define DEVICESTATUS_NOTIFIER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "iremote_dev_sta_callback.h"
+#include "stationary_data.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+inline constexpr size_t DEFAULT_NOTIFIER_WORKERS { 2 };
+inline constexpr size_t DEFAULT_LISTENER_QUEUE_DEPTH { 16 };
+
+struct ListenerMetrics {
+    size_t depth { 0 };
+    uint64_t nDelivered { 0 };
+    uint64_t nDropped { 0 };
+    // Time from posting a change until the callback of the client returns.
+    int64_t lastLatencyUs { 0 };
+    int64_t maxLatencyUs { 0 };
+    int64_t avgLatencyUs { 0 };
+};
+
+// Fans device status changes out to subscribed clients.
+//
+// Subscribers of each type are published as an immutable snapshot, so that
+// Notify() only loads a pointer. Every client has its own bounded queue,
+// drained by a few delivery workers with no lock held across the remote
+// call; a slow client backs up its own queue and nobody else's. A client
+// whose remote object has died, or whose queue keeps overflowing, is handed
+// to the stale handler to be unsubscribed. Workers start with the first
+// subscription.
+class DeviceStatusNotifier final {
+public:
+    using StaleHandler = std::function<void(Type type, sptr<IRemoteDevStaCallback> callback)>;
+
+    explicit DeviceStatusNotifier(size_t nWorkers = DEFAULT_NOTIFIER_WORKERS,
+        size_t queueDepth = DEFAULT_LISTENER_QUEUE_DEPTH);
+    ~DeviceStatusNotifier();
+    DISALLOW_COPY_AND_MOVE(DeviceStatusNotifier);
+
+    void SetStaleHandler(StaleHandler handler);
+    // Adds @callback to subscribers of @type if absent, and applies @event to
+    // all subscribers of @type.
+    void Subscribe(Type type, ActivityEvent event, sptr<IRemoteDevStaCallback> callback);
+    void Unsubscribe(Type type, sptr<IRemoteDevStaCallback> callback);
+    // Returns false if nobody subscribes to the type of @data.
+    bool Notify(const Data &data);
+    bool GetMetrics(sptr<IRemoteDevStaCallback> callback, ListenerMetrics &metrics) const;
+    // Discards pending changes and stops the workers once the deliveries in
+    // hand are done. Does not wait for the workers.
+    void Stop();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Event {
+        Data data;
+        Clock::time_point postTime;
+    };
+
+    struct Client {
+        explicit Client(sptr<IRemoteDevStaCallback> cb) : callback(cb) {}
+
+        const sptr<IRemoteDevStaCallback> callback;
+        std::mutex mutex;
+        std::deque<Event> events;
+        bool scheduled { false };
+        bool retired { false };
+        bool staleHandled { false };
+        size_t nConsecutiveDrops { 0 };
+        ListenerMetrics metrics;
+        int64_t sumLatencyUs { 0 };
+        std::atomic<bool> stale { false };
+    };
+
+    struct Subscribers {
+        ActivityEvent event { ENTER_EXIT };
+        std::vector<std::shared_ptr<Client>> clients;
+    };
+
+    std::shared_ptr<const Subscribers> LoadSubscribers(Type type) const;
+    void StoreSubscribers(Type type, std::shared_ptr<const Subscribers> subscribers);
+    std::shared_ptr<Client> FindClientLocked(const sptr<IRemoteObject> &object) const;
+    void StartWorkersLocked();
+    std::vector<Type> GetSubscribedTypesLocked(const std::shared_ptr<Client> &client) const;
+    static bool Accepts(ActivityEvent event, OnChangedValue value);
+    void Post(const std::shared_ptr<Client> &client, const Data &data);
+    void Schedule(const std::shared_ptr<Client> &client);
+    void MarkStale(const std::shared_ptr<Client> &client);
+    void Deliver(const std::shared_ptr<Client> &client);
+    void Retire(const std::shared_ptr<Client> &client);
+    void HandleStale(const std::shared_ptr<Client> &client);
+    void Run();
+
+private:
+    const size_t nWorkers_;
+    const size_t queueDepth_;
+    // Only accessed through std::atomic_load/std::atomic_store.
+    std::array<std::shared_ptr<const Subscribers>, TYPE_MAX> subscribers_;
+    // Serializes updates of subscriber snapshots and guards @workers_.
+    mutable std::mutex writeMutex_;
+    StaleHandler staleHandler_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::shared_ptr<Client>> ready_;
+    bool stopping_ { false };
+    std::vector<std::thread> workers_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DEVICESTATUS_NOTIFIER_H
\ No newline at end of file
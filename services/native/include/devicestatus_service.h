@@ -16,7 +16,9 @@
 #ifndef DEVICESTATUS_SERVICE_H
 #define DEVICESTATUS_SERVICE_H
 
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include <iremote_object.h>
 #include <system_ability.h>
@@ -41,6 +43,11 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 enum class ServiceRunningState {STATE_NOT_START, STATE_RUNNING, STATE_EXIT};
+struct device_status_epoll_event {
+    int32_t fd { 0 };
+    EpollEventType event_type { EPOLL_EVENT_BEGIN };
+};
+
 class DeviceStatusService final : public IContext,
                                   public StreamServer,
                                   public SystemAbility,
@@ -78,6 +85,7 @@ public:
     void OnConnected(SessionPtr s) override;
     void OnDisconnected(SessionPtr s) override;
     int32_t AddEpoll(EpollEventType type, int32_t fd) override;
+    int32_t ModEpoll(EpollEventType type, int32_t fd, uint32_t events) override;
     int32_t DelEpoll(EpollEventType type, int32_t fd);
     bool IsRunning() const override;
 
@@ -110,6 +118,9 @@ private:
     std::unique_ptr<IPluginManager> pluginMgr_;
     std::unique_ptr<IDSoftbusAdapter> dsoftbus_;
     sptr<IntentionService> intention_;
+    // Event data registered with epoll for each fd, EPOLL_CTL_MOD has to pass it again.
+    std::mutex epollMutex_;
+    std::map<int32_t, device_status_epoll_event*> epollEvents_;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -66,11 +66,13 @@ protected:
     virtual void OnConnected(SessionPtr s) = 0;
     virtual void OnDisconnected(SessionPtr s) = 0;
     virtual int32_t AddEpoll(EpollEventType type, int32_t fd) = 0;
+    virtual int32_t ModEpoll(EpollEventType type, int32_t fd, uint32_t events) = 0;
 
     void SetRecvFun(MsgServerFunCallback fun);
     void ReleaseSession(int32_t fd, epoll_event &ev);
     void OnPacket(int32_t fd, NetPacket &pkt);
     void OnEpollRecv(int32_t fd, epoll_event &ev);
+    void OnEpollOut(int32_t fd);
     void OnEpollEvent(epoll_event &ev);
     bool AddSession(SessionPtr ses);
     void DelSession(int32_t fd);
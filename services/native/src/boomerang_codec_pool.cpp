@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "boomerang_codec_pool.h"
+
+#include <algorithm>
+
+#include "devicestatus_define.h"
+#include "util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "BoomerangCodecPool"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+const std::string CODEC_THREAD_NAME { "os_ds_boomerang" };
+}
+
+BoomerangCodecPool::BoomerangCodecPool(const BoomerangCodec &codec, const BoomerangCodecPoolOptions &options)
+    : codec_(codec), options_ { std::max<size_t>(options.nWorkers, 1), std::max<size_t>(options.queueCapacity, 1),
+        std::max<size_t>(options.maxConcurrentCalls, 1) }
+{
+    for (size_t index = 0; index < options_.nWorkers; ++index) {
+        workers_.emplace_back([this] { this->Run(); });
+    }
+}
+
+BoomerangCodecPool::~BoomerangCodecPool()
+{
+    Stop();
+    for (auto &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+int32_t BoomerangCodecPool::SubmitEncode(std::shared_ptr<Media::PixelMap> pixelMap, const std::string &metadata,
+    EncodeDone done)
+{
+    CHKPR(pixelMap, RET_ERR);
+    Job job;
+    job.pixelMap = pixelMap;
+    job.metadata = metadata;
+    job.encodeDone = done;
+    return Submit(std::move(job));
+}
+
+int32_t BoomerangCodecPool::SubmitDecode(std::shared_ptr<Media::PixelMap> pixelMap, DecodeDone done)
+{
+    CHKPR(pixelMap, RET_ERR);
+    Job job;
+    job.pixelMap = pixelMap;
+    job.decodeDone = done;
+    return Submit(std::move(job));
+}
+
+int32_t BoomerangCodecPool::Submit(Job &&job)
+{
+    job.submitTime = Clock::now();
+    std::lock_guard guard(mutex_);
+    if (stopping_) {
+        FI_HILOGE("Codec pool is stopped");
+        return RET_ERR;
+    }
+    if (jobs_.size() >= options_.queueCapacity) {
+        ++metrics_.nRejected;
+        FI_HILOGE("Codec queue is full, job rejected");
+        return RET_ERR;
+    }
+    jobs_.push_back(std::move(job));
+    ++metrics_.nSubmitted;
+    metrics_.peakDepth = std::max(metrics_.peakDepth, jobs_.size());
+    cv_.notify_one();
+    return RET_OK;
+}
+
+void BoomerangCodecPool::Decode(std::shared_ptr<Media::PixelMap> &pixelMap, std::string &metadata)
+{
+    CHKPV(pixelMap);
+    CHKPV(codec_.decode);
+    AcquireSlot();
+    codec_.decode(pixelMap, metadata);
+    ReleaseSlot();
+}
+
+void BoomerangCodecPool::Stop()
+{
+    std::lock_guard guard(mutex_);
+    stopping_ = true;
+    jobs_.clear();
+    cv_.notify_all();
+}
+
+BoomerangCodecPoolMetrics BoomerangCodecPool::GetMetrics() const
+{
+    BoomerangCodecPoolMetrics metrics;
+    {
+        std::lock_guard guard(mutex_);
+        metrics = metrics_;
+        metrics.depth = jobs_.size();
+    }
+    std::lock_guard guard(slotMutex_);
+    metrics.peakRunning = peakRunning_;
+    return metrics;
+}
+
+void BoomerangCodecPool::AcquireSlot()
+{
+    std::unique_lock lock(slotMutex_);
+    slotCv_.wait(lock, [this] { return (nRunning_ < options_.maxConcurrentCalls); });
+    ++nRunning_;
+    peakRunning_ = std::max(peakRunning_, nRunning_);
+}
+
+void BoomerangCodecPool::ReleaseSlot()
+{
+    std::lock_guard guard(slotMutex_);
+    --nRunning_;
+    slotCv_.notify_one();
+}
+
+void BoomerangCodecPool::Execute(Job &job)
+{
+    if (job.encodeDone != nullptr) {
+        std::shared_ptr<Media::PixelMap> resultPixelMap;
+        if (codec_.encode != nullptr) {
+            AcquireSlot();
+            codec_.encode(job.pixelMap, job.metadata, resultPixelMap);
+            ReleaseSlot();
+        }
+        if (resultPixelMap == nullptr) {
+            FI_HILOGE("Encoding failed, the original image is returned");
+            resultPixelMap = job.pixelMap;
+        }
+        OnCompleted(job);
+        job.encodeDone(resultPixelMap);
+        return;
+    }
+    std::string metadata;
+    if (codec_.decode != nullptr) {
+        AcquireSlot();
+        codec_.decode(job.pixelMap, metadata);
+        ReleaseSlot();
+    }
+    OnCompleted(job);
+    if (job.decodeDone != nullptr) {
+        job.decodeDone(metadata);
+    }
+}
+
+void BoomerangCodecPool::OnCompleted(const Job &job)
+{
+    int64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - job.submitTime).count();
+    std::lock_guard guard(mutex_);
+    ++metrics_.nCompleted;
+    sumLatencyUs_ += latency;
+    metrics_.lastLatencyUs = latency;
+    metrics_.maxLatencyUs = std::max(metrics_.maxLatencyUs, latency);
+    metrics_.avgLatencyUs = sumLatencyUs_ / static_cast<int64_t>(metrics_.nCompleted);
+}
+
+void BoomerangCodecPool::Run()
+{
+    SetThreadName(CODEC_THREAD_NAME);
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] { return (stopping_ || !jobs_.empty()); });
+            if (stopping_) {
+                break;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        Execute(job);
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -51,6 +51,26 @@ std::shared_ptr<DeviceStatusManager> DeviceStatusManager::g_deviceManager_;
 #endif
 std::mutex DeviceStatusManager::g_mutex_;
 
+#ifdef BOOMERANG_SUPPORT_HDR
+static bool CopyHdrMetadata(std::shared_ptr<Media::PixelMap> encodePixelMap,
+    HDI::Display::Graphic::Common::V1_0::CM_ColorSpaceType colorSpaceType,
+    HDI::Display::Graphic::Common::V1_0::CM_HDR_Metadata_Type metadatType)
+{
+    CHKPF(encodePixelMap);
+    sptr<SurfaceBuffer> encodeSurfaceBuf(reinterpret_cast<SurfaceBuffer*>(encodePixelMap->GetFd()));
+    CHKPF(encodeSurfaceBuf);
+    if (!Media::VpeUtils::SetSbColorSpaceType(encodeSurfaceBuf, colorSpaceType)) {
+        FI_HILOGE("encode iamge faild by SetSbColorSpaceType");
+        return false;
+    }
+    if (!Media::VpeUtils::SetSbMetadadataType(encodeSurfaceBuf, metadatType)) {
+        FI_HILOGE("encode iamge faild by SetSbMetadadataType");
+        return false;
+    }
+    return true;
+}
+#endif // BOOMERANG_SUPPORT_HDR
+
 void DeviceStatusManager::DeviceStatusCallbackDeathRecipient::OnRemoteDied(const wptr<IRemoteObject>& remote)
 {
     CHKPV(remote);
@@ -166,6 +186,9 @@ bool DeviceStatusManager::Init()
 
     msdpImpl_ = std::make_shared<DeviceStatusMsdpClientImpl>();
     CHKPF(msdpImpl_);
+    notifier_.SetStaleHandler([this](Type type, sptr<IRemoteDevStaCallback> callback) {
+        this->Unsubscribe(type, ENTER_EXIT, callback);
+    });
 
 #ifdef BOOMERANG_ONESTEP
     auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
@@ -265,46 +288,13 @@ int32_t DeviceStatusManager::NotifyDeviceStatusChange(const Data &devicestatusDa
 {
     CALL_DEBUG_ENTER;
     FI_HILOGI("type:%{public}d, value:%{public}d", devicestatusData.type, devicestatusData.value);
-    std::set<const sptr<IRemoteDevStaCallback>, classcomp> listeners;
-    std::lock_guard lock(mutex_);
-    auto iter = listeners_.find(devicestatusData.type);
-    if (iter == listeners_.end()) {
-        FI_HILOGE("type:%{public}d is not exits", devicestatusData.type);
-        return false;
-    }
     if ((devicestatusData.type <= TYPE_INVALID) || (devicestatusData.type >= TYPE_MAX)) {
         FI_HILOGE("Check devicestatusData.type is invalid");
         return false;
     }
-    listeners = (std::set<const sptr<IRemoteDevStaCallback>, classcomp>)(iter->second);
-    for (const auto &listener : listeners) {
-        if (listener == nullptr) {
-            FI_HILOGE("listener is nullptr");
-            return false;
-        }
-        FI_HILOGI("type:%{public}d, arrs_:%{public}d", devicestatusData.type, arrs_[devicestatusData.type]);
-        switch (arrs_[devicestatusData.type]) {
-            case ENTER: {
-                if (devicestatusData.value == VALUE_ENTER) {
-                    listener->OnDeviceStatusChanged(devicestatusData);
-                }
-                break;
-            }
-            case EXIT: {
-                if (devicestatusData.value == VALUE_EXIT) {
-                    listener->OnDeviceStatusChanged(devicestatusData);
-                }
-                break;
-            }
-            case ENTER_EXIT: {
-                listener->OnDeviceStatusChanged(devicestatusData);
-                break;
-            }
-            default: {
-                FI_HILOGE("OnChangedValue is unknown");
-                break;
-            }
-        }
+    if (!notifier_.Notify(devicestatusData)) {
+        FI_HILOGE("type:%{public}d is not exits", devicestatusData.type);
+        return false;
     }
     return RET_OK;
 }
@@ -330,6 +320,7 @@ void DeviceStatusManager::Subscribe(Type type, ActivityEvent event, ReportLatenc
     std::set<const sptr<IRemoteDevStaCallback>, classcomp> listeners;
     auto object = callback->AsObject();
     CHKPV(object);
+    notifier_.Subscribe(type, event, callback);
     FI_HILOGI("listeners_.size:%{public}zu", listeners_.size());
     auto dtTypeIter = listeners_.find(type);
     if (dtTypeIter == listeners_.end()) {
@@ -384,6 +375,7 @@ void DeviceStatusManager::Unsubscribe(Type type, ActivityEvent event, sptr<IRemo
     auto iter = listeners_[dtTypeIter->first].find(callback);
     if (iter != listeners_[dtTypeIter->first].end()) {
         if (listeners_[dtTypeIter->first].erase(callback) != 0) {
+            notifier_.Unsubscribe(type, callback);
             object->RemoveDeathRecipient(devicestatusCBDeathRecipient_);
             if (listeners_[dtTypeIter->first].empty()) {
                 listeners_.erase(dtTypeIter);
@@ -588,7 +580,6 @@ int32_t DeviceStatusManager::BoomerangEncodeImage(std::shared_ptr<Media::PixelMa
     CALL_DEBUG_ENTER;
     CHKPR(pixelMap, RET_ERR);
     CHKPR(callback, RET_ERR);
-    std::lock_guard lock(mutex_);
 
 #ifdef BOOMERANG_SUPPORT_HDR
     sptr<SurfaceBuffer> surfaceBuf(reinterpret_cast<SurfaceBuffer*>(pixelMap->GetFd()));
@@ -599,32 +590,28 @@ int32_t DeviceStatusManager::BoomerangEncodeImage(std::shared_ptr<Media::PixelMa
 
     HDI::Display::Graphic::Common::V1_0::CM_HDR_Metadata_Type metadatType;
     Media::VpeUtils::GetSbMetadataType(surfaceBuf, metadatType);
-#endif // BOOMERANG_SUPPORT_HDR
-
-    auto algo = std::make_shared<BoomerangAlgoImpl>();
-    CHKPR(algo, RET_ERR);
-    std::shared_ptr<Media::PixelMap> encodePixelMap;
-    algo->EncodeImage(pixelMap, metadata, encodePixelMap);
-    CHKPR(encodePixelMap, RET_ERR);
-
-#ifdef BOOMERANG_SUPPORT_HDR
-    sptr<SurfaceBuffer> encodeSurfaceBuf(reinterpret_cast<SurfaceBuffer*>(encodePixelMap->GetFd()));
-    CHKPR(encodeSurfaceBuf, RET_ERR);
 
-    bool ret = Media::VpeUtils::SetSbColorSpaceType(encodeSurfaceBuf, colorSpaceType);
-    if (!ret) {
-        FI_HILOGE("encode iamge faild by SetSbColorSpaceType");
-        return RET_ERR;
-    }
+    auto done = [callback, colorSpaceType, metadatType](std::shared_ptr<Media::PixelMap> encodePixelMap) {
+        if (!CopyHdrMetadata(encodePixelMap, colorSpaceType, metadatType)) {
+            FI_HILOGE("Failed to encode image");
+            callback->OnEncodeImageResult(nullptr);
+            return;
+        }
+        callback->OnEncodeImageResult(encodePixelMap);
+    };
+#else
+    auto done = [callback](std::shared_ptr<Media::PixelMap> encodePixelMap) {
+        if (encodePixelMap == nullptr) {
+            FI_HILOGE("Failed to encode image");
+        }
+        callback->OnEncodeImageResult(encodePixelMap);
+    };
+#endif // BOOMERANG_SUPPORT_HDR
 
-    ret = Media::VpeUtils::SetSbMetadadataType(encodeSurfaceBuf, metadatType);
-    if (!ret) {
-        FI_HILOGE("encode iamge faild by SetSbMetadadataType");
+    if (GetCodecPool().SubmitEncode(pixelMap, metadata, done) != RET_OK) {
+        FI_HILOGE("Failed to submit encoding");
         return RET_ERR;
     }
-#endif // BOOMERANG_SUPPORT_HDR
-
-    callback->OnEncodeImageResult(encodePixelMap);
     return RET_OK;
 }
 
@@ -634,15 +621,39 @@ int32_t DeviceStatusManager::BoomerangDecodeImage(std::shared_ptr<Media::PixelMa
     CALL_DEBUG_ENTER;
     CHKPR(pixelMap, RET_ERR);
     CHKPR(callback, RET_ERR);
-    std::lock_guard lock(mutex_);
-    std::string metadata;
-    auto algo = std::make_shared<BoomerangAlgoImpl>();
-    CHKPR(algo, RET_ERR);
-    algo->DecodeImage(pixelMap, metadata);
-    callback->OnNotifyMetadata(metadata);
+    auto done = [callback](const std::string &metadata) {
+        callback->OnNotifyMetadata(metadata);
+    };
+    if (GetCodecPool().SubmitDecode(pixelMap, done) != RET_OK) {
+        FI_HILOGE("Failed to submit decoding");
+        return RET_ERR;
+    }
     return RET_OK;
 }
 
+BoomerangCodecPool &DeviceStatusManager::GetCodecPool()
+{
+    std::call_once(codecPoolFlag_, [this] {
+        BoomerangCodec codec = BoomerangAlgoManager::GetCodec();
+        if ((codec.encode == nullptr) && (codec.decode == nullptr)) {
+            // The algorithm library failed to load, go through BoomerangAlgoManager
+            // so that every codec call tries to load it again.
+            FI_HILOGW("Boomerang algorithm is not loaded, retry on use");
+            codec.encode = [](std::shared_ptr<Media::PixelMap> &pixelMap, const std::string &content,
+                std::shared_ptr<Media::PixelMap> &resultPixelMap) {
+                BoomerangAlgoManager::EncodeImage(pixelMap, content, resultPixelMap);
+            };
+            codec.decode = [](std::shared_ptr<Media::PixelMap> &pixelMap, std::string &content) {
+                BoomerangAlgoManager::DecodeImage(pixelMap, content);
+            };
+        } else if ((codec.encode == nullptr) || (codec.decode == nullptr)) {
+            FI_HILOGW("Boomerang algorithm is not fully available");
+        }
+        codecPool_ = std::make_unique<BoomerangCodecPool>(codec);
+    });
+    return *codecPool_;
+}
+
 int32_t DeviceStatusManager::LoadAlgorithm()
 {
     CALL_DEBUG_ENTER;
@@ -786,10 +797,8 @@ void DeviceStatusManager::HandlerPageScrollerEvent(int32_t event)
 #ifdef BOOMERANG_ONESTEP
 void DeviceStatusManager::OnSurfaceCapture(int32_t windowId, std::shared_ptr<Media::PixelMap> &screenShot)
 {
-    auto algo = std::make_shared<BoomerangAlgoImpl>();
-    CHKPV(algo);
     std::string metadata;
-    algo->DecodeImage(screenShot, metadata);
+    GetCodecPool().Decode(screenShot, metadata);
     std::lock_guard lock(countMutex_);
     if (!metadata.empty()) {
         FI_HILOGI("Boomerang Algo decode image result:%{public}s", metadata.c_str());
@@ -29,33 +29,63 @@ namespace DeviceStatus {
 void* BoomerangAlgoManager::boomerangAlgoHandle_ = nullptr;
 EncodeImageFunc BoomerangAlgoManager::boomerangAlgoEncodeImageHandle_ = nullptr;
 DecodeImageFunc BoomerangAlgoManager::boomerangAlgoDecodeImageHandle_ = nullptr;
+std::mutex BoomerangAlgoManager::loadMutex_;
+std::atomic<bool> BoomerangAlgoManager::loaded_ { false };
 
 const std::string BOOMERANG_ALGO_SO_PATH = "system/lib64/libmsdp_boomerang_algo.z.so";
 
-bool BoomerangAlgoManager::EncodeImage(std::shared_ptr<Media::PixelMap> &pixelMap, const std::string &content,
-                                       std::shared_ptr<Media::PixelMap> &resultPixelMap)
+bool BoomerangAlgoManager::Load()
 {
-    FI_HILOGI("Boomerang Algo Encode Load");
+    if (loaded_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard guard(loadMutex_);
+    if (loaded_.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    FI_HILOGI("Boomerang Algo Load");
     char realPath[PATH_MAX] = {};
     if (realpath(BOOMERANG_ALGO_SO_PATH.c_str(), realPath) == nullptr) {
         FI_HILOGE("Path is error, path is %{private}s", BOOMERANG_ALGO_SO_PATH.c_str());
         return false;
     }
-    if (boomerangAlgoHandle_ == nullptr) {
-        boomerangAlgoHandle_ = dlopen(realPath, RTLD_LAZY);
-        char *error = nullptr;
-        if (((error = dlerror()) != nullptr) || (boomerangAlgoHandle_ == nullptr)) {
-            FI_HILOGE("Boomerang Algo Encode Load failed, error: %{public}s", error);
-            return false;
-        }
+    boomerangAlgoHandle_ = dlopen(realPath, RTLD_LAZY);
+    char *error = nullptr;
+    if (((error = dlerror()) != nullptr) || (boomerangAlgoHandle_ == nullptr)) {
+        FI_HILOGE("Boomerang Algo Load failed, error: %{public}s", error);
+        boomerangAlgoHandle_ = nullptr;
+        return false;
+    }
+    boomerangAlgoEncodeImageHandle_ = reinterpret_cast<EncodeImageFunc>(dlsym(boomerangAlgoHandle_, "EncodeImage"));
+    if ((error = dlerror()) != nullptr) {
+        FI_HILOGE("Boomerang Algo Encode find symbol failed, error: %{public}s", error);
+        boomerangAlgoEncodeImageHandle_ = nullptr;
+    }
+    boomerangAlgoDecodeImageHandle_ = reinterpret_cast<DecodeImageFunc>(dlsym(boomerangAlgoHandle_, "DecodeImage"));
+    if ((error = dlerror()) != nullptr) {
+        FI_HILOGE("Boomerang Algo Decode find symbol failed, error: %{public}s", error);
+        boomerangAlgoDecodeImageHandle_ = nullptr;
+    }
+    loaded_.store(true, std::memory_order_release);
+    return true;
+}
+
+BoomerangCodec BoomerangAlgoManager::GetCodec()
+{
+    BoomerangCodec codec;
+    if (Load()) {
+        codec.encode = boomerangAlgoEncodeImageHandle_;
+        codec.decode = boomerangAlgoDecodeImageHandle_;
     }
-    if (boomerangAlgoEncodeImageHandle_ == nullptr) {
-        boomerangAlgoEncodeImageHandle_ = reinterpret_cast<EncodeImageFunc>(dlsym(boomerangAlgoHandle_, "EncodeImage"));
-        char *error = nullptr;
-        if ((error = dlerror()) != nullptr) {
-            FI_HILOGE("Boomerang Algo Encode find symbol failed, error: %{public}s", error);
-            return false;
-        }
+    return codec;
+}
+
+bool BoomerangAlgoManager::EncodeImage(std::shared_ptr<Media::PixelMap> &pixelMap, const std::string &content,
+                                       std::shared_ptr<Media::PixelMap> &resultPixelMap)
+{
+    if (!Load() || (boomerangAlgoEncodeImageHandle_ == nullptr)) {
+        FI_HILOGE("Boomerang Algo Encode is unavailable");
+        return false;
     }
     boomerangAlgoEncodeImageHandle_(pixelMap, content, resultPixelMap);
     FI_HILOGI("Boomerang Algo Encode success");
@@ -64,28 +94,10 @@ bool BoomerangAlgoManager::EncodeImage(std::shared_ptr<Media::PixelMap> &pixelMa
 
 bool BoomerangAlgoManager::DecodeImage(std::shared_ptr<Media::PixelMap> &pixelMap, std::string &content)
 {
-    FI_HILOGI("Boomerang Algo Decode Load");
-    char realPath[PATH_MAX] = {};
-    if (realpath(BOOMERANG_ALGO_SO_PATH.c_str(), realPath) == nullptr) {
-        FI_HILOGE("Path is error, path is %{private}s", BOOMERANG_ALGO_SO_PATH.c_str());
+    if (!Load() || (boomerangAlgoDecodeImageHandle_ == nullptr)) {
+        FI_HILOGE("Boomerang Algo Decode is unavailable");
         return false;
     }
-    if (boomerangAlgoHandle_ == nullptr) {
-        boomerangAlgoHandle_ = dlopen(realPath, RTLD_LAZY);
-        char *error = nullptr;
-        if (((error = dlerror()) != nullptr) || (boomerangAlgoHandle_ == nullptr)) {
-            FI_HILOGE("Boomerang Algo Decode Load failed, error: %{public}s", error);
-            return false;
-        }
-    }
-    if (boomerangAlgoDecodeImageHandle_ == nullptr) {
-        boomerangAlgoDecodeImageHandle_ = reinterpret_cast<DecodeImageFunc>(dlsym(boomerangAlgoHandle_, "DecodeImage"));
-        char *error = nullptr;
-        if (((error = dlerror()) != nullptr) || (boomerangAlgoDecodeImageHandle_ == nullptr)) {
-            FI_HILOGE("Boomerang Algo Decode find symbol failed, error: %{public}s", error);
-            return false;
-        }
-    }
     boomerangAlgoDecodeImageHandle_(pixelMap, content);
     FI_HILOGI("Boomerang Algo Decode success");
     return true;
@@ -94,6 +106,7 @@ bool BoomerangAlgoManager::DecodeImage(std::shared_ptr<Media::PixelMap> &pixelMa
 BoomerangAlgoManager::~BoomerangAlgoManager()
 {
     FI_HILOGI("Boomerang Algo Unload");
+    std::lock_guard guard(loadMutex_);
     if (boomerangAlgoHandle_ != nullptr) {
         dlclose(boomerangAlgoHandle_);
         boomerangAlgoHandle_ = nullptr;
@@ -101,6 +114,7 @@ BoomerangAlgoManager::~BoomerangAlgoManager()
     }
     boomerangAlgoEncodeImageHandle_ = nullptr;
     boomerangAlgoDecodeImageHandle_ = nullptr;
+    loaded_.store(false, std::memory_order_release);
 }
 
 void BoomerangAlgoImpl::EncodeImage(std::shared_ptr<Media::PixelMap> &pixelMap, const std::string &content,
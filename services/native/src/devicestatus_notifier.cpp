@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "devicestatus_notifier.h"
+
+#include <algorithm>
+
+#include "devicestatus_define.h"
+#include "util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DeviceStatusNotifier"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr size_t MAX_EVENTS_PER_TURN { 4 };
+// A client that has not taken a single change while this many were dropped
+// from its queue is considered stuck.
+constexpr size_t MAX_CONSECUTIVE_DROPS { 32 };
+const std::string NOTIFIER_THREAD_NAME { "os_ds_notifier" };
+
+bool IsValidType(Type type)
+{
+    return ((type > TYPE_INVALID) && (type < TYPE_MAX));
+}
+}
+
+DeviceStatusNotifier::DeviceStatusNotifier(size_t nWorkers, size_t queueDepth)
+    : nWorkers_(std::max<size_t>(nWorkers, 1)), queueDepth_(std::max<size_t>(queueDepth, 1))
+{}
+
+DeviceStatusNotifier::~DeviceStatusNotifier()
+{
+    Stop();
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard guard(writeMutex_);
+        workers.swap(workers_);
+    }
+    for (auto &worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void DeviceStatusNotifier::SetStaleHandler(StaleHandler handler)
+{
+    std::lock_guard guard(writeMutex_);
+    staleHandler_ = handler;
+}
+
+void DeviceStatusNotifier::Subscribe(Type type, ActivityEvent event, sptr<IRemoteDevStaCallback> callback)
+{
+    CHKPV(callback);
+    auto object = callback->AsObject();
+    CHKPV(object);
+    if (!IsValidType(type)) {
+        FI_HILOGE("Invalid type:%{public}d", type);
+        return;
+    }
+    std::lock_guard guard(writeMutex_);
+    StartWorkersLocked();
+    auto subscribers = std::make_shared<Subscribers>();
+    if (auto current = LoadSubscribers(type); current != nullptr) {
+        *subscribers = *current;
+    }
+    subscribers->event = event;
+    auto iter = std::find_if(subscribers->clients.cbegin(), subscribers->clients.cend(),
+        [&object](const auto &client) { return (client->callback->AsObject() == object); });
+    if (iter == subscribers->clients.cend()) {
+        auto client = FindClientLocked(object);
+        if (client == nullptr) {
+            client = std::make_shared<Client>(callback);
+        }
+        subscribers->clients.push_back(client);
+    }
+    StoreSubscribers(type, subscribers);
+}
+
+void DeviceStatusNotifier::Unsubscribe(Type type, sptr<IRemoteDevStaCallback> callback)
+{
+    CHKPV(callback);
+    auto object = callback->AsObject();
+    CHKPV(object);
+    if (!IsValidType(type)) {
+        FI_HILOGE("Invalid type:%{public}d", type);
+        return;
+    }
+    std::lock_guard guard(writeMutex_);
+    auto current = LoadSubscribers(type);
+    if (current == nullptr) {
+        return;
+    }
+    auto subscribers = std::make_shared<Subscribers>();
+    subscribers->event = current->event;
+    std::shared_ptr<Client> removed;
+    for (const auto &client : current->clients) {
+        if (client->callback->AsObject() == object) {
+            removed = client;
+        } else {
+            subscribers->clients.push_back(client);
+        }
+    }
+    if (removed == nullptr) {
+        return;
+    }
+    StoreSubscribers(type, subscribers->clients.empty() ? nullptr : subscribers);
+    if (GetSubscribedTypesLocked(removed).empty()) {
+        Retire(removed);
+    }
+}
+
+bool DeviceStatusNotifier::Notify(const Data &data)
+{
+    if (!IsValidType(data.type)) {
+        FI_HILOGE("Invalid type:%{public}d", data.type);
+        return false;
+    }
+    auto subscribers = LoadSubscribers(data.type);
+    if ((subscribers == nullptr) || subscribers->clients.empty()) {
+        return false;
+    }
+    if (!Accepts(subscribers->event, data.value)) {
+        return true;
+    }
+    for (const auto &client : subscribers->clients) {
+        Post(client, data);
+    }
+    return true;
+}
+
+bool DeviceStatusNotifier::GetMetrics(sptr<IRemoteDevStaCallback> callback, ListenerMetrics &metrics) const
+{
+    CHKPF(callback);
+    std::shared_ptr<Client> client;
+    {
+        std::lock_guard guard(writeMutex_);
+        client = FindClientLocked(callback->AsObject());
+    }
+    if (client == nullptr) {
+        return false;
+    }
+    std::lock_guard guard(client->mutex);
+    metrics = client->metrics;
+    metrics.depth = client->events.size();
+    return true;
+}
+
+void DeviceStatusNotifier::Stop()
+{
+    std::lock_guard guard(mutex_);
+    stopping_ = true;
+    ready_.clear();
+    cv_.notify_all();
+}
+
+void DeviceStatusNotifier::StartWorkersLocked()
+{
+    if (!workers_.empty()) {
+        return;
+    }
+    for (size_t index = 0; index < nWorkers_; ++index) {
+        workers_.emplace_back([this] { this->Run(); });
+    }
+}
+
+std::shared_ptr<const DeviceStatusNotifier::Subscribers> DeviceStatusNotifier::LoadSubscribers(Type type) const
+{
+    return std::atomic_load(&subscribers_[type]);
+}
+
+void DeviceStatusNotifier::StoreSubscribers(Type type, std::shared_ptr<const Subscribers> subscribers)
+{
+    std::atomic_store(&subscribers_[type], subscribers);
+}
+
+std::shared_ptr<DeviceStatusNotifier::Client> DeviceStatusNotifier::FindClientLocked(
+    const sptr<IRemoteObject> &object) const
+{
+    for (int32_t type = TYPE_ABSOLUTE_STILL; type < TYPE_MAX; ++type) {
+        auto subscribers = LoadSubscribers(static_cast<Type>(type));
+        if (subscribers == nullptr) {
+            continue;
+        }
+        for (const auto &client : subscribers->clients) {
+            if (client->callback->AsObject() == object) {
+                return client;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::vector<Type> DeviceStatusNotifier::GetSubscribedTypesLocked(const std::shared_ptr<Client> &client) const
+{
+    std::vector<Type> types;
+    for (int32_t type = TYPE_ABSOLUTE_STILL; type < TYPE_MAX; ++type) {
+        auto subscribers = LoadSubscribers(static_cast<Type>(type));
+        if ((subscribers != nullptr) &&
+            (std::find(subscribers->clients.cbegin(), subscribers->clients.cend(), client) !=
+                subscribers->clients.cend())) {
+            types.push_back(static_cast<Type>(type));
+        }
+    }
+    return types;
+}
+
+bool DeviceStatusNotifier::Accepts(ActivityEvent event, OnChangedValue value)
+{
+    switch (event) {
+        case ENTER: {
+            return (value == VALUE_ENTER);
+        }
+        case EXIT: {
+            return (value == VALUE_EXIT);
+        }
+        case ENTER_EXIT: {
+            return true;
+        }
+        default: {
+            FI_HILOGE("OnChangedValue is unknown");
+            return false;
+        }
+    }
+}
+
+void DeviceStatusNotifier::Post(const std::shared_ptr<Client> &client, const Data &data)
+{
+    bool schedule = false;
+    bool stale = false;
+    {
+        std::lock_guard guard(client->mutex);
+        if (client->retired || client->stale) {
+            return;
+        }
+        if (client->events.size() >= queueDepth_) {
+            client->events.pop_front();
+            ++client->metrics.nDropped;
+            ++client->nConsecutiveDrops;
+            stale = (client->nConsecutiveDrops >= MAX_CONSECUTIVE_DROPS);
+            FI_HILOGW("Listener queue is full, %{public}zu changes dropped since last delivery",
+                client->nConsecutiveDrops);
+        }
+        client->events.push_back(Event { data, Clock::now() });
+        if (!client->scheduled) {
+            client->scheduled = true;
+            schedule = true;
+        }
+    }
+    if (stale) {
+        FI_HILOGE("Listener stopped taking changes");
+        MarkStale(client);
+    } else if (schedule) {
+        Schedule(client);
+    }
+}
+
+void DeviceStatusNotifier::Schedule(const std::shared_ptr<Client> &client)
+{
+    std::lock_guard guard(mutex_);
+    if (stopping_) {
+        return;
+    }
+    ready_.push_back(client);
+    cv_.notify_one();
+}
+
+void DeviceStatusNotifier::MarkStale(const std::shared_ptr<Client> &client)
+{
+    if (!client->stale.exchange(true)) {
+        Schedule(client);
+    }
+}
+
+void DeviceStatusNotifier::Deliver(const std::shared_ptr<Client> &client)
+{
+    for (size_t nEvents = 0; nEvents < MAX_EVENTS_PER_TURN; ++nEvents) {
+        Event event;
+        {
+            std::lock_guard guard(client->mutex);
+            if (client->events.empty() || client->retired || client->stale) {
+                client->scheduled = false;
+                return;
+            }
+            event = client->events.front();
+            client->events.pop_front();
+        }
+        auto object = client->callback->AsObject();
+        if ((object == nullptr) || object->IsObjectDead()) {
+            FI_HILOGE("Remote object of listener is dead");
+            MarkStale(client);
+            continue;
+        }
+        client->callback->OnDeviceStatusChanged(event.data);
+        int64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - event.postTime).count();
+
+        std::lock_guard guard(client->mutex);
+        auto &metrics = client->metrics;
+        ++metrics.nDelivered;
+        client->sumLatencyUs += latency;
+        metrics.lastLatencyUs = latency;
+        metrics.maxLatencyUs = std::max(metrics.maxLatencyUs, latency);
+        metrics.avgLatencyUs = client->sumLatencyUs / static_cast<int64_t>(metrics.nDelivered);
+        client->nConsecutiveDrops = 0;
+    }
+    {
+        std::lock_guard guard(client->mutex);
+        if (client->events.empty() || client->retired || client->stale) {
+            client->scheduled = false;
+            return;
+        }
+    }
+    // Let other clients have a turn before serving the rest of this queue.
+    Schedule(client);
+}
+
+void DeviceStatusNotifier::Retire(const std::shared_ptr<Client> &client)
+{
+    std::lock_guard guard(client->mutex);
+    client->retired = true;
+    client->events.clear();
+}
+
+void DeviceStatusNotifier::HandleStale(const std::shared_ptr<Client> &client)
+{
+    {
+        std::lock_guard guard(client->mutex);
+        client->events.clear();
+        if (client->staleHandled) {
+            return;
+        }
+        client->staleHandled = true;
+    }
+    std::vector<Type> types;
+    StaleHandler handler;
+    {
+        std::lock_guard guard(writeMutex_);
+        handler = staleHandler_;
+        types = GetSubscribedTypesLocked(client);
+    }
+    for (auto type : types) {
+        FI_HILOGW("Unsubscribe stale listener of type:%{public}d", type);
+        if (handler != nullptr) {
+            handler(type, client->callback);
+        } else {
+            Unsubscribe(type, client->callback);
+        }
+    }
+}
+
+void DeviceStatusNotifier::Run()
+{
+    SetThreadName(NOTIFIER_THREAD_NAME);
+    while (true) {
+        std::shared_ptr<Client> client;
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] { return (stopping_ || !ready_.empty()); });
+            if (stopping_) {
+                break;
+            }
+            client = ready_.front();
+            ready_.pop_front();
+        }
+        if (client->stale) {
+            HandleStale(client);
+        } else {
+            Deliver(client);
+        }
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -54,11 +54,6 @@ constexpr int32_t DEFAULT_WAIT_TIME_MS { 1000 };
 constexpr int32_t WAIT_FOR_ONCE { 1 };
 constexpr int32_t MAX_N_RETRIES { 100 };
 
-struct device_status_epoll_event {
-    int32_t fd { 0 };
-    EpollEventType event_type { EPOLL_EVENT_BEGIN };
-};
-
 const bool REGISTER_RESULT =
     SystemAbility::MakeAndRegisterAbility(DelayedSpSingleton<DeviceStatusService>::GetInstance().GetRefPtr());
 } // namespace
@@ -437,6 +432,7 @@ int32_t DeviceStatusService::AddEpoll(EpollEventType type, int32_t fd)
     struct epoll_event ev {};
     ev.events = EPOLLIN;
     ev.data.ptr = eventData;
+    std::lock_guard<std::mutex> guard(epollMutex_);
     if (EpollCtl(fd, EPOLL_CTL_ADD, ev) != RET_OK) {
         free(eventData);
         eventData = nullptr;
@@ -444,6 +440,25 @@ int32_t DeviceStatusService::AddEpoll(EpollEventType type, int32_t fd)
         FI_HILOGE("EpollCtl failed");
         return RET_ERR;
     }
+    epollEvents_[fd] = eventData;
+    return RET_OK;
+}
+
+int32_t DeviceStatusService::ModEpoll(EpollEventType type, int32_t fd, uint32_t events)
+{
+    std::lock_guard<std::mutex> guard(epollMutex_);
+    auto iter = epollEvents_.find(fd);
+    if ((iter == epollEvents_.end()) || (iter->second->event_type != type)) {
+        FI_HILOGE("The fd:%{public}d of type:%{public}d is not in epoll", fd, type);
+        return RET_ERR;
+    }
+    struct epoll_event ev {};
+    ev.events = events;
+    ev.data.ptr = iter->second;
+    if (EpollCtl(fd, EPOLL_CTL_MOD, ev) != RET_OK) {
+        FI_HILOGE("ModEpoll failed");
+        return RET_ERR;
+    }
     return RET_OK;
 }
 
@@ -457,6 +472,8 @@ int32_t DeviceStatusService::DelEpoll(EpollEventType type, int32_t fd)
         FI_HILOGE("Invalid fd:%{public}d", fd);
         return RET_ERR;
     }
+    std::lock_guard<std::mutex> guard(epollMutex_);
+    epollEvents_.erase(fd);
     struct epoll_event ev {};
     if (EpollCtl(fd, EPOLL_CTL_DEL, ev) != RET_OK) {
         FI_HILOGE("DelEpoll failed");
@@ -543,6 +560,11 @@ void DeviceStatusService::OnThread()
 void DeviceStatusService::OnSocketEvent(const struct epoll_event &ev)
 {
     CALL_INFO_TRACE;
+    auto epollEvent = reinterpret_cast<device_status_epoll_event*>(ev.data.ptr);
+    CHKPV(epollEvent);
+    if (((ev.events & EPOLLOUT) == EPOLLOUT) && (epollEvent->fd != socketSessionMgr_.GetFd())) {
+        OnEpollOut(epollEvent->fd);
+    }
     if ((ev.events & EPOLLIN) == EPOLLIN) {
         socketSessionMgr_.Dispatch(ev);
     } else if ((ev.events & (EPOLLHUP | EPOLLERR)) != 0) {
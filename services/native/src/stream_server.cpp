@@ -122,6 +122,12 @@ int32_t StreamServer::AddSocketPairInfo(const std::string &programName, int32_t
         FI_HILOGE("epoll_ctl EPOLL_CTL_ADD failed, errCode:%{public}d", EPOLL_MODIFY_FAIL);
         return CloseFd(serverFd, toReturnClientFd);
     }
+    sess->SetWritableWatcher([this, fd = serverFd](bool enable) {
+        uint32_t events = (enable ? (EPOLLIN | EPOLLOUT) : EPOLLIN);
+        if (this->ModEpoll(EPOLL_EVENT_SOCKET, fd, events) != RET_OK) {
+            FI_HILOGW("Failed to watch writable, fd:%{public}d, enable:%{public}d", fd, enable);
+        }
+    });
     OnConnected(sess);
     return RET_OK;
 }
@@ -242,6 +248,14 @@ void StreamServer::OnEpollRecv(int32_t fd, epoll_event &ev)
     }
 }
 
+void StreamServer::OnEpollOut(int32_t fd)
+{
+    auto sess = GetSession(fd);
+    if ((sess != nullptr) && !sess->FlushPendingMsgs()) {
+        FI_HILOGW("Failed to flush pending messages, fd:%{public}d", fd);
+    }
+}
+
 void StreamServer::OnEpollEvent(epoll_event &ev)
 {
     CHKPV(ev.data.ptr);
@@ -250,6 +264,9 @@ void StreamServer::OnEpollEvent(epoll_event &ev)
         FI_HILOGE("The fd less than 0, errCode:%{public}d", PARAM_INPUT_INVALID);
         return;
     }
+    if ((ev.events & EPOLLOUT) == EPOLLOUT) {
+        OnEpollOut(fd);
+    }
     if ((ev.events & EPOLLERR) || (ev.events & EPOLLHUP)) {
         FI_HILOGI("EPOLLERR or EPOLLHUP, fd:%{public}d, ev.events:0x%{public}x", fd, ev.events);
         ReleaseSession(fd, ev);
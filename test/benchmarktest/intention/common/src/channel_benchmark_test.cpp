@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "channel.h"
+#include "ring_channel.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr size_t EVENTS_PER_SENDER { 100000 };
+constexpr size_t RING_CAPACITY { 4096 };
+constexpr int64_t MAX_SENDERS { 4 };
+
+template<typename Sender, typename Full>
+void SendAll(Sender sender, size_t count, Full full)
+{
+    for (size_t index = 0; index < count;) {
+        if (sender.Send(index) == full) {
+            std::this_thread::yield();
+            continue;
+        }
+        ++index;
+    }
+}
+} // namespace
+
+static void BM_ChannelSendReceive(benchmark::State &state)
+{
+    const auto nSenders = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        auto [sender, receiver] = Channel<size_t>::OpenChannel();
+        receiver.Enable();
+        std::vector<std::thread> workers;
+        for (size_t id = 0; id < nSenders; ++id) {
+            workers.emplace_back(SendAll<Channel<size_t>::Sender, int32_t>,
+                sender, EVENTS_PER_SENDER, Channel<size_t>::QUEUE_IS_FULL);
+        }
+        for (size_t received = 0; received < nSenders * EVENTS_PER_SENDER; ++received) {
+            benchmark::DoNotOptimize(receiver.Receive());
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * nSenders * EVENTS_PER_SENDER);
+}
+BENCHMARK(BM_ChannelSendReceive)->RangeMultiplier(2)->Range(1, MAX_SENDERS)->UseRealTime();
+
+static void BM_RingChannelSendReceive(benchmark::State &state)
+{
+    const auto nSenders = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        auto [sender, receiver] = RingChannel<size_t>::OpenChannel(RING_CAPACITY);
+        receiver.Enable();
+        std::vector<std::thread> workers;
+        for (size_t id = 0; id < nSenders; ++id) {
+            workers.emplace_back(SendAll<RingChannel<size_t>::Sender, int32_t>,
+                sender, EVENTS_PER_SENDER, RingChannel<size_t>::QUEUE_IS_FULL);
+        }
+        for (size_t received = 0; received < nSenders * EVENTS_PER_SENDER; ++received) {
+            benchmark::DoNotOptimize(receiver.Receive());
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * nSenders * EVENTS_PER_SENDER);
+}
+BENCHMARK(BM_RingChannelSendReceive)->RangeMultiplier(2)->Range(1, MAX_SENDERS)->UseRealTime();
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
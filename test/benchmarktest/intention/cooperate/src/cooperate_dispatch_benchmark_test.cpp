@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "cooperate_event_table.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace Cooperate;
+namespace {
+constexpr size_t TRACE_POINTER_EVENTS { 4096 };
+constexpr size_t MOUSE_LOCATION_INTERVAL { 8 };
+constexpr int32_t POINTER_ACTION_MOVE { 3 };
+
+struct TraceContext {
+    size_t nMachineEvents { 0 };
+    size_t nStepEvents { 0 };
+    size_t nUnhandled { 0 };
+};
+
+using LegacyHandler = std::function<void(TraceContext&, const CooperateEvent&)>;
+
+// Event trace of one cooperate session: set-up, a burst of pointer moves interleaved
+// with mouse location updates from the peer, and tear-down.
+std::vector<CooperateEvent> RecordTrace()
+{
+    std::vector<CooperateEvent> trace;
+    trace.emplace_back(CooperateEventType::ENABLE, EnableCooperateEvent {});
+    trace.emplace_back(CooperateEventType::DDM_BOARD_ONLINE, DDMBoardOnlineEvent {});
+    trace.emplace_back(CooperateEventType::DSOFTBUS_SESSION_OPENED, DSoftbusSessionOpened {});
+    trace.emplace_back(CooperateEventType::START, StartCooperateEvent {});
+    for (size_t index = 0; index < TRACE_POINTER_EVENTS; ++index) {
+        trace.emplace_back(CooperateEventType::INPUT_POINTER_EVENT, InputPointerEvent {
+            .deviceId = 1,
+            .pointerAction = POINTER_ACTION_MOVE,
+        });
+        if ((index % MOUSE_LOCATION_INTERVAL) == 0) {
+            trace.emplace_back(CooperateEventType::DSOFTBUS_MOUSE_LOCATION, DSoftbusSyncMouseLocation {});
+        }
+    }
+    trace.emplace_back(CooperateEventType::INPUT_HOTPLUG_EVENT, InputHotplugEvent {});
+    trace.emplace_back(CooperateEventType::STOP, StopCooperateEvent {});
+    trace.emplace_back(CooperateEventType::DSOFTBUS_SESSION_CLOSED, DSoftbusSessionClosed {});
+    trace.emplace_back(CooperateEventType::DISABLE, DisableCooperateEvent {});
+    return trace;
+}
+
+// Handlers of the top-level state machine and of the current cooperate step,
+// registered for the same event types as StateMachine and CooperateOut::Initial.
+const std::vector<CooperateEventType> MACHINE_EVENTS {
+    CooperateEventType::ENABLE,
+    CooperateEventType::DISABLE,
+    CooperateEventType::START,
+    CooperateEventType::STOP,
+    CooperateEventType::DDM_BOARD_ONLINE,
+    CooperateEventType::INPUT_POINTER_EVENT,
+    CooperateEventType::INPUT_HOTPLUG_EVENT,
+    CooperateEventType::DSOFTBUS_SESSION_OPENED,
+    CooperateEventType::DSOFTBUS_SESSION_CLOSED,
+    CooperateEventType::DSOFTBUS_MOUSE_LOCATION,
+};
+
+const std::vector<CooperateEventType> STEP_EVENTS {
+    CooperateEventType::DISABLE,
+    CooperateEventType::START,
+    CooperateEventType::STOP,
+    CooperateEventType::INPUT_POINTER_EVENT,
+    CooperateEventType::INPUT_HOTPLUG_EVENT,
+    CooperateEventType::DSOFTBUS_SESSION_CLOSED,
+};
+
+class TableStep final {
+public:
+    TableStep()
+    {
+        for (auto type : STEP_EVENTS) {
+            handlers_.Register(type, &TableStep::OnStepEvent);
+        }
+    }
+
+    void OnEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        if (!handlers_.Dispatch(*this, context, event)) {
+            ++context.nUnhandled;
+        }
+    }
+
+private:
+    void OnStepEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        ++context.nStepEvents;
+        benchmark::DoNotOptimize(&event);
+    }
+
+    CooperateEventTable<TableStep, TraceContext> handlers_;
+};
+
+class TableMachine final {
+public:
+    TableMachine()
+    {
+        for (auto type : MACHINE_EVENTS) {
+            handlers_.Register(type, &TableMachine::OnMachineEvent);
+        }
+    }
+
+    void OnEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        if (!handlers_.Dispatch(*this, context, event)) {
+            step_.OnEvent(context, event);
+        }
+    }
+
+private:
+    void OnMachineEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        ++context.nMachineEvents;
+        step_.OnEvent(context, event);
+    }
+
+    CooperateEventTable<TableMachine, TraceContext> handlers_;
+    TableStep step_;
+};
+
+class LegacyStep final {
+public:
+    LegacyStep()
+    {
+        for (auto type : STEP_EVENTS) {
+            handlers_.emplace(type, [this](TraceContext &context, const CooperateEvent &event) {
+                this->OnStepEvent(context, event);
+            });
+        }
+    }
+
+    void OnEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        if (auto iter = handlers_.find(event.type); iter != handlers_.end()) {
+            iter->second(context, event);
+        } else {
+            ++context.nUnhandled;
+        }
+    }
+
+private:
+    void OnStepEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        ++context.nStepEvents;
+        benchmark::DoNotOptimize(&event);
+    }
+
+    std::map<CooperateEventType, LegacyHandler> handlers_;
+};
+
+class LegacyMachine final {
+public:
+    LegacyMachine()
+    {
+        for (auto type : MACHINE_EVENTS) {
+            handlers_.emplace(type, [this](TraceContext &context, const CooperateEvent &event) {
+                this->OnMachineEvent(context, event);
+            });
+        }
+    }
+
+    void OnEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        if (auto iter = handlers_.find(event.type); iter != handlers_.end()) {
+            iter->second(context, event);
+        } else {
+            step_.OnEvent(context, event);
+        }
+    }
+
+private:
+    void OnMachineEvent(TraceContext &context, const CooperateEvent &event)
+    {
+        ++context.nMachineEvents;
+        step_.OnEvent(context, event);
+    }
+
+    std::map<CooperateEventType, LegacyHandler> handlers_;
+    LegacyStep step_;
+};
+
+template<typename Machine>
+void ReplayTrace(benchmark::State &state)
+{
+    const std::vector<CooperateEvent> trace = RecordTrace();
+    Machine machine;
+    TraceContext context;
+    for (auto _ : state) {
+        for (const auto &event : trace) {
+            machine.OnEvent(context, event);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * trace.size());
+    state.counters["step_events"] = static_cast<double>(context.nStepEvents) / state.iterations();
+}
+} // namespace
+
+static void BM_ReplayTraceMapDispatch(benchmark::State &state)
+{
+    ReplayTrace<LegacyMachine>(state);
+}
+BENCHMARK(BM_ReplayTraceMapDispatch);
+
+static void BM_ReplayTraceTableDispatch(benchmark::State &state)
+{
+    ReplayTrace<TableMachine>(state);
+}
+BENCHMARK(BM_ReplayTraceTableDispatch);
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
\ No newline at end of file
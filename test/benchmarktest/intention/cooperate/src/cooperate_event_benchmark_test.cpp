@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "channel.h"
+#include "cooperate_events.h"
+
+namespace {
+std::atomic<size_t> g_nAllocations { 0 };
+} // namespace
+
+void *operator new(size_t size)
+{
+    g_nAllocations.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = std::malloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace Cooperate;
+namespace {
+constexpr size_t EVENTS_PER_BATCH { 64 };
+constexpr int32_t POINTER_ACTION_MOVE { 3 };
+const std::string NETWORK_ID(64, 'a');
+
+CooperateEvent MakePointerEvent(int32_t index)
+{
+    return CooperateEvent(
+        CooperateEventType::INPUT_POINTER_EVENT,
+        InputPointerEvent {
+            .deviceId = 1,
+            .pointerAction = POINTER_ACTION_MOVE,
+            .sourceType = 1,
+            .position = Coordinate {
+                .x = index,
+                .y = index,
+            },
+        });
+}
+
+CooperateEvent MakeRemoteStartEvent()
+{
+    return CooperateEvent(
+        CooperateEventType::DSOFTBUS_START_COOPERATE,
+        DSoftbusStartCooperate {
+            .networkId = NETWORK_ID,
+            .originNetworkId = NETWORK_ID,
+        });
+}
+
+bool CoalesceMove(const CooperateEvent &queued, const CooperateEvent &incoming)
+{
+    return ((queued.type == CooperateEventType::INPUT_POINTER_EVENT) &&
+        (incoming.type == CooperateEventType::INPUT_POINTER_EVENT));
+}
+
+// Send batches of events produced by |make| and drain them, counting heap allocations per event sent.
+template<bool byCopy, typename Make>
+void SendAndDrain(benchmark::State &state, Channel<CooperateEvent>::Coalescer coalescer, Make make)
+{
+    auto [sender, receiver] = Channel<CooperateEvent>::OpenChannel(coalescer);
+    receiver.Enable();
+    std::vector<CooperateEvent> events;
+    events.reserve(EVENTS_PER_BATCH);
+    size_t nSent { 0 };
+    size_t nReceived { 0 };
+    size_t nAllocations { 0 };
+    for (auto _ : state) {
+        size_t nAllocationsBefore = g_nAllocations.load(std::memory_order_relaxed);
+        for (size_t index = 0; index < EVENTS_PER_BATCH; ++index) {
+            if constexpr (byCopy) {
+                CooperateEvent event = make(index);
+                sender.Send(event);
+            } else {
+                sender.Send(make(index));
+            }
+        }
+        events.clear();
+        nReceived += receiver.ReceiveBatch(events, EVENTS_PER_BATCH);
+        nAllocations += g_nAllocations.load(std::memory_order_relaxed) - nAllocationsBefore;
+        nSent += EVENTS_PER_BATCH;
+    }
+    state.SetItemsProcessed(nSent);
+    state.counters["allocs_per_event"] = static_cast<double>(nAllocations) / nSent;
+    state.counters["delivered_per_event"] = static_cast<double>(nReceived) / nSent;
+}
+} // namespace
+
+static void BM_SendPointerEventByCopy(benchmark::State &state)
+{
+    SendAndDrain<true>(state, nullptr, MakePointerEvent);
+}
+BENCHMARK(BM_SendPointerEventByCopy);
+
+static void BM_SendPointerEventByMove(benchmark::State &state)
+{
+    SendAndDrain<false>(state, nullptr, MakePointerEvent);
+}
+BENCHMARK(BM_SendPointerEventByMove);
+
+static void BM_SendPointerEventCoalesced(benchmark::State &state)
+{
+    SendAndDrain<false>(state, &CoalesceMove, MakePointerEvent);
+}
+BENCHMARK(BM_SendPointerEventCoalesced);
+
+static void BM_SendRemoteStartByCopy(benchmark::State &state)
+{
+    SendAndDrain<true>(state, nullptr, [](size_t) { return MakeRemoteStartEvent(); });
+}
+BENCHMARK(BM_SendRemoteStartByCopy);
+
+static void BM_SendRemoteStartByMove(benchmark::State &state)
+{
+    SendAndDrain<false>(state, nullptr, [](size_t) { return MakeRemoteStartEvent(); });
+}
+BENCHMARK(BM_SendRemoteStartByMove);
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "devicestatus_define.h"
+#include "input_event_transmission/compact_pointer_event_codec.h"
+#include "input_event_transmission/input_event_serialization.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace Cooperate;
+namespace {
+constexpr int32_t N_EVENTS { 1000 };
+constexpr int32_t DEVICE_ID { 3 };
+constexpr int32_t DISPLAY_WIDTH { 1920 };
+constexpr int32_t DISPLAY_HEIGHT { 1080 };
+constexpr double TRACK_RADIUS { 300.0 };
+constexpr double TRACK_PERIOD { 250.0 };
+constexpr int64_t INPUT_INTERVAL_US { 8000 };
+constexpr int64_t START_TIME { 1000000 };
+constexpr int32_t CLICK_PERIOD { 100 };
+
+// A mouse circling the screen center at 125Hz, pressing its left button now and then.
+std::vector<std::shared_ptr<MMI::PointerEvent>> MakeMouseTrack()
+{
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events;
+    int32_t lastX = DISPLAY_WIDTH / 2;
+    int32_t lastY = DISPLAY_HEIGHT / 2;
+    for (int32_t tick = 0; tick < N_EVENTS; ++tick) {
+        double angle = 2.0 * M_PI * tick / TRACK_PERIOD;
+        int32_t displayX = DISPLAY_WIDTH / 2 + static_cast<int32_t>(TRACK_RADIUS * std::cos(angle));
+        int32_t displayY = DISPLAY_HEIGHT / 2 + static_cast<int32_t>(TRACK_RADIUS * std::sin(angle));
+        int64_t actionTime = START_TIME + tick * INPUT_INTERVAL_US;
+
+        auto pointerEvent = MMI::PointerEvent::Create();
+        pointerEvent->SetId(tick);
+        pointerEvent->SetActionTime(actionTime);
+        pointerEvent->SetActionStartTime(actionTime);
+        pointerEvent->SetSensorInputTime(static_cast<uint64_t>(actionTime));
+        pointerEvent->SetDeviceId(DEVICE_ID);
+        pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+        pointerEvent->SetPointerId(0);
+        bool clicking = ((tick % CLICK_PERIOD) < (CLICK_PERIOD / 10));
+        pointerEvent->SetPointerAction(clicking ?
+            MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN : MMI::PointerEvent::POINTER_ACTION_MOVE);
+        if (clicking) {
+            pointerEvent->SetButtonId(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
+            pointerEvent->SetButtonPressed(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
+        }
+        MMI::PointerEvent::PointerItem item;
+        item.SetPointerId(0);
+        item.SetDeviceId(DEVICE_ID);
+        item.SetPressed(clicking);
+        item.SetDownTime(START_TIME);
+        item.SetDisplayX(displayX);
+        item.SetDisplayY(displayY);
+        item.SetDisplayXPos(displayX);
+        item.SetDisplayYPos(displayY);
+        item.SetRawDx(displayX - lastX);
+        item.SetRawDy(displayY - lastY);
+        pointerEvent->AddPointerItem(item);
+        events.push_back(pointerEvent);
+        lastX = displayX;
+        lastY = displayY;
+    }
+    return events;
+}
+
+void ReportStats(benchmark::State &state, size_t nBytes, size_t nEvents)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(nEvents));
+    state.SetBytesProcessed(static_cast<int64_t>(nBytes));
+    state.counters["bytesPerEvent"] = (nEvents > 0 ? static_cast<double>(nBytes) / nEvents : 0.0);
+}
+} // namespace
+
+static void BM_PointerEventLegacy(benchmark::State &state)
+{
+    auto events = MakeMouseTrack();
+    auto received = MMI::PointerEvent::Create();
+    size_t nBytes { 0 };
+    size_t nEvents { 0 };
+
+    for (auto _ : state) {
+        for (const auto &pointerEvent : events) {
+            NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+            InputEventSerialization::Marshalling(pointerEvent, packet, pointerEvent->GetActionTime());
+            nBytes += packet.Size();
+            received->Reset();
+            int64_t interceptorTime { -1 };
+            benchmark::DoNotOptimize(InputEventSerialization::Unmarshalling(packet, received, interceptorTime));
+        }
+        nEvents += events.size();
+    }
+    ReportStats(state, nBytes, nEvents);
+}
+BENCHMARK(BM_PointerEventLegacy);
+
+static void BM_PointerEventCompact(benchmark::State &state)
+{
+    auto events = MakeMouseTrack();
+    auto received = MMI::PointerEvent::Create();
+    CompactPointerEventEncoder encoder;
+    CompactPointerEventDecoder decoder;
+    size_t nBytes { 0 };
+    size_t nEvents { 0 };
+
+    for (auto _ : state) {
+        for (const auto &pointerEvent : events) {
+            NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+            encoder.Encode(pointerEvent, pointerEvent->GetActionTime(), packet);
+            nBytes += packet.Size();
+            received->Reset();
+            int64_t interceptorTime { -1 };
+            benchmark::DoNotOptimize(decoder.Decode(packet, received, interceptorTime));
+        }
+        nEvents += events.size();
+    }
+    ReportStats(state, nBytes, nEvents);
+}
+BENCHMARK(BM_PointerEventCompact);
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
\ No newline at end of file
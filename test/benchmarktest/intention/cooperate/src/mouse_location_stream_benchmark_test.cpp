@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <string>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include "devicestatus_define.h"
+#include "mouse_location_stream.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace Cooperate;
+namespace {
+constexpr int32_t INPUT_RATE { 1000 };
+constexpr int64_t INPUT_INTERVAL_US { 1000 };
+constexpr size_t MAX_PACKET_SIZE { 1024 };
+constexpr int32_t DISPLAY_WIDTH { 1920 };
+constexpr int32_t DISPLAY_HEIGHT { 1080 };
+constexpr double TRACK_RADIUS { 300.0 };
+constexpr double TRACK_PERIOD { 2000.0 };
+constexpr size_t NETWORK_ID_LENGTH { 64 };
+const std::string LOCAL_NETWORK_ID(NETWORK_ID_LENGTH, 'a');
+const std::string REMOTE_NETWORK_ID(NETWORK_ID_LENGTH, 'b');
+
+// A mouse circling the screen center, sampled once per millisecond.
+StreamLocation GetTrackLocation(int32_t tick)
+{
+    double angle = 2.0 * M_PI * tick / TRACK_PERIOD;
+    return StreamLocation {
+        .displayX = DISPLAY_WIDTH / 2 + static_cast<int32_t>(TRACK_RADIUS * std::cos(angle)),
+        .displayY = DISPLAY_HEIGHT / 2 + static_cast<int32_t>(TRACK_RADIUS * std::sin(angle)),
+        .displayWidth = DISPLAY_WIDTH,
+        .displayHeight = DISPLAY_HEIGHT,
+    };
+}
+
+int64_t GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+class Loopback final {
+public:
+    Loopback()
+    {
+        if (::socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds_) != 0) {
+            fds_[0] = -1;
+            fds_[1] = -1;
+        }
+    }
+
+    ~Loopback()
+    {
+        for (auto fd : fds_) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    bool IsValid() const
+    {
+        return ((fds_[0] >= 0) && (fds_[1] >= 0));
+    }
+
+    // Send the packet to the other end of the loopback, hand what arrives to the handler,
+    // and return the number of bytes put on the wire.
+    template<typename Handler>
+    size_t Transfer(const NetPacket &packet, Handler handler)
+    {
+        StreamBuffer buf;
+        if (!packet.MakeData(buf) || (::send(fds_[0], buf.Data(), buf.Size(), 0) < 0)) {
+            return 0;
+        }
+        char data[MAX_PACKET_SIZE] {};
+        ssize_t nBytes = ::recv(fds_[1], data, sizeof(data), 0);
+        if (nBytes < static_cast<ssize_t>(sizeof(PackHead))) {
+            return 0;
+        }
+        PackHead head;
+        if (memcpy_s(&head, sizeof(head), data, sizeof(head)) != EOK) {
+            return 0;
+        }
+        NetPacket received(head.idMsg);
+        if (!received.Write(data + sizeof(PackHead), static_cast<size_t>(head.size))) {
+            return 0;
+        }
+        handler(received);
+        return buf.Size();
+    }
+
+private:
+    int32_t fds_[2] { -1, -1 };
+};
+
+struct StreamStats {
+    size_t nBytes { 0 };
+    size_t nPackets { 0 };
+    int64_t wireLatency { 0 };
+    int64_t pacingLatency { 0 };
+};
+
+void ReportStats(benchmark::State &state, const StreamStats &stats)
+{
+    // Each iteration replays one second of input, so per-iteration averages are per second.
+    state.counters["bytes_per_second"] = benchmark::Counter(stats.nBytes, benchmark::Counter::kAvgIterations);
+    state.counters["packets_per_second"] = benchmark::Counter(stats.nPackets, benchmark::Counter::kAvgIterations);
+    if (stats.nPackets > 0) {
+        state.counters["wire_latency_us"] = static_cast<double>(stats.wireLatency) / stats.nPackets;
+        state.counters["pacing_latency_us"] = static_cast<double>(stats.pacingLatency) / stats.nPackets;
+    }
+}
+} // namespace
+
+static void BM_MouseLocationSync(benchmark::State &state)
+{
+    Loopback loopback;
+    if (!loopback.IsValid()) {
+        state.SkipWithError("Failed to create loopback");
+        return;
+    }
+    StreamStats stats;
+    for (auto _ : state) {
+        for (int32_t tick = 0; tick < INPUT_RATE; ++tick) {
+            StreamLocation location = GetTrackLocation(tick);
+            int64_t startTime = GetNowUs();
+            NetPacket packet(MessageId::DSOFTBUS_MOUSE_LOCATION);
+            packet << LOCAL_NETWORK_ID << REMOTE_NETWORK_ID << location.displayX << location.displayY <<
+                location.displayWidth << location.displayHeight;
+            stats.nBytes += loopback.Transfer(packet, [](NetPacket &received) {
+                std::string networkId;
+                std::string remoteNetworkId;
+                StreamLocation decoded;
+                received >> networkId >> remoteNetworkId >> decoded.displayX >> decoded.displayY >>
+                    decoded.displayWidth >> decoded.displayHeight;
+                benchmark::DoNotOptimize(decoded);
+            });
+            stats.wireLatency += GetNowUs() - startTime;
+            ++stats.nPackets;
+        }
+    }
+    ReportStats(state, stats);
+}
+BENCHMARK(BM_MouseLocationSync)->UseRealTime();
+
+static void BM_MouseLocationStream(benchmark::State &state)
+{
+    const auto frameRate = static_cast<int32_t>(state.range(0));
+    Loopback loopback;
+    if (!loopback.IsValid()) {
+        state.SkipWithError("Failed to create loopback");
+        return;
+    }
+    StreamStats stats;
+    uint16_t sessionId { 0 };
+    for (auto _ : state) {
+        MouseLocationStreamEncoder encoder(++sessionId, frameRate);
+        MouseLocationStreamDecoder decoder;
+        int64_t firstPendingTime { -1 };
+        for (int32_t tick = 0; tick < INPUT_RATE; ++tick) {
+            int64_t now = tick * INPUT_INTERVAL_US;
+            encoder.Push(GetTrackLocation(tick));
+            if (firstPendingTime < 0) {
+                firstPendingTime = now;
+            }
+            if (encoder.GetDelay(now) != 0) {
+                continue;
+            }
+            int64_t startTime = GetNowUs();
+            NetPacket packet(MessageId::DSOFTBUS_MOUSE_LOCATION_STREAM);
+            if (!encoder.Encode(now, packet)) {
+                continue;
+            }
+            stats.nBytes += loopback.Transfer(packet, [&decoder](NetPacket &received) {
+                LocationFrame frame;
+                StreamLocation decoded;
+                if (MouseLocationStreamDecoder::ReadFrame(received, frame) == RET_OK) {
+                    benchmark::DoNotOptimize(decoder.Apply(frame, decoded));
+                }
+            });
+            stats.wireLatency += GetNowUs() - startTime;
+            // Age of the oldest location coalesced into this frame.
+            stats.pacingLatency += now - firstPendingTime;
+            firstPendingTime = -1;
+            ++stats.nPackets;
+        }
+    }
+    ReportStats(state, stats);
+}
+BENCHMARK(BM_MouseLocationStream)->Arg(30)->Arg(60)->Arg(120)->Arg(INPUT_RATE)->UseRealTime();
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
\ No newline at end of file
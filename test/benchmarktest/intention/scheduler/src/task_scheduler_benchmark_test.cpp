@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+
+#include <benchmark/benchmark.h>
+
+#include "devicestatus_define.h"
+#include "task_scheduler.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int32_t POLL_TIMEOUT_MS { 10 };
+constexpr int64_t TASKS_PER_PRODUCER { 20000 };
+constexpr int64_t MAX_PRODUCERS { 4 };
+
+class Worker {
+public:
+    explicit Worker(TaskScheduler &scheduler) : scheduler_(scheduler)
+    {
+        std::promise<void> started;
+        auto future = started.get_future();
+        thread_ = std::thread([this, &started] {
+            scheduler_.SetWorkerThreadId(GetThisThreadId());
+            started.set_value();
+            struct pollfd pfd { scheduler_.GetReadFd(), POLLIN, 0 };
+            while (running_.load()) {
+                if (::poll(&pfd, 1, POLL_TIMEOUT_MS) > 0) {
+                    scheduler_.ProcessTasks();
+                }
+            }
+        });
+        future.wait();
+    }
+
+    ~Worker()
+    {
+        running_ = false;
+        thread_.join();
+    }
+
+private:
+    TaskScheduler &scheduler_;
+    std::atomic_bool running_ { true };
+    std::thread thread_;
+};
+
+void PostAll(TaskScheduler &scheduler, int64_t count, std::atomic<int64_t> &nDone)
+{
+    for (int64_t index = 0; index < count;) {
+        int32_t ret = scheduler.PostAsyncTask([&nDone] {
+            nDone.fetch_add(1, std::memory_order_relaxed);
+            return RET_OK;
+        });
+        if (ret == RET_OK) {
+            ++index;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+} // namespace
+
+static void BM_PostAsyncTask(benchmark::State &state)
+{
+    const auto nProducers = state.range(0);
+    TaskScheduler scheduler;
+    scheduler.Init();
+    Worker worker(scheduler);
+
+    for (auto _ : state) {
+        std::atomic<int64_t> nDone { 0 };
+        std::vector<std::thread> producers;
+        for (int64_t id = 0; id < nProducers; ++id) {
+            producers.emplace_back(PostAll, std::ref(scheduler), TASKS_PER_PRODUCER, std::ref(nDone));
+        }
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        while (nDone.load(std::memory_order_relaxed) < nProducers * TASKS_PER_PRODUCER) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * nProducers * TASKS_PER_PRODUCER);
+}
+BENCHMARK(BM_PostAsyncTask)->RangeMultiplier(2)->Range(1, MAX_PRODUCERS)->UseRealTime();
+
+static void BM_PostSyncTask(benchmark::State &state)
+{
+    TaskScheduler scheduler;
+    scheduler.Init();
+    Worker worker(scheduler);
+    int32_t value = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scheduler.PostSyncTask([&value] {
+            return ++value;
+        }));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PostSyncTask)->UseRealTime();
+
+static void BM_PostSyncTaskOnWorker(benchmark::State &state)
+{
+    TaskScheduler scheduler;
+    scheduler.Init();
+    scheduler.SetWorkerThreadId(GetThisThreadId());
+    int32_t value = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scheduler.PostSyncTask([&value] {
+            return ++value;
+        }));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PostSyncTaskOnWorker);
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "timer_wheel.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int64_t START_TIME { 1000 };
+constexpr int32_t MIN_INTERVAL_MS { 50 };
+constexpr int32_t MAX_INTERVAL_MS { 10000 };
+constexpr int32_t REPEAT_ONCE { 1 };
+constexpr int64_t N_TIMERS { 10000 };
+constexpr int32_t MAX_STEP_MS { 16 };
+
+// Storage of the former TimerManager: a list kept sorted by expiry time, searched by id.
+class SortedListTimers {
+public:
+    int32_t AddTimer(int64_t nowTime, int32_t intervalMs, std::function<void()> callback)
+    {
+        auto timer = std::make_unique<Item>(Item { nextId_++, nowTime + intervalMs, intervalMs, callback });
+        auto iter = timers_.begin();
+        while ((iter != timers_.end()) && ((*iter)->expireTime <= timer->expireTime)) {
+            ++iter;
+        }
+        int32_t timerId = timer->id;
+        timers_.insert(iter, std::move(timer));
+        return timerId;
+    }
+
+    void RemoveTimer(int32_t timerId)
+    {
+        for (auto iter = timers_.begin(); iter != timers_.end(); ++iter) {
+            if ((*iter)->id == timerId) {
+                timers_.erase(iter);
+                return;
+            }
+        }
+    }
+
+private:
+    struct Item {
+        int32_t id { 0 };
+        int64_t expireTime { 0 };
+        int32_t intervalMs { 0 };
+        std::function<void()> callback;
+    };
+    int32_t nextId_ { 0 };
+    std::list<std::unique_ptr<Item>> timers_;
+};
+
+std::vector<int32_t> MakeIntervals(size_t count)
+{
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int32_t> dist(MIN_INTERVAL_MS, MAX_INTERVAL_MS);
+    std::vector<int32_t> intervals(count);
+    for (auto &interval : intervals) {
+        interval = dist(rng);
+    }
+    return intervals;
+}
+} // namespace
+
+static void BM_TimerWheelChurn(benchmark::State &state)
+{
+    const auto nTimers = static_cast<size_t>(state.range(0));
+    auto intervals = MakeIntervals(nTimers);
+    std::vector<int32_t> timerIds(nTimers);
+
+    for (auto _ : state) {
+        TimerWheel wheel;
+        for (size_t index = 0; index < nTimers; ++index) {
+            timerIds[index] = wheel.AddTimer(START_TIME, intervals[index], REPEAT_ONCE, [] {});
+        }
+        for (size_t index = 0; index < nTimers; index += 2) {
+            wheel.ResetTimer(START_TIME + MIN_INTERVAL_MS, timerIds[index]);
+        }
+        for (size_t index = 0; index < nTimers; ++index) {
+            wheel.RemoveTimer(timerIds[index]);
+        }
+        benchmark::DoNotOptimize(wheel.GetTimerCount());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimerWheelChurn)->Arg(64)->Arg(1000)->Arg(N_TIMERS);
+
+static void BM_SortedListChurn(benchmark::State &state)
+{
+    const auto nTimers = static_cast<size_t>(state.range(0));
+    auto intervals = MakeIntervals(nTimers);
+    std::vector<int32_t> timerIds(nTimers);
+
+    for (auto _ : state) {
+        SortedListTimers timers;
+        for (size_t index = 0; index < nTimers; ++index) {
+            timerIds[index] = timers.AddTimer(START_TIME, intervals[index], [] {});
+        }
+        for (size_t index = 0; index < nTimers; index += 2) {
+            timers.RemoveTimer(timerIds[index]);
+            timerIds[index] = timers.AddTimer(START_TIME + MIN_INTERVAL_MS, intervals[index], [] {});
+        }
+        for (size_t index = 0; index < nTimers; ++index) {
+            timers.RemoveTimer(timerIds[index]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortedListChurn)->Arg(64)->Arg(1000)->Arg(N_TIMERS);
+
+static void BM_TimerWheelExpire(benchmark::State &state)
+{
+    const auto nTimers = static_cast<size_t>(state.range(0));
+    auto intervals = MakeIntervals(nTimers);
+    size_t nFired = 0;
+
+    for (auto _ : state) {
+        TimerWheel wheel;
+        for (size_t index = 0; index < nTimers; ++index) {
+            wheel.AddTimer(START_TIME, intervals[index], REPEAT_ONCE, [&nFired] { ++nFired; });
+        }
+        for (int64_t nowTime = START_TIME; wheel.GetTimerCount() > 0; nowTime += MAX_STEP_MS) {
+            wheel.ProcessTimers(nowTime);
+        }
+    }
+    benchmark::DoNotOptimize(nFired);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimerWheelExpire)->Arg(64)->Arg(1000)->Arg(N_TIMERS);
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
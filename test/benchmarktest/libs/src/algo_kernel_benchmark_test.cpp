@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "algo_kernel.h"
+#include "devicestatus_data_define.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr uint32_t TRACE_SEED { 20250101 };
+constexpr size_t TRACE_SIZE { 4096 };
+constexpr size_t SAMPLES_PER_POSTURE { 40 };
+constexpr int64_t MIN_WINDOW_SIZE { 8 };
+constexpr int64_t MAX_WINDOW_SIZE { 512 };
+constexpr float GRAVITY { 9.80665F };
+constexpr float NOISE { 0.3F };
+
+using WindowJudge = void (*)(const AccelWindow &window, SampleVerdict *verdicts);
+using SampleJudge = SampleVerdict (*)(float x, float y, float z);
+
+struct Algorithm {
+    const char *name;
+    WindowJudge windowJudge;
+    SampleJudge sampleJudge;
+};
+
+const std::vector<Algorithm> ALGORITHMS {
+    { "absoluteStill", &AlgoKernel::JudgeAbsoluteStill, &AlgoKernel::JudgeAbsoluteStill },
+    { "horizontal", &AlgoKernel::JudgeHorizontal, &AlgoKernel::JudgeHorizontal },
+    { "vertical", &AlgoKernel::JudgeVertical, &AlgoKernel::JudgeVertical },
+};
+
+// Accelerometer samples of a device turned into a new posture every few seconds, in the axes of the sensor.
+struct AccelTrace {
+    AccelTrace()
+    {
+        std::mt19937 engine(TRACE_SEED);
+        std::uniform_real_distribution<float> angle(-PI, PI);
+        std::normal_distribution<float> noise(0.0F, NOISE);
+        float pitch = 0.0F;
+        float roll = 0.0F;
+        for (size_t index = 0; index < TRACE_SIZE; ++index) {
+            if ((index % SAMPLES_PER_POSTURE) == 0) {
+                pitch = angle(engine);
+                roll = angle(engine);
+            }
+            x.push_back(GRAVITY * std::sin(roll) * std::cos(pitch) + noise(engine));
+            y.push_back(GRAVITY * std::sin(pitch) + noise(engine));
+            z.push_back(GRAVITY * std::cos(roll) * std::cos(pitch) + noise(engine));
+        }
+    }
+
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+};
+
+const AccelTrace &GetTrace()
+{
+    static const AccelTrace trace;
+    return trace;
+}
+
+// What AlgoBase::SetData() and ExecuteOperation() do for one sample.
+SampleVerdict JudgeSample(const AccelTrace &trace, size_t index, SampleJudge sampleJudge)
+{
+    if ((std::abs(trace.x[index]) > ACC_VALID_THRHD) || (std::abs(trace.y[index]) > ACC_VALID_THRHD) ||
+        (std::abs(trace.z[index]) > ACC_VALID_THRHD)) {
+        return VERDICT_SKIP;
+    }
+    return sampleJudge(trace.y[index], trace.x[index], -trace.z[index]);
+}
+
+void BM_JudgeBySample(benchmark::State &state)
+{
+    const Algorithm &algorithm = ALGORITHMS[state.range(0)];
+    const AccelTrace &trace = GetTrace();
+    size_t windowSize = static_cast<size_t>(state.range(1));
+    std::vector<SampleVerdict> verdicts(windowSize);
+    size_t begin = 0;
+    for (auto _ : state) {
+        for (size_t index = 0; index < windowSize; ++index) {
+            verdicts[index] = JudgeSample(trace, begin + index, algorithm.sampleJudge);
+        }
+        benchmark::DoNotOptimize(verdicts.data());
+        begin = (begin + windowSize) % (TRACE_SIZE - windowSize);
+    }
+    state.SetLabel(algorithm.name);
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+void BM_JudgeByWindow(benchmark::State &state)
+{
+    const Algorithm &algorithm = ALGORITHMS[state.range(0)];
+    const AccelTrace &trace = GetTrace();
+    size_t windowSize = static_cast<size_t>(state.range(1));
+    std::vector<SampleVerdict> verdicts(windowSize);
+    size_t begin = 0;
+    for (auto _ : state) {
+        algorithm.windowJudge(AccelWindow { trace.x.data() + begin, trace.y.data() + begin,
+            trace.z.data() + begin, windowSize }, verdicts.data());
+        benchmark::DoNotOptimize(verdicts.data());
+        begin = (begin + windowSize) % (TRACE_SIZE - windowSize);
+    }
+    state.SetLabel(algorithm.name);
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+BENCHMARK(BM_JudgeBySample)->ArgsProduct({ { 0, 1, 2 }, { MIN_WINDOW_SIZE, MAX_WINDOW_SIZE } });
+BENCHMARK(BM_JudgeByWindow)->ArgsProduct({ { 0, 1, 2 }, { MIN_WINDOW_SIZE, MAX_WINDOW_SIZE } });
+} // namespace
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
\ No newline at end of file
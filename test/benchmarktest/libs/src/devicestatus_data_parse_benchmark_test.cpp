@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <sys/stat.h>
+
+#include "devicestatus_data_parse.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr size_t READ_DATA_BUFF_SIZE { 256 };
+const std::string MSDP_DATA_PATH { "/data/msdp/device_status_data.json" };
+const std::string MOCK_DATA {
+    R"({"absoluteStill":[1,2,1,2],"horizontalPosition":[1,2,1,2],"verticalPosition":[1,2,1,2],)"
+    R"("still":[1,2,1,2],"relativeStill":[1,2,1,2],"carBluetooth":[1,2,1,2],"LID_OPEN":[1,2,1,2]})"
+};
+
+// Keeps the device's own mock data file intact across one benchmark.
+class MockDataFile {
+public:
+    MockDataFile()
+    {
+        std::ifstream file(MSDP_DATA_PATH);
+        std::ostringstream content;
+        content << file.rdbuf();
+        original_ = content.str();
+        std::ofstream(MSDP_DATA_PATH, std::ios::out | std::ios::trunc) << MOCK_DATA;
+    }
+
+    ~MockDataFile()
+    {
+        std::ofstream(MSDP_DATA_PATH, std::ios::out | std::ios::trunc) << original_;
+    }
+
+private:
+    std::string original_;
+};
+
+// What every call did before the file was kept as a parsed snapshot: check the
+// path, read the whole file through stdio and parse it again.
+std::string ReadMockDataFile()
+{
+    char realPath[PATH_MAX] = { 0 };
+    struct stat statBuf {};
+    if ((realpath(MSDP_DATA_PATH.c_str(), realPath) == nullptr) || (stat(realPath, &statBuf) != 0)) {
+        return {};
+    }
+    FILE *fp = fopen(realPath, "r");
+    if (fp == nullptr) {
+        return {};
+    }
+    std::string dataStr;
+    char buf[READ_DATA_BUFF_SIZE] = { 0 };
+    while (fgets(buf, sizeof(buf), fp) != nullptr) {
+        dataStr += buf;
+    }
+    fclose(fp);
+    return dataStr;
+}
+
+void BM_ParseDeviceStatusDataFromFile(benchmark::State &state)
+{
+    MockDataFile mockDataFile;
+    DeviceStatusDataParse dataParse;
+    Data data;
+    int32_t type = Type::TYPE_ABSOLUTE_STILL;
+    for (auto _ : state) {
+        Type curType = static_cast<Type>(type);
+        benchmark::DoNotOptimize(dataParse.DeviceStatusDataInit(ReadMockDataFile(), true, curType, data));
+        type = (type + 1) % Type::TYPE_STAND;
+    }
+    state.counters["calls"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+void BM_ParseDeviceStatusDataFromSnapshot(benchmark::State &state)
+{
+    MockDataFile mockDataFile;
+    DeviceStatusDataParse dataParse;
+    Data data;
+    int32_t type = Type::TYPE_ABSOLUTE_STILL;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dataParse.ParseDeviceStatusData(static_cast<Type>(type), data));
+        type = (type + 1) % Type::TYPE_STAND;
+    }
+    state.counters["calls"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_ParseDeviceStatusDataFromFile);
+BENCHMARK(BM_ParseDeviceStatusDataFromSnapshot);
+} // namespace
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "boomerang_codec_pool.h"
+#include "devicestatus_define.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int32_t IMAGE_WIDTH { 1280 };
+constexpr int32_t IMAGE_HEIGHT { 720 };
+constexpr size_t N_IMAGES { 8 };
+constexpr size_t JOBS_PER_ITERATION { 32 };
+constexpr double PERCENTILE_50 { 0.5 };
+constexpr double PERCENTILE_99 { 0.99 };
+const std::string METADATA { "https://www.example.com/boomerang" };
+
+int64_t GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Stands in for the algorithm library: walks every pixel once, roughly the
+// memory traffic of embedding or extracting a watermark.
+uint32_t ScanPixels(const std::shared_ptr<Media::PixelMap> &pixelMap)
+{
+    const uint8_t *pixels = pixelMap->GetPixels();
+    int32_t nBytes = pixelMap->GetByteCount();
+    uint32_t digest = 0;
+    for (int32_t index = 0; (pixels != nullptr) && (index < nBytes); ++index) {
+        digest = (digest << 1) ^ pixels[index];
+    }
+    return digest;
+}
+
+void SyntheticEncode(std::shared_ptr<Media::PixelMap> &pixelMap, const std::string &content,
+    std::shared_ptr<Media::PixelMap> &resultPixelMap)
+{
+    benchmark::DoNotOptimize(ScanPixels(pixelMap));
+    resultPixelMap = pixelMap;
+}
+
+void SyntheticDecode(std::shared_ptr<Media::PixelMap> &pixelMap, std::string &content)
+{
+    benchmark::DoNotOptimize(ScanPixels(pixelMap));
+    content = METADATA;
+}
+
+const BoomerangCodec SYNTHETIC_CODEC { &SyntheticEncode, &SyntheticDecode };
+
+std::vector<std::shared_ptr<Media::PixelMap>> CreatePixelMaps()
+{
+    std::vector<std::shared_ptr<Media::PixelMap>> pixelMaps;
+    Media::InitializationOptions options;
+    options.size = { IMAGE_WIDTH, IMAGE_HEIGHT };
+    options.pixelFormat = Media::PixelFormat::BGRA_8888;
+    for (size_t index = 0; index < N_IMAGES; ++index) {
+        std::shared_ptr<Media::PixelMap> pixelMap = Media::PixelMap::Create(options);
+        if (pixelMap == nullptr) {
+            return {};
+        }
+        pixelMaps.push_back(pixelMap);
+    }
+    return pixelMaps;
+}
+
+class LatencyRecorder final {
+public:
+    void Record(int64_t latency)
+    {
+        std::lock_guard guard(mutex_);
+        latencies_.push_back(latency);
+        cv_.notify_all();
+    }
+
+    void WaitFor(size_t nRecords)
+    {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this, nRecords] { return (latencies_.size() >= nRecords); });
+    }
+
+    size_t Count()
+    {
+        std::lock_guard guard(mutex_);
+        return latencies_.size();
+    }
+
+    void Report(benchmark::State &state)
+    {
+        std::lock_guard guard(mutex_);
+        if (latencies_.empty()) {
+            return;
+        }
+        std::sort(latencies_.begin(), latencies_.end());
+        auto percentile = [this](double ratio) {
+            return static_cast<double>(latencies_[static_cast<size_t>(ratio * (latencies_.size() - 1))]);
+        };
+        state.counters["p50_latency_us"] = percentile(PERCENTILE_50);
+        state.counters["p99_latency_us"] = percentile(PERCENTILE_99);
+        state.counters["max_latency_us"] = static_cast<double>(latencies_.back());
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<int64_t> latencies_;
+};
+} // namespace
+
+// Every request runs the codec on the calling thread, one after another.
+static void BM_BoomerangCodecInline(benchmark::State &state)
+{
+    auto pixelMaps = CreatePixelMaps();
+    if (pixelMaps.empty()) {
+        state.SkipWithError("Failed to create pixel maps");
+        return;
+    }
+    LatencyRecorder recorder;
+    for (auto _ : state) {
+        for (size_t index = 0; index < JOBS_PER_ITERATION; ++index) {
+            auto &pixelMap = pixelMaps[index % pixelMaps.size()];
+            int64_t submitTime = GetNowUs();
+            std::shared_ptr<Media::PixelMap> resultPixelMap;
+            SyntheticEncode(pixelMap, METADATA, resultPixelMap);
+            recorder.Record(GetNowUs() - submitTime);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+    recorder.Report(state);
+}
+
+// Requests go through the pool, @state.range(0) workers wide; a rejected
+// request is retried once an earlier one has completed.
+static void BM_BoomerangCodecPool(benchmark::State &state)
+{
+    auto pixelMaps = CreatePixelMaps();
+    if (pixelMaps.empty()) {
+        state.SkipWithError("Failed to create pixel maps");
+        return;
+    }
+    BoomerangCodecPoolOptions options;
+    options.nWorkers = static_cast<size_t>(state.range(0));
+    options.maxConcurrentCalls = options.nWorkers;
+    BoomerangCodecPool pool(SYNTHETIC_CODEC, options);
+    LatencyRecorder recorder;
+    size_t nSubmitted = 0;
+
+    for (auto _ : state) {
+        for (size_t index = 0; index < JOBS_PER_ITERATION; ++index) {
+            auto &pixelMap = pixelMaps[index % pixelMaps.size()];
+            int64_t submitTime = GetNowUs();
+            auto done = [&recorder, submitTime](std::shared_ptr<Media::PixelMap> resultPixelMap) {
+                benchmark::DoNotOptimize(resultPixelMap);
+                recorder.Record(GetNowUs() - submitTime);
+            };
+            while (pool.SubmitEncode(pixelMap, METADATA, done) != RET_OK) {
+                recorder.WaitFor(recorder.Count() + 1);
+            }
+            ++nSubmitted;
+        }
+        recorder.WaitFor(nSubmitted);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+    state.counters["rejected"] = static_cast<double>(pool.GetMetrics().nRejected);
+    recorder.Report(state);
+}
+
+BENCHMARK(BM_BoomerangCodecInline)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_BoomerangCodecPool)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
\ No newline at end of file
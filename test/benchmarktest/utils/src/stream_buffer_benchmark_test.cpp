@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "circle_stream_buffer.h"
+#include "net_packet.h"
+#include "net_packet_view.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace {
+constexpr int64_t MIN_PAYLOAD_SIZE { 16 };
+constexpr int64_t MAX_PAYLOAD_SIZE { 2000 };
+constexpr int32_t FIELD_SIZE { static_cast<int32_t>(sizeof(int32_t)) };
+} // namespace
+
+static void BuildPacket(NetPacket &pkt, int32_t nFields)
+{
+    for (int32_t index = 0; index < nFields; ++index) {
+        pkt << index;
+    }
+}
+
+static void BM_NetPacketBuild(benchmark::State &state)
+{
+    const auto nFields = static_cast<int32_t>(state.range(0)) / FIELD_SIZE;
+    for (auto _ : state) {
+        NetPacket pkt(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+        BuildPacket(pkt, nFields);
+        StreamBuffer buffer;
+        pkt.MakeData(buffer);
+        benchmark::DoNotOptimize(buffer.Data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NetPacketBuild)->RangeMultiplier(4)->Range(MIN_PAYLOAD_SIZE, MAX_PAYLOAD_SIZE);
+
+static void BM_NetPacketParse(benchmark::State &state)
+{
+    const auto nFields = static_cast<int32_t>(state.range(0)) / FIELD_SIZE;
+    NetPacket pkt(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    BuildPacket(pkt, nFields);
+    StreamBuffer wire;
+    pkt.MakeData(wire);
+    CircleStreamBuffer circBuf;
+
+    for (auto _ : state) {
+        circBuf.Write(wire.Data(), wire.Size());
+        const PackHead *head = reinterpret_cast<const PackHead *>(circBuf.ReadBuf());
+        NetPacket packet(head->idMsg);
+        packet.Write(circBuf.ReadBuf() + sizeof(PackHead), head->size);
+        circBuf.SeekReadPos(packet.GetPacketLength());
+        int32_t value = 0;
+        for (int32_t index = 0; index < nFields; ++index) {
+            packet >> value;
+        }
+        benchmark::DoNotOptimize(value);
+        circBuf.Reset();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NetPacketParse)->RangeMultiplier(4)->Range(MIN_PAYLOAD_SIZE, MAX_PAYLOAD_SIZE);
+
+static void BM_NetPacketViewParse(benchmark::State &state)
+{
+    const auto nFields = static_cast<int32_t>(state.range(0)) / FIELD_SIZE;
+    NetPacket pkt(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    BuildPacket(pkt, nFields);
+    StreamBuffer wire;
+    pkt.MakeData(wire);
+    CircleStreamBuffer circBuf;
+
+    for (auto _ : state) {
+        circBuf.Write(wire.Data(), wire.Size());
+        const PackHead *head = reinterpret_cast<const PackHead *>(circBuf.ReadBuf());
+        NetPacketView packet(head->idMsg, circBuf.ReadBuf() + sizeof(PackHead), static_cast<size_t>(head->size));
+        circBuf.SeekReadPos(packet.GetPacketLength());
+        int32_t value = 0;
+        for (int32_t index = 0; index < nFields; ++index) {
+            packet >> value;
+        }
+        benchmark::DoNotOptimize(value);
+        circBuf.Reset();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NetPacketViewParse)->RangeMultiplier(4)->Range(MIN_PAYLOAD_SIZE, MAX_PAYLOAD_SIZE);
+
+static void BM_NetPacketCopy(benchmark::State &state)
+{
+    const auto nFields = static_cast<int32_t>(state.range(0)) / FIELD_SIZE;
+    NetPacket pkt(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    BuildPacket(pkt, nFields);
+
+    for (auto _ : state) {
+        NetPacket copy(pkt);
+        benchmark::DoNotOptimize(copy.Data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NetPacketCopy)->RangeMultiplier(4)->Range(MIN_PAYLOAD_SIZE, MAX_PAYLOAD_SIZE);
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -39,12 +39,11 @@ bool AdapterSendHeartBeatFuzzTest(const uint8_t* data, size_t size)
 {
     FuzzedDataProvider provider(data, size);
     std::string networkId = provider.ConsumeBytesAsString(STR_LEN);
-    bool state = provider.ConsumeBool();
+    DSoftbusLinkState linkState;
 
     DSoftbusAdapterImpl::GetInstance()->StartHeartBeat(networkId);
-    DSoftbusAdapterImpl::GetInstance()->GetHeartBeatState(networkId);
-    DSoftbusAdapterImpl::GetInstance()->KeepHeartBeating(networkId);
-    DSoftbusAdapterImpl::GetInstance()->UpdateHeartBeatState(networkId, state);
+    DSoftbusAdapterImpl::GetInstance()->OnHeartBeatTick();
+    DSoftbusAdapterImpl::GetInstance()->GetLinkState(networkId, linkState);
     DSoftbusAdapterImpl::GetInstance()->StopHeartBeat(networkId);
 
     return true;
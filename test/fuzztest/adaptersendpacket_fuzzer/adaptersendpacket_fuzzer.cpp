@@ -49,7 +49,8 @@ bool AdapterSendPacketFuzzTest(const uint8_t* data, size_t size)
     DSoftbusAdapterImpl::GetInstance()->SendPacket(networkId, packet);
     DSoftbusAdapterImpl::GetInstance()->SendParcel(networkId, parcel);
     DSoftbusAdapterImpl::GetInstance()->BroadcastPacket(packet);
-    DSoftbusAdapterImpl::GetInstance()->HandlePacket(networkId, packet);
+    NetPacketView view(MessageId::DSOFTBUS_START_COOPERATE, reinterpret_cast<const char *>(data), size);
+    DSoftbusAdapterImpl::GetInstance()->HandlePacket(networkId, view);
     return true;
 }
 
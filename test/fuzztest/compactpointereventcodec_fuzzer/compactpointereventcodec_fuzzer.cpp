@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compactpointereventcodec_fuzzer.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include "devicestatus_define.h"
+#include "input_event_transmission/compact_pointer_event_codec.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CompactPointerEventCodecFuzzTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace Cooperate;
+namespace {
+bool EncodeKeyframe(const PointerEventRecord &record, std::vector<char> &bytes)
+{
+    CompactPointerEventEncoder encoder;
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    if (encoder.Encode(record, packet) != RET_OK) {
+        return false;
+    }
+    bytes.assign(packet.ReadBuf(), packet.ReadBuf() + packet.ResidualSize());
+    return true;
+}
+
+// Every record the decoder accepts must survive encode -> decode bit for bit.
+void CheckRoundTrip(const PointerEventRecord &record)
+{
+    std::vector<char> encoded;
+    if (!EncodeKeyframe(record, encoded)) {
+        FI_HILOGE("Decoded record is not encodable");
+        abort();
+    }
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    packet.Write(encoded.data(), encoded.size());
+    CompactPointerEventDecoder decoder;
+    PointerEventRecord decoded;
+    std::vector<char> reencoded;
+    if ((decoder.Decode(packet, decoded) != RET_OK) || !EncodeKeyframe(decoded, reencoded) ||
+        (reencoded != encoded)) {
+        FI_HILOGE("Round trip of compact pointer event mismatched");
+        abort();
+    }
+}
+} // namespace
+
+bool CompactPointerEventCodecFuzzTest(const uint8_t *data, size_t size)
+{
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    if (!packet.Write(reinterpret_cast<const char *>(data), size)) {
+        return false;
+    }
+    CompactPointerEventDecoder decoder;
+    PointerEventRecord record;
+    while ((packet.ResidualSize() > 0) && (decoder.Decode(packet, record) == RET_OK)) {
+        CheckRoundTrip(record);
+    }
+    return true;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+/* Fuzzer entry point */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if ((data == nullptr) || (size == 0)) {
+        return 0;
+    }
+    OHOS::Msdp::DeviceStatus::CompactPointerEventCodecFuzzTest(data, size);
+    return 0;
+}
\ No newline at end of file
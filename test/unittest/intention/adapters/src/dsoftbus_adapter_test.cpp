@@ -13,7 +13,10 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include <unistd.h>
@@ -52,6 +55,8 @@ constexpr size_t PKG_NAME_SIZE_MAX { 65 };
 constexpr int32_t SOCKET_SERVER { 0 };
 constexpr int32_t SOCKET_CLIENT { 1 };
 constexpr int32_t SOCKET { 1 };
+constexpr int32_t SOCKET_OTHER { 2 };
+constexpr int32_t TIME_SLOW_SEND_MS { 300 };
 const char* g_cores[] = { "ohos.permission.INPUT_MONITORING" };
 } // namespace
 
@@ -115,14 +120,17 @@ public:
     void OnBind(const std::string &networkId) {}
     void OnShutdown(const std::string &networkId) {}
     void OnConnected(const std::string &networkId) {}
-    bool OnPacket(const std::string &networkId, NetPacket &packet)
+    bool OnPacket(const std::string &networkId, NetPacketView &packet)
     {
+        ++nPackets_;
         return true;
     }
     bool OnRawData(const std::string &networkId, const void *data, uint32_t dataLen)
     {
         return true;
     }
+
+    int32_t nPackets_ { 0 };
 };
 
 std::string DsoftbusAdapterTest::GetLocalNetworkId()
@@ -576,7 +584,7 @@ HWTEST_F(DsoftbusAdapterTest, TestHandlePacket, TestSize.Level1)
     CALL_TEST_DEBUG;
     SetPermission(SYSTEM_CORE, g_cores, sizeof(g_cores) / sizeof(g_cores[0]));
     DSoftbusAdapterImpl dSoftbusAdapterImpl;
-    NetPacket packet(MessageId::DSOFTBUS_START_COOPERATE);
+    NetPacketView packet(MessageId::DSOFTBUS_START_COOPERATE, nullptr, 0);
     std::string networkId("softbus");
     ASSERT_NO_FATAL_FAILURE(dSoftbusAdapterImpl.HandlePacket(networkId, packet));
     RemovePermission();
@@ -611,7 +619,134 @@ HWTEST_F(DsoftbusAdapterTest, ShutdownServer_01, TestSize.Level1)
     SetPermission(SYSTEM_CORE, g_cores, sizeof(g_cores) / sizeof(g_cores[0]));
     DSoftbusAdapterImpl dSoftbusAdapterImpl;
     dSoftbusAdapterImpl.socketFd_ = 1;
-    ASSERT_NO_FATAL_FAILURE(dSoftbusAdapterImpl.ShutdownServer());
+    DSoftbusAdapterImpl::ClosedSessions closed;
+    ASSERT_NO_FATAL_FAILURE(dSoftbusAdapterImpl.ShutdownServer(closed));
+    RemovePermission();
+}
+
+/**
+ * @tc.name: TestSocketIndex_01
+ * @tc.desc: Test that received bytes reach observers through the socket index, and that the
+ *           index and observer snapshot follow binding, shutdown and observer removal
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DsoftbusAdapterTest, TestSocketIndex_01, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    SetPermission(SYSTEM_CORE, g_cores, sizeof(g_cores) / sizeof(g_cores[0]));
+    DSoftbusAdapterImpl dSoftbusAdapterImpl;
+    auto observer = std::make_shared<DSoftbusObserver>();
+    dSoftbusAdapterImpl.AddObserver(observer);
+    ASSERT_EQ(dSoftbusAdapterImpl.observerSnapshot_->size(), 1U);
+
+    PeerSocketInfo info;
+    char deviceId[] = "softbus";
+    info.networkId = deviceId;
+    dSoftbusAdapterImpl.OnBind(SOCKET, info);
+    ASSERT_EQ(dSoftbusAdapterImpl.socketIndex_.count(SOCKET), 1U);
+    EXPECT_EQ(dSoftbusAdapterImpl.socketIndex_[SOCKET]->first, std::string(deviceId));
+
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    int32_t data { 0 };
+    packet << data;
+    StreamBuffer buffer;
+    ASSERT_TRUE(packet.MakeData(buffer));
+    dSoftbusAdapterImpl.OnBytes(SOCKET, buffer.Data(), buffer.Size());
+    EXPECT_EQ(observer->nPackets_, 1);
+
+    dSoftbusAdapterImpl.OnShutdown(SOCKET, SHUTDOWN_REASON_UNKNOWN);
+    EXPECT_EQ(dSoftbusAdapterImpl.socketIndex_.count(SOCKET), 0U);
+    dSoftbusAdapterImpl.OnBytes(SOCKET, buffer.Data(), buffer.Size());
+    EXPECT_EQ(observer->nPackets_, 1);
+
+    dSoftbusAdapterImpl.RemoveObserver(observer);
+    EXPECT_TRUE(dSoftbusAdapterImpl.observerSnapshot_->empty());
+    RemovePermission();
+}
+
+/**
+ * @tc.name: TestCloseSession_02
+ * @tc.desc: Test that a packet queued right before the session is closed still goes out
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DsoftbusAdapterTest, TestCloseSession_02, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    SetPermission(SYSTEM_CORE, g_cores, sizeof(g_cores) / sizeof(g_cores[0]));
+    DSoftbusAdapterImpl dSoftbusAdapterImpl;
+    PeerSocketInfo info;
+    char deviceId[] = "softbus";
+    info.networkId = deviceId;
+    dSoftbusAdapterImpl.OnBind(SOCKET, info);
+    auto iter = dSoftbusAdapterImpl.sessions_.find(deviceId);
+    ASSERT_NE(iter, dSoftbusAdapterImpl.sessions_.end());
+
+    std::vector<MessageId> sent;
+    iter->second.sendQueue_ = std::make_shared<DSoftbusSendQueue>(deviceId,
+        [&sent](const void *data, uint32_t dataLen) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(TIME_WAIT_FOR_OP_MS));
+            if (dataLen >= sizeof(PackHead)) {
+                sent.push_back(static_cast<const PackHead *>(data)->idMsg);
+            }
+            return RET_OK;
+        });
+    NetPacket packet(MessageId::DSOFTBUS_STOP_COOPERATE);
+    int32_t data { 0 };
+    packet << data;
+    ASSERT_EQ(dSoftbusAdapterImpl.SendPacket(deviceId, packet), RET_OK);
+    dSoftbusAdapterImpl.CloseSession(deviceId);
+    EXPECT_EQ(dSoftbusAdapterImpl.sessions_.count(deviceId), 0U);
+    std::vector<MessageId> expected { MessageId::DSOFTBUS_STOP_COOPERATE };
+    EXPECT_EQ(sent, expected);
+    RemovePermission();
+}
+
+/**
+ * @tc.name: TestCloseSession_03
+ * @tc.desc: Test that draining the queue of a closing session does not hold up other peers
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DsoftbusAdapterTest, TestCloseSession_03, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    SetPermission(SYSTEM_CORE, g_cores, sizeof(g_cores) / sizeof(g_cores[0]));
+    DSoftbusAdapterImpl dSoftbusAdapterImpl;
+    PeerSocketInfo slowInfo;
+    char slowDeviceId[] = "slow";
+    slowInfo.networkId = slowDeviceId;
+    dSoftbusAdapterImpl.OnBind(SOCKET, slowInfo);
+    PeerSocketInfo info;
+    char deviceId[] = "softbus";
+    info.networkId = deviceId;
+    dSoftbusAdapterImpl.OnBind(SOCKET_OTHER, info);
+    auto iter = dSoftbusAdapterImpl.sessions_.find(slowDeviceId);
+    ASSERT_NE(iter, dSoftbusAdapterImpl.sessions_.end());
+
+    std::atomic<int32_t> nSent { 0 };
+    iter->second.sendQueue_ = std::make_shared<DSoftbusSendQueue>(slowDeviceId,
+        [&nSent](const void *, uint32_t) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(TIME_SLOW_SEND_MS));
+            ++nSent;
+            return RET_OK;
+        });
+    NetPacket packet(MessageId::DSOFTBUS_STOP_COOPERATE);
+    int32_t data { 0 };
+    packet << data;
+    ASSERT_EQ(dSoftbusAdapterImpl.SendPacket(slowDeviceId, packet), RET_OK);
+    std::thread closer([&dSoftbusAdapterImpl, &slowDeviceId] {
+        dSoftbusAdapterImpl.CloseSession(slowDeviceId);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIME_WAIT_FOR_OP_MS));
+    auto startTime = std::chrono::steady_clock::now();
+    int32_t ret = dSoftbusAdapterImpl.SendPacket(deviceId, packet);
+    auto elapsed = std::chrono::steady_clock::now() - startTime;
+    closer.join();
+    EXPECT_EQ(ret, RET_OK);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(TIME_SLOW_SEND_MS - TIME_WAIT_FOR_OP_MS));
+    EXPECT_EQ(nSent.load(), 1);
     RemovePermission();
 }
 } // namespace DeviceStatus
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "dsoftbus_heart_beat.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DSoftbusHeartBeatTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int64_t US_PER_MS { 1000 };
+constexpr int64_t START_TIME { 1000 * US_PER_MS };
+constexpr int64_t RTT_MS { 5 };
+constexpr int64_t LINK_TIMEOUT_MS { 600 };
+const std::string PEER { "peer" };
+const std::string OTHER_PEER { "other_peer" };
+
+struct SentPacket {
+    std::string networkId;
+    MessageId msgId { MessageId::INVALID };
+    std::string payload;
+};
+
+class FakeSender final {
+public:
+    DSoftbusHeartBeat::Sender GetSender()
+    {
+        return [this](const std::string &networkId, NetPacket &packet) {
+            sent_.push_back(SentPacket {
+                .networkId = networkId,
+                .msgId = packet.GetMsgId(),
+                .payload = std::string(packet.GetData(), packet.Size()),
+            });
+            return result_;
+        };
+    }
+
+    std::vector<SentPacket> sent_;
+    int32_t result_ { RET_OK };
+};
+
+void Acknowledge(DSoftbusHeartBeat &heartBeat, const SentPacket &probe, int64_t now)
+{
+    NetPacketView probeView(probe.msgId, probe.payload.data(), probe.payload.size());
+    NetPacket ack(MessageId::DSOFTBUS_HEART_BEAT_ACK);
+    ASSERT_TRUE(DSoftbusHeartBeat::MakeAck(probeView, ack));
+    NetPacketView ackView(ack.GetMsgId(), ack.GetData(), ack.Size());
+    heartBeat.OnAck(probe.networkId, ackView, now);
+}
+} // namespace
+
+class DSoftbusHeartBeatTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void DSoftbusHeartBeatTest::SetUpTestCase() {}
+
+void DSoftbusHeartBeatTest::TearDownTestCase() {}
+
+void DSoftbusHeartBeatTest::SetUp() {}
+
+void DSoftbusHeartBeatTest::TearDown() {}
+
+/**
+ * @tc.name: DSoftbusHeartBeatTest001
+ * @tc.desc: One tick probes every running peer, and only the first start asks for a tick
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusHeartBeatTest, DSoftbusHeartBeatTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeSender sender;
+    DSoftbusHeartBeat heartBeat(sender.GetSender());
+    EXPECT_TRUE(heartBeat.Start(PEER));
+    EXPECT_FALSE(heartBeat.Start(OTHER_PEER));
+    EXPECT_EQ(heartBeat.Tick(START_TIME), DEFAULT_HEART_BEAT_INTERVAL_MS);
+    ASSERT_EQ(sender.sent_.size(), 2U);
+    EXPECT_EQ(sender.sent_[0].msgId, MessageId::DSOFTBUS_HEART_BEAT_PACKET);
+
+    EXPECT_EQ(heartBeat.Tick(START_TIME + 10 * US_PER_MS), DEFAULT_HEART_BEAT_INTERVAL_MS - 10);
+    EXPECT_EQ(sender.sent_.size(), 2U);
+    heartBeat.Stop(OTHER_PEER);
+    EXPECT_FALSE(heartBeat.IsRunning(OTHER_PEER));
+    EXPECT_EQ(heartBeat.Tick(START_TIME + DEFAULT_HEART_BEAT_INTERVAL_MS * US_PER_MS),
+        DEFAULT_HEART_BEAT_INTERVAL_MS);
+    ASSERT_EQ(sender.sent_.size(), 3U);
+    EXPECT_EQ(sender.sent_[2].networkId, PEER);
+}
+
+/**
+ * @tc.name: DSoftbusHeartBeatTest002
+ * @tc.desc: A peer that was sent application traffic within the interval is not probed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusHeartBeatTest, DSoftbusHeartBeatTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeSender sender;
+    DSoftbusHeartBeat heartBeat(sender.GetSender());
+    auto traffic = heartBeat.GetTraffic(PEER);
+    heartBeat.Start(PEER);
+    heartBeat.Tick(START_TIME);
+    ASSERT_EQ(sender.sent_.size(), 1U);
+
+    int64_t lastSendTime = START_TIME + 60 * US_PER_MS;
+    traffic->lastSendTime = lastSendTime;
+    EXPECT_EQ(heartBeat.Tick(START_TIME + DEFAULT_HEART_BEAT_INTERVAL_MS * US_PER_MS), 60);
+    EXPECT_EQ(sender.sent_.size(), 1U);
+    heartBeat.Tick(lastSendTime + DEFAULT_HEART_BEAT_INTERVAL_MS * US_PER_MS);
+    EXPECT_EQ(sender.sent_.size(), 2U);
+}
+
+/**
+ * @tc.name: DSoftbusHeartBeatTest003
+ * @tc.desc: Echoed probes give an RTT estimate and widen the interval, lost ones narrow it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusHeartBeatTest, DSoftbusHeartBeatTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeSender sender;
+    DSoftbusHeartBeat heartBeat(sender.GetSender());
+    heartBeat.Start(PEER);
+    heartBeat.Tick(START_TIME);
+    ASSERT_EQ(sender.sent_.size(), 1U);
+    Acknowledge(heartBeat, sender.sent_[0], START_TIME + RTT_MS * US_PER_MS);
+
+    DSoftbusLinkState state;
+    ASSERT_EQ(heartBeat.GetLinkState(PEER, START_TIME + RTT_MS * US_PER_MS, state), RET_OK);
+    EXPECT_EQ(state.rttMs, RTT_MS);
+    EXPECT_GT(state.heartBeatIntervalMs, DEFAULT_HEART_BEAT_INTERVAL_MS);
+    int32_t widened = state.heartBeatIntervalMs;
+
+    int64_t now = START_TIME + DEFAULT_HEART_BEAT_INTERVAL_MS * US_PER_MS;
+    heartBeat.Tick(now);
+    ASSERT_EQ(sender.sent_.size(), 2U);
+    now += MAX_HEART_BEAT_INTERVAL_MS * US_PER_MS;
+    heartBeat.Tick(now);
+    now += MAX_HEART_BEAT_INTERVAL_MS * US_PER_MS;
+    heartBeat.Tick(now);
+    ASSERT_EQ(heartBeat.GetLinkState(PEER, now, state), RET_OK);
+    EXPECT_GE(state.nLostHeartBeats, 1U);
+    EXPECT_LT(state.heartBeatIntervalMs, widened);
+    EXPECT_GE(state.heartBeatIntervalMs, MIN_HEART_BEAT_INTERVAL_MS);
+}
+
+/**
+ * @tc.name: DSoftbusHeartBeatTest004
+ * @tc.desc: A peer is alive while it is heard from, and heart beats of older peers are not echoed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusHeartBeatTest, DSoftbusHeartBeatTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeSender sender;
+    DSoftbusHeartBeat heartBeat(sender.GetSender());
+    DSoftbusLinkState state;
+    EXPECT_NE(heartBeat.GetLinkState(PEER, START_TIME, state), RET_OK);
+
+    heartBeat.GetTraffic(PEER)->lastReceiveTime = START_TIME;
+    ASSERT_EQ(heartBeat.GetLinkState(PEER, START_TIME + US_PER_MS, state), RET_OK);
+    EXPECT_TRUE(state.alive);
+    EXPECT_EQ(state.rttMs, -1);
+    ASSERT_EQ(heartBeat.GetLinkState(PEER, START_TIME + LINK_TIMEOUT_MS * US_PER_MS, state), RET_OK);
+    EXPECT_FALSE(state.alive);
+
+    char legacy[28] { 'a' };
+    NetPacketView legacyView(MessageId::DSOFTBUS_HEART_BEAT_PACKET, legacy, sizeof(legacy));
+    NetPacket ack(MessageId::DSOFTBUS_HEART_BEAT_ACK);
+    EXPECT_FALSE(DSoftbusHeartBeat::MakeAck(legacyView, ack));
+}
+
+/**
+ * @tc.name: DSoftbusHeartBeatTest005
+ * @tc.desc: A peer that cannot be sent to is stopped, and ticking ends with the last peer
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusHeartBeatTest, DSoftbusHeartBeatTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeSender sender;
+    DSoftbusHeartBeat heartBeat(sender.GetSender());
+    EXPECT_TRUE(heartBeat.Start(PEER));
+    sender.result_ = RET_ERR;
+    heartBeat.Tick(START_TIME);
+    EXPECT_FALSE(heartBeat.IsRunning(PEER));
+    EXPECT_EQ(heartBeat.Tick(START_TIME + DEFAULT_HEART_BEAT_INTERVAL_MS * US_PER_MS), -1);
+    EXPECT_TRUE(heartBeat.Start(PEER));
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
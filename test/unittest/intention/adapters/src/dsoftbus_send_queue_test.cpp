@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "dsoftbus_send_queue.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DSoftbusSendQueueTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t TIME_WAIT_FOR_SEND_MS { 1000 };
+constexpr int32_t TIME_WAIT_FOR_OP_MS { 20 };
+constexpr size_t QUEUE_CAPACITY { 3 };
+const std::string PEER_NAME { "peer" };
+
+// Stands in for the softbus link: records the message id of every frame and,
+// while closed, holds the worker inside the send call.
+class FakeLink final {
+public:
+    DSoftbusSendQueue::Sender GetSender()
+    {
+        return [this](const void *data, uint32_t dataLen) {
+            return this->Send(data, dataLen);
+        };
+    }
+
+    void Close()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        open_ = false;
+    }
+
+    void Open()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+
+    void SetResult(int32_t result)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        result_ = result;
+    }
+
+    bool WaitForFrames(size_t nFrames)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::milliseconds(TIME_WAIT_FOR_SEND_MS),
+            [this, nFrames] { return (nCalls_ >= nFrames); });
+    }
+
+    std::vector<MessageId> GetSent()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return sent_;
+    }
+
+private:
+    int32_t Send(const void *data, uint32_t dataLen)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++nCalls_;
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return open_; });
+        if (dataLen >= sizeof(PackHead)) {
+            sent_.push_back(static_cast<const PackHead *>(data)->idMsg);
+        }
+        return result_;
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool open_ { true };
+    int32_t result_ { RET_OK };
+    size_t nCalls_ { 0 };
+    std::vector<MessageId> sent_;
+};
+
+int32_t PushPacket(DSoftbusSendQueue &queue, MessageId msgId)
+{
+    NetPacket packet(msgId);
+    int32_t value { 0 };
+    packet << value;
+    return queue.Push(packet);
+}
+
+SendQueueMetrics WaitForCompletion(DSoftbusSendQueue &queue, uint64_t nFrames)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(TIME_WAIT_FOR_SEND_MS);
+    SendQueueMetrics metrics = queue.GetMetrics();
+    while (((metrics.nSent + metrics.nFailed) < nFrames) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::yield();
+        metrics = queue.GetMetrics();
+    }
+    return metrics;
+}
+} // namespace
+
+class DSoftbusSendQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void DSoftbusSendQueueTest::SetUpTestCase() {}
+
+void DSoftbusSendQueueTest::TearDownTestCase() {}
+
+void DSoftbusSendQueueTest::SetUp() {}
+
+void DSoftbusSendQueueTest::TearDown() {}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest001
+ * @tc.desc: Input events are classified above heart beats, and heart beats above other packets
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EXPECT_EQ(DSoftbusSendQueue::GetPriority(MessageId::DSOFTBUS_INPUT_POINTER_EVENT), SendPriority::INPUT_EVENT);
+    EXPECT_EQ(DSoftbusSendQueue::GetPriority(MessageId::DSOFTBUS_INPUT_KEY_EVENT), SendPriority::INPUT_EVENT);
+    EXPECT_EQ(DSoftbusSendQueue::GetPriority(MessageId::DSOFTBUS_INPUT_EVENT_BATCH), SendPriority::INPUT_EVENT);
+    EXPECT_EQ(DSoftbusSendQueue::GetPriority(MessageId::DSOFTBUS_HEART_BEAT_PACKET), SendPriority::HEART_BEAT);
+    EXPECT_EQ(DSoftbusSendQueue::GetPriority(MessageId::DSOFTBUS_START_COOPERATE), SendPriority::BULK);
+}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest002
+ * @tc.desc: Frames queued behind a slow send go out by priority, in order within a priority
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeLink link;
+    DSoftbusSendQueue queue(PEER_NAME, link.GetSender());
+    link.Close();
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_START_COOPERATE), RET_OK);
+    ASSERT_TRUE(link.WaitForFrames(1));
+
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_STOP_COOPERATE), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_HEART_BEAT_PACKET), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_KEY_EVENT), RET_OK);
+    EXPECT_EQ(queue.GetMetrics().depth, 4U);
+    link.Open();
+    ASSERT_TRUE(link.WaitForFrames(5));
+    queue.Stop();
+
+    std::vector<MessageId> expected {
+        MessageId::DSOFTBUS_START_COOPERATE,
+        MessageId::DSOFTBUS_INPUT_POINTER_EVENT,
+        MessageId::DSOFTBUS_INPUT_KEY_EVENT,
+        MessageId::DSOFTBUS_HEART_BEAT_PACKET,
+        MessageId::DSOFTBUS_STOP_COOPERATE,
+    };
+    EXPECT_EQ(link.GetSent(), expected);
+}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest003
+ * @tc.desc: A full queue evicts its oldest least important frame, but never one more important than the new frame
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeLink link;
+    DSoftbusSendQueue queue(PEER_NAME, link.GetSender(),
+        SendQueueOptions { .capacity = QUEUE_CAPACITY, .dropPolicy = SendDropPolicy::DROP_OLDEST });
+    link.Close();
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_START_COOPERATE), RET_OK);
+    ASSERT_TRUE(link.WaitForFrames(1));
+
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_STOP_COOPERATE), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_KEY_EVENT), RET_OK);
+    EXPECT_EQ(PushPacket(queue, MessageId::DSOFTBUS_HEART_BEAT_PACKET), RET_OK);
+    EXPECT_NE(PushPacket(queue, MessageId::DSOFTBUS_COME_BACK), RET_OK);
+    EXPECT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT), RET_OK);
+
+    SendQueueMetrics metrics = queue.GetMetrics();
+    EXPECT_EQ(metrics.depth, QUEUE_CAPACITY);
+    EXPECT_EQ(metrics.peakDepth, QUEUE_CAPACITY);
+    EXPECT_EQ(metrics.nDropped, 3U);
+    link.Open();
+    ASSERT_TRUE(link.WaitForFrames(4));
+    queue.Stop();
+
+    std::vector<MessageId> expected {
+        MessageId::DSOFTBUS_START_COOPERATE,
+        MessageId::DSOFTBUS_INPUT_POINTER_EVENT,
+        MessageId::DSOFTBUS_INPUT_KEY_EVENT,
+        MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT,
+    };
+    EXPECT_EQ(link.GetSent(), expected);
+}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest004
+ * @tc.desc: With DROP_NEWEST a full queue keeps what it holds and rejects the new frame
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeLink link;
+    DSoftbusSendQueue queue(PEER_NAME, link.GetSender(),
+        SendQueueOptions { .capacity = QUEUE_CAPACITY, .dropPolicy = SendDropPolicy::DROP_NEWEST });
+    link.Close();
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_START_COOPERATE), RET_OK);
+    ASSERT_TRUE(link.WaitForFrames(1));
+
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_STOP_COOPERATE), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_HEART_BEAT_PACKET), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_COME_BACK), RET_OK);
+    EXPECT_NE(PushPacket(queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    EXPECT_EQ(queue.GetMetrics().nDropped, 1U);
+    link.Open();
+    ASSERT_TRUE(link.WaitForFrames(4));
+    queue.Stop();
+
+    std::vector<MessageId> expected {
+        MessageId::DSOFTBUS_START_COOPERATE,
+        MessageId::DSOFTBUS_HEART_BEAT_PACKET,
+        MessageId::DSOFTBUS_STOP_COOPERATE,
+        MessageId::DSOFTBUS_COME_BACK,
+    };
+    EXPECT_EQ(link.GetSent(), expected);
+}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest005
+ * @tc.desc: Sent and failed frames are counted, and a stopped queue accepts nothing
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeLink link;
+    auto queue = std::make_unique<DSoftbusSendQueue>(PEER_NAME, link.GetSender());
+    ASSERT_EQ(PushPacket(*queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    SendQueueMetrics metrics = WaitForCompletion(*queue, 1);
+    EXPECT_EQ(metrics.nSent, 1U);
+    link.SetResult(RET_ERR);
+    ASSERT_EQ(PushPacket(*queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    metrics = WaitForCompletion(*queue, 2);
+    queue->Stop();
+
+    EXPECT_EQ(metrics.nQueued, 2U);
+    EXPECT_EQ(metrics.nSent, 1U);
+    EXPECT_EQ(metrics.nFailed, 1U);
+    EXPECT_EQ(metrics.depth, 0U);
+    EXPECT_GE(metrics.maxLatencyUs, metrics.avgLatencyUs);
+    EXPECT_NE(PushPacket(*queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    ASSERT_NO_FATAL_FAILURE(queue.reset());
+}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest006
+ * @tc.desc: Draining hands every queued frame over before stopping, but gives up at the deadline
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest006, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeLink link;
+    auto queue = std::make_unique<DSoftbusSendQueue>(PEER_NAME, link.GetSender());
+    ASSERT_EQ(PushPacket(*queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    ASSERT_EQ(PushPacket(*queue, MessageId::DSOFTBUS_STOP_COOPERATE), RET_OK);
+    EXPECT_TRUE(queue->Drain(std::chrono::milliseconds(TIME_WAIT_FOR_SEND_MS)));
+    EXPECT_EQ(queue->GetMetrics().nSent, 2U);
+    EXPECT_NE(PushPacket(*queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+
+    link.Close();
+    queue = std::make_unique<DSoftbusSendQueue>(PEER_NAME, link.GetSender());
+    ASSERT_EQ(PushPacket(*queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT), RET_OK);
+    ASSERT_TRUE(link.WaitForFrames(3));
+    ASSERT_EQ(PushPacket(*queue, MessageId::DSOFTBUS_STOP_COOPERATE), RET_OK);
+    EXPECT_FALSE(queue->Drain(std::chrono::milliseconds(TIME_WAIT_FOR_OP_MS)));
+    link.Open();
+    ASSERT_NO_FATAL_FAILURE(queue.reset());
+    std::vector<MessageId> expected {
+        MessageId::DSOFTBUS_INPUT_POINTER_EVENT,
+        MessageId::DSOFTBUS_STOP_COOPERATE,
+        MessageId::DSOFTBUS_INPUT_POINTER_EVENT,
+    };
+    EXPECT_EQ(link.GetSent(), expected);
+}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest007
+ * @tc.desc: DROP_OLDEST never evicts input frames, a new frame that finds only input frames is rejected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest007, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeLink link;
+    DSoftbusSendQueue queue(PEER_NAME, link.GetSender(),
+        SendQueueOptions { .capacity = QUEUE_CAPACITY, .dropPolicy = SendDropPolicy::DROP_OLDEST });
+    link.Close();
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_START_COOPERATE), RET_OK);
+    ASSERT_TRUE(link.WaitForFrames(1));
+
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_KEY_EVENT), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT), RET_OK);
+    ASSERT_EQ(PushPacket(queue, MessageId::DSOFTBUS_INPUT_EVENT_BATCH), RET_OK);
+    EXPECT_NE(PushPacket(queue, MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT), RET_OK);
+    EXPECT_NE(PushPacket(queue, MessageId::DSOFTBUS_HEART_BEAT_PACKET), RET_OK);
+    EXPECT_EQ(queue.GetMetrics().nDropped, 2U);
+    link.Open();
+    ASSERT_TRUE(link.WaitForFrames(4));
+    queue.Stop();
+
+    std::vector<MessageId> expected {
+        MessageId::DSOFTBUS_START_COOPERATE,
+        MessageId::DSOFTBUS_INPUT_KEY_EVENT,
+        MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT,
+        MessageId::DSOFTBUS_INPUT_EVENT_BATCH,
+    };
+    EXPECT_EQ(link.GetSent(), expected);
+}
+
+/**
+ * @tc.name: DSoftbusSendQueueTest008
+ * @tc.desc: Packets above the legacy size limit are rejected until the peer is known to take them
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DSoftbusSendQueueTest, DSoftbusSendQueueTest008, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeLink link;
+    DSoftbusSendQueue queue(PEER_NAME, link.GetSender());
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    std::vector<char> payload(MAX_PACKET_BUF_SIZE);
+    ASSERT_TRUE(packet.Write(payload.data(), payload.size()));
+    EXPECT_NE(queue.Push(packet), RET_OK);
+
+    queue.SetMaxPacketSize(MAX_STREAM_BUF_CAPACITY);
+    ASSERT_EQ(queue.Push(packet), RET_OK);
+    SendQueueMetrics metrics = WaitForCompletion(queue, 1);
+    queue.Stop();
+    EXPECT_EQ(metrics.nQueued, 1U);
+    EXPECT_EQ(metrics.nSent, 1U);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -17,7 +17,9 @@
 #define EPOLL_MANAGER_TEST_H
 #define private public
 
+#include <atomic>
 #include <fcntl.h>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -46,6 +48,38 @@ inline int32_t MonitorEvent::GetFd() const
     return inotifyFd_;
 }
 
+class PipeEvent final : public IEpollEventSource {
+public:
+    explicit PipeEvent(uint32_t events = (EPOLLIN | EPOLLHUP | EPOLLERR), int32_t delayMs = 0);
+    DISALLOW_COPY_AND_MOVE(PipeEvent);
+    ~PipeEvent();
+
+    uint32_t GetEvents() const override;
+    int32_t GetFd() const override;
+    void Dispatch(const struct epoll_event &ev) override;
+    void Notify();
+    void CloseWriteEnd();
+
+public:
+    int32_t fds_[2] { -1, -1 };
+    uint32_t events_ { 0 };
+    int32_t delayMs_ { 0 };
+    std::atomic<int32_t> nDispatched_ { 0 };
+    std::atomic<int32_t> nHangups_ { 0 };
+    std::atomic<bool> onWorker_ { false };
+    std::thread::id mainThread_ { std::this_thread::get_id() };
+};
+
+inline uint32_t PipeEvent::GetEvents() const
+{
+    return events_;
+}
+
+inline int32_t PipeEvent::GetFd() const
+{
+    return fds_[0];
+}
+
 class EpollManagerTest : public testing::Test {
 public:
     static void SetUpTestCase();
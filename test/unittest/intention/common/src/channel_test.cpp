@@ -16,10 +16,14 @@
 #define private public
 #define protected public
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "channel.h"
 #include "fi_log.h"
+#include "ring_channel.h"
 
 #undef LOG_TAG
 #define LOG_TAG "ChannelTest"
@@ -29,6 +33,12 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace {
 constexpr size_t DEFAULT_WAIT_TIME { 10 };
+constexpr size_t COALESCIBLE_EVENT { 100 };
+
+bool CoalesceLargeEvents(const size_t &queued, const size_t &incoming)
+{
+    return ((queued >= COALESCIBLE_EVENT) && (incoming >= COALESCIBLE_EVENT));
+}
 }
 using namespace testing::ext;
 
@@ -128,6 +138,213 @@ HWTEST_F(ChannelTest, ChannelTest004, TestSize.Level0)
     };
     EXPECT_EQ(sender.Send(data), Channel<size_t>::QUEUE_IS_FULL);
 }
+
+/**
+ * @tc.name: RingChannelTest001
+ * @tc.desc: Events from multiple senders are all received, in order per sender.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelTest, RingChannelTest001, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    constexpr size_t nSenders = 4;
+    constexpr size_t count = 1024;
+    constexpr size_t shift = 32;
+    auto [sender, receiver] = RingChannel<size_t>::OpenChannel(nSenders * count);
+    receiver.Enable();
+
+    std::vector<std::thread> workers;
+    for (size_t id = 0; id < nSenders; ++id) {
+        workers.emplace_back([sender = sender, id, count, shift]() mutable {
+            for (size_t index = 0; index < count; ++index) {
+                EXPECT_EQ(sender.Send((id << shift) | index), RingChannel<size_t>::NO_ERROR);
+            }
+        });
+    }
+    std::vector<size_t> expected(nSenders, 0);
+    for (size_t received = 0; received < nSenders * count; ++received) {
+        size_t data = receiver.Receive();
+        size_t id = (data >> shift);
+        ASSERT_LT(id, nSenders);
+        EXPECT_EQ(data & ((size_t(1) << shift) - 1), expected[id]++);
+    }
+    for (auto &worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @tc.name: RingChannelTest002
+ * @tc.desc: Receiver blocks until an event arrives from a slow sender.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelTest, RingChannelTest002, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = RingChannel<size_t>::OpenChannel();
+    constexpr size_t count = 64;
+    receiver.Enable();
+
+    std::thread worker([sender = sender, count]() mutable {
+        for (size_t index = 0; index < count;) {
+            EXPECT_EQ(sender.Send(index), RingChannel<size_t>::NO_ERROR);
+            if ((++index % 10) == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_WAIT_TIME));
+            }
+        }
+    });
+    for (size_t expected = 0; expected < count; ++expected) {
+        ASSERT_EQ(receiver.Peek(), expected);
+        ASSERT_EQ(receiver.Receive(), expected);
+    }
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+/**
+ * @tc.name: RingChannelTest003
+ * @tc.desc: Capacity is configurable and sending fails when the ring is full or inactive.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelTest, RingChannelTest003, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    constexpr size_t capacity = 16;
+    auto [sender, receiver] = RingChannel<size_t>::OpenChannel(capacity);
+    size_t data = 1;
+    EXPECT_EQ(sender.Send(data), RingChannel<size_t>::INACTIVE_CHANNEL);
+    receiver.Enable();
+
+    for (size_t index = 0; index < capacity; ++index) {
+        EXPECT_EQ(sender.Send(data++), RingChannel<size_t>::NO_ERROR);
+    }
+    EXPECT_EQ(sender.Send(data), RingChannel<size_t>::QUEUE_IS_FULL);
+    receiver.Pop();
+    EXPECT_EQ(sender.Send(data), RingChannel<size_t>::NO_ERROR);
+    receiver.Disable();
+    EXPECT_EQ(sender.Send(data), RingChannel<size_t>::INACTIVE_CHANNEL);
+    receiver.Enable();
+    EXPECT_EQ(sender.Send(data), RingChannel<size_t>::NO_ERROR);
+    EXPECT_EQ(receiver.Receive(), data);
+}
+/**
+ * @tc.name: ChannelTest005
+ * @tc.desc: TryReceive returns immediately and ReceiveBatch drains pending events in order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelTest, ChannelTest005, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = Channel<size_t>::OpenChannel();
+    constexpr size_t count = 10;
+    constexpr size_t maxCount = 4;
+    receiver.Enable();
+
+    size_t data = 0;
+    EXPECT_FALSE(receiver.TryReceive(data));
+    for (size_t index = 0; index < count; ++index) {
+        EXPECT_EQ(sender.Send(index), Channel<size_t>::NO_ERROR);
+    }
+    EXPECT_TRUE(receiver.TryReceive(data));
+    EXPECT_EQ(data, 0);
+
+    std::vector<size_t> events;
+    EXPECT_EQ(receiver.ReceiveBatch(events, maxCount), maxCount);
+    EXPECT_EQ(receiver.ReceiveBatch(events, count), count - maxCount - 1);
+    ASSERT_EQ(events.size(), count - 1);
+    for (size_t index = 0; index < events.size(); ++index) {
+        EXPECT_EQ(events[index], index + 1);
+    }
+    EXPECT_EQ(receiver.ReceiveBatch(events, count, std::chrono::milliseconds(DEFAULT_WAIT_TIME)), 0);
+}
+
+/**
+ * @tc.name: RingChannelTest004
+ * @tc.desc: TryReceive returns immediately and ReceiveBatch drains pending events in order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelTest, RingChannelTest004, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = RingChannel<size_t>::OpenChannel();
+    constexpr size_t count = 10;
+    constexpr size_t maxCount = 4;
+    receiver.Enable();
+
+    size_t data = 0;
+    EXPECT_FALSE(receiver.TryReceive(data));
+    for (size_t index = 0; index < count; ++index) {
+        EXPECT_EQ(sender.Send(index), RingChannel<size_t>::NO_ERROR);
+    }
+    EXPECT_TRUE(receiver.TryReceive(data));
+    EXPECT_EQ(data, 0);
+
+    std::vector<size_t> events;
+    EXPECT_EQ(receiver.ReceiveBatch(events, maxCount), maxCount);
+    EXPECT_EQ(receiver.ReceiveBatch(events, count), count - maxCount - 1);
+    ASSERT_EQ(events.size(), count - 1);
+    for (size_t index = 0; index < events.size(); ++index) {
+        EXPECT_EQ(events[index], index + 1);
+    }
+    EXPECT_EQ(receiver.ReceiveBatch(events, count, std::chrono::milliseconds(DEFAULT_WAIT_TIME)), 0);
+}
+
+/**
+ * @tc.name: ChannelTest006
+ * @tc.desc: Events keep their order while the ring wraps around and grows.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelTest, ChannelTest006, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = Channel<size_t>::OpenChannel();
+    constexpr size_t nRounds = 48;
+    receiver.Enable();
+
+    size_t nextSent = 0;
+    size_t nextReceived = 0;
+    for (size_t round = 1; round <= nRounds; ++round) {
+        for (size_t index = 0; index < round; ++index) {
+            EXPECT_EQ(sender.Send(nextSent++), Channel<size_t>::NO_ERROR);
+        }
+        for (size_t index = 0; index < round / 2; ++index, ++nextReceived) {
+            EXPECT_EQ(receiver.Receive(), nextReceived);
+        }
+    }
+    size_t data = 0;
+    for (; receiver.TryReceive(data); ++nextReceived) {
+        EXPECT_EQ(data, nextReceived);
+    }
+    EXPECT_EQ(nextReceived, nextSent);
+}
+
+/**
+ * @tc.name: ChannelTest007
+ * @tc.desc: Coalescible events still queued collapse into the latest one without reordering others.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelTest, ChannelTest007, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = Channel<size_t>::OpenChannel(&CoalesceLargeEvents);
+    receiver.Enable();
+
+    std::vector<size_t> sent { 1, 100, 101, 102, 2, 103, 104, 3 };
+    for (auto event : sent) {
+        EXPECT_EQ(sender.Send(event), Channel<size_t>::NO_ERROR);
+    }
+    std::vector<size_t> events;
+    EXPECT_EQ(receiver.ReceiveBatch(events, sent.size()), 5);
+    EXPECT_EQ(events, std::vector<size_t>({ 1, 102, 2, 104, 3 }));
+
+    EXPECT_EQ(sender.Send(105), Channel<size_t>::NO_ERROR);
+    EXPECT_EQ(receiver.Receive(), 105);
+    EXPECT_EQ(sender.Send(106), Channel<size_t>::NO_ERROR);
+    EXPECT_EQ(receiver.Receive(), 106);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
@@ -37,6 +37,11 @@ constexpr int32_t UNBLOCK_EPOLL { 0 };
 constexpr int32_t TIME_WAIT_FOR_OP_MS { 1001 };
 constexpr int32_t DISPATCH_TIMES { 5 };
 constexpr int32_t EXPIRE_TIME { 2 };
+constexpr int32_t PIPE_BUF_SIZE { 64 };
+constexpr int32_t MAX_N_POLLS { 200 };
+constexpr int32_t POLL_INTERVAL_MS { 5 };
+constexpr int32_t SLOW_DISPATCH_MS { 300 };
+constexpr size_t N_LOOPS { 2 };
 } // namespace
 
 void EpollManagerTest::SetUpTestCase() {}
@@ -99,6 +104,68 @@ int32_t MonitorEvent::SetTimer()
     return RET_OK;
 }
 
+PipeEvent::PipeEvent(uint32_t events, int32_t delayMs)
+    : events_(events), delayMs_(delayMs)
+{
+    if (pipe2(fds_, O_CLOEXEC | O_NONBLOCK) != 0) {
+        FI_HILOGE("pipe2 failed");
+    }
+}
+
+PipeEvent::~PipeEvent()
+{
+    for (auto &fd : fds_) {
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+}
+
+void PipeEvent::Dispatch(const struct epoll_event &ev)
+{
+    onWorker_ = (std::this_thread::get_id() != mainThread_);
+    if ((ev.events & EPOLLIN) == EPOLLIN) {
+        char buf[PIPE_BUF_SIZE] {};
+        while (read(fds_[0], buf, sizeof(buf)) > 0) {}
+        if (delayMs_ > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delayMs_));
+        }
+        ++nDispatched_;
+    }
+    if ((ev.events & EPOLLHUP) == EPOLLHUP) {
+        ++nHangups_;
+    }
+}
+
+void PipeEvent::Notify()
+{
+    char c { 'x' };
+    if (write(fds_[1], &c, sizeof(c)) != sizeof(c)) {
+        FI_HILOGE("write failed");
+    }
+}
+
+void PipeEvent::CloseWriteEnd()
+{
+    if (fds_[1] >= 0) {
+        close(fds_[1]);
+        fds_[1] = -1;
+    }
+}
+
+template<typename Predicate>
+bool WaitFor(Predicate pred)
+{
+    for (int32_t i = 0; i < MAX_N_POLLS; ++i) {
+        if (pred()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+    }
+    return pred();
+}
+
 void EpollManagerTest::SetUp() {}
 
 void EpollManagerTest::TearDown() {}
@@ -466,6 +533,131 @@ HWTEST_F(EpollManagerTest, EpollManagerTest_Dispatch003, TestSize.Level1)
         epollMgr.Dispatch(ev);
     }
 }
+
+/**
+ * @tc.name: EpollManagerTest_StartWorkers001
+ * @tc.desc: Test StartWorkers, sources are dispatched on the worker loop chosen by the policy
+ * @tc.type: FUNC
+ */
+HWTEST_F(EpollManagerTest, EpollManagerTest_StartWorkers001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EpollManager epollMgr;
+    ASSERT_TRUE(epollMgr.Open());
+    auto early = std::make_shared<PipeEvent>();
+    ASSERT_TRUE(epollMgr.Add(early));
+
+    auto pinned = early.get();
+    ASSERT_TRUE(epollMgr.StartWorkers(N_LOOPS, [pinned](const IEpollEventSource &source, size_t nLoops) {
+        return (&source == pinned ? 0 : nLoops - 1);
+    }));
+    EXPECT_EQ(epollMgr.GetLoopCount(), N_LOOPS);
+    auto late = std::make_shared<PipeEvent>();
+    ASSERT_TRUE(epollMgr.Add(late));
+
+    EpollManager::LoopMetrics metrics;
+    ASSERT_TRUE(epollMgr.GetLoopMetrics(0, metrics));
+    EXPECT_EQ(metrics.nSources, 1);
+    ASSERT_TRUE(epollMgr.GetLoopMetrics(N_LOOPS - 1, metrics));
+    EXPECT_EQ(metrics.nSources, 1);
+    EXPECT_FALSE(epollMgr.GetLoopMetrics(N_LOOPS, metrics));
+
+    early->Notify();
+    late->Notify();
+    EXPECT_TRUE(WaitFor([&] { return (early->nDispatched_ > 0) && (late->nDispatched_ > 0); }));
+    EXPECT_TRUE(early->onWorker_);
+    EXPECT_TRUE(late->onWorker_);
+    ASSERT_TRUE(epollMgr.GetLoopMetrics(0, metrics));
+    EXPECT_GE(metrics.nDispatched, 1);
+    EXPECT_GE(metrics.nWakeups, 1);
+
+    epollMgr.Remove(late);
+    ASSERT_TRUE(epollMgr.GetLoopMetrics(N_LOOPS - 1, metrics));
+    EXPECT_EQ(metrics.nSources, 0);
+    epollMgr.Close();
+}
+
+/**
+ * @tc.name: EpollManagerTest_StartWorkers002
+ * @tc.desc: Test StartWorkers, a slow source does not delay sources pinned to other loops
+ * @tc.type: FUNC
+ */
+HWTEST_F(EpollManagerTest, EpollManagerTest_StartWorkers002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EpollManager epollMgr;
+    ASSERT_TRUE(epollMgr.Open());
+    ASSERT_TRUE(epollMgr.StartWorkers(N_LOOPS));
+
+    auto slow = std::make_shared<PipeEvent>(EPOLLIN | EPOLLHUP | EPOLLERR, SLOW_DISPATCH_MS);
+    auto fast = std::make_shared<PipeEvent>();
+    ASSERT_TRUE(epollMgr.AddToLoop(slow, 0));
+    ASSERT_TRUE(epollMgr.AddToLoop(fast, 1));
+    EXPECT_FALSE(epollMgr.AddToLoop(std::make_shared<PipeEvent>(), N_LOOPS));
+
+    slow->Notify();
+    std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+    fast->Notify();
+    EXPECT_TRUE(WaitFor([&] { return (fast->nDispatched_ > 0); }));
+    EXPECT_EQ(slow->nDispatched_, 0);
+
+    EXPECT_TRUE(WaitFor([&] { return (slow->nDispatched_ > 0); }));
+    EpollManager::LoopMetrics metrics;
+    ASSERT_TRUE(epollMgr.GetLoopMetrics(0, metrics));
+    EXPECT_GE(metrics.maxLatencyUs, static_cast<uint64_t>(SLOW_DISPATCH_MS) * 1000);
+    ASSERT_TRUE(epollMgr.GetLoopMetrics(1, metrics));
+    EXPECT_LT(metrics.maxLatencyUs, static_cast<uint64_t>(SLOW_DISPATCH_MS) * 1000);
+}
+
+/**
+ * @tc.name: EpollManagerTest_StopWorkers001
+ * @tc.desc: Test StopWorkers, sources are moved back to the shared epoll fd
+ * @tc.type: FUNC
+ */
+HWTEST_F(EpollManagerTest, EpollManagerTest_StopWorkers001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EpollManager epollMgr;
+    ASSERT_TRUE(epollMgr.Open());
+    ASSERT_TRUE(epollMgr.StartWorkers(N_LOOPS));
+    auto source = std::make_shared<PipeEvent>();
+    ASSERT_TRUE(epollMgr.Add(source));
+    epollMgr.StopWorkers();
+    EXPECT_EQ(epollMgr.GetLoopCount(), 0);
+
+    source->Notify();
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    epollMgr.Dispatch(ev);
+    EXPECT_EQ(source->nDispatched_, 1);
+    EXPECT_FALSE(source->onWorker_);
+}
+
+/**
+ * @tc.name: EpollManagerTest_EdgeTriggered001
+ * @tc.desc: Test edge-triggered sources, hangups are delivered to the source
+ * @tc.type: FUNC
+ */
+HWTEST_F(EpollManagerTest, EpollManagerTest_EdgeTriggered001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EpollManager epollMgr;
+    ASSERT_TRUE(epollMgr.Open());
+    epollMgr.SetEdgeTriggered(true);
+    EXPECT_EQ(epollMgr.GetEvents() & EPOLLET, EPOLLET);
+
+    auto source = std::make_shared<PipeEvent>(EPOLLIN | EPOLLHUP | EPOLLERR | EPOLLET);
+    ASSERT_TRUE(epollMgr.Add(source));
+    source->Notify();
+    source->CloseWriteEnd();
+
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    epollMgr.Dispatch(ev);
+    EXPECT_EQ(source->nHangups_, 1);
+    epollMgr.Dispatch(ev);
+    EXPECT_EQ(source->nHangups_, 1);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "input_event_transmission/compact_pointer_event_codec.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CompactPointerEventCodecTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+using namespace Cooperate;
+namespace {
+constexpr uint32_t RANDOM_SEED { 20250101 };
+constexpr int32_t N_FUZZ_EVENTS { 2000 };
+constexpr int32_t N_DEVICES { 3 };
+constexpr int32_t N_MOVES { 10 };
+constexpr int32_t MAX_STEP { 40 };
+constexpr uint32_t N_AXES { 7 };
+constexpr int64_t MOVE_INTERVAL { 8000 };
+
+bool IsSameItem(const InnerPointerItem &lhs, const InnerPointerItem &rhs)
+{
+    return ((lhs.pointerId == rhs.pointerId) && (lhs.pressed == rhs.pressed) && (lhs.displayX == rhs.displayX) &&
+        (lhs.displayY == rhs.displayY) && (lhs.windowX == rhs.windowX) && (lhs.windowY == rhs.windowY) &&
+        (lhs.displayXPos == rhs.displayXPos) && (lhs.displayYPos == rhs.displayYPos) &&
+        (lhs.windowXPos == rhs.windowXPos) && (lhs.windowYPos == rhs.windowYPos) && (lhs.width == rhs.width) &&
+        (lhs.height == rhs.height) && (lhs.tiltX == rhs.tiltX) && (lhs.tiltY == rhs.tiltY) &&
+        (lhs.toolDisplayX == rhs.toolDisplayX) && (lhs.toolDisplayY == rhs.toolDisplayY) &&
+        (lhs.toolWindowX == rhs.toolWindowX) && (lhs.toolWindowY == rhs.toolWindowY) &&
+        (lhs.toolWidth == rhs.toolWidth) && (lhs.toolHeight == rhs.toolHeight) && (lhs.pressure == rhs.pressure) &&
+        (lhs.longAxis == rhs.longAxis) && (lhs.shortAxis == rhs.shortAxis) && (lhs.deviceId == rhs.deviceId) &&
+        (lhs.downTime == rhs.downTime) && (lhs.toolType == rhs.toolType) &&
+        (lhs.targetWindowId == rhs.targetWindowId) && (lhs.originPointerId == rhs.originPointerId) &&
+        (lhs.rawDx == rhs.rawDx) && (lhs.rawDy == rhs.rawDy));
+}
+
+bool IsSameRecord(const PointerEventRecord &lhs, const PointerEventRecord &rhs)
+{
+    if (lhs.pointers.size() != rhs.pointers.size()) {
+        return false;
+    }
+    for (size_t index = 0; index < lhs.pointers.size(); ++index) {
+        if (!IsSameItem(lhs.pointers[index], rhs.pointers[index])) {
+            return false;
+        }
+    }
+    return ((lhs.eventType == rhs.eventType) && (lhs.id == rhs.id) && (lhs.actionTime == rhs.actionTime) &&
+        (lhs.action == rhs.action) && (lhs.actionStartTime == rhs.actionStartTime) &&
+        (lhs.sensorInputTime == rhs.sensorInputTime) && (lhs.deviceId == rhs.deviceId) &&
+        (lhs.targetDisplayId == rhs.targetDisplayId) && (lhs.targetWindowId == rhs.targetWindowId) &&
+        (lhs.agentWindowId == rhs.agentWindowId) && (lhs.flag == rhs.flag) &&
+        (lhs.pointerAction == rhs.pointerAction) && (lhs.pointerId == rhs.pointerId) &&
+        (lhs.sourceType == rhs.sourceType) && (lhs.buttonId == rhs.buttonId) &&
+        (lhs.fingerCount == rhs.fingerCount) && (lhs.zOrder == rhs.zOrder) && (lhs.axes == rhs.axes) &&
+        (lhs.axisValues == rhs.axisValues) && (lhs.pressedButtons == rhs.pressedButtons) &&
+        (lhs.pressedKeys == rhs.pressedKeys) && (lhs.buffer == rhs.buffer) &&
+        (lhs.interceptorTime == rhs.interceptorTime) && (lhs.scrollRows == rhs.scrollRows));
+}
+
+InnerPointerItem MakeItem(int32_t pointerId, int32_t displayX, int32_t displayY)
+{
+    InnerPointerItem item;
+    item.pointerId = pointerId;
+    item.displayX = displayX;
+    item.displayY = displayY;
+    item.displayXPos = displayX;
+    item.displayYPos = displayY;
+    item.deviceId = 1;
+    item.toolType = 0;
+    return item;
+}
+
+PointerEventRecord MakeMouseMove(int32_t deviceId, int64_t actionTime, int32_t displayX, int32_t displayY)
+{
+    PointerEventRecord record;
+    record.eventType = 1;
+    record.id = static_cast<int32_t>(actionTime / MOVE_INTERVAL);
+    record.actionTime = actionTime;
+    record.actionStartTime = actionTime;
+    record.sensorInputTime = static_cast<uint64_t>(actionTime);
+    record.deviceId = deviceId;
+    record.pointerAction = MMI::PointerEvent::POINTER_ACTION_MOVE;
+    record.sourceType = MMI::PointerEvent::SOURCE_TYPE_MOUSE;
+    record.interceptorTime = actionTime;
+    record.pointers.push_back(MakeItem(0, displayX, displayY));
+    return record;
+}
+
+// Mutates a random subset of fields, including extreme values, so that both tiny deltas and
+// wrap-around deltas are exercised.
+void Mutate(std::mt19937 &rng, PointerEventRecord &record)
+{
+    std::uniform_int_distribution<int32_t> choice(0, 15);
+    std::uniform_int_distribution<int32_t> step(-MAX_STEP, MAX_STEP);
+    std::uniform_int_distribution<int32_t> any(INT32_MIN, INT32_MAX);
+    std::uniform_real_distribution<double> real(-1.0e6, 1.0e6);
+    record.id += 1;
+    record.actionTime += step(rng) + MOVE_INTERVAL;
+    record.interceptorTime = record.actionTime + step(rng);
+    switch (choice(rng)) {
+        case 0: {
+            record.actionTime = static_cast<int64_t>((static_cast<uint64_t>(any(rng)) << 32) ^ any(rng));
+            break;
+        }
+        case 1: {
+            record.flag = static_cast<uint32_t>(any(rng));
+            break;
+        }
+        case 2: {
+            uint32_t axis = static_cast<uint32_t>(choice(rng)) % N_AXES;
+            if ((record.axes & (1U << axis)) == 0) {
+                record.axes |= (1U << axis);
+                record.axisValues.push_back(real(rng));
+            } else if (!record.axisValues.empty()) {
+                record.axisValues.back() = real(rng);
+            }
+            break;
+        }
+        case 3: {
+            record.pressedButtons.assign(static_cast<size_t>(choice(rng) % 4), any(rng));
+            break;
+        }
+        case 4: {
+            if (record.pointers.size() < 4) {
+                record.pointers.push_back(MakeItem(static_cast<int32_t>(record.pointers.size()), any(rng), step(rng)));
+            }
+            break;
+        }
+        case 5: {
+            if (record.pointers.size() > 1) {
+                record.pointers.erase(record.pointers.begin());
+            }
+            break;
+        }
+        case 6: {
+            record.pressedKeys.assign(static_cast<size_t>(choice(rng) % 3), step(rng));
+            break;
+        }
+        case 7: {
+            record.buffer.assign(static_cast<size_t>(choice(rng) * 7), static_cast<uint8_t>(any(rng)));
+            break;
+        }
+        case 8: {
+            record.zOrder = static_cast<float>(real(rng));
+            break;
+        }
+        case 9: {
+            record.sensorInputTime = static_cast<uint64_t>(any(rng));
+            break;
+        }
+        default: {
+            record.pointerAction = choice(rng);
+            record.scrollRows = step(rng);
+            break;
+        }
+    }
+    for (auto &item : record.pointers) {
+        item.displayX += step(rng);
+        item.displayY += step(rng);
+        item.displayXPos = item.displayX;
+        item.displayYPos = item.displayY;
+        item.rawDx = step(rng);
+        item.rawDy = step(rng);
+        item.pressed = (choice(rng) == 0 ? !item.pressed : item.pressed);
+        item.pressure = (choice(rng) == 0 ? real(rng) : item.pressure);
+    }
+}
+} // namespace
+
+class CompactPointerEventCodecTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void CompactPointerEventCodecTest::SetUpTestCase() {}
+
+void CompactPointerEventCodecTest::TearDownTestCase() {}
+
+void CompactPointerEventCodecTest::SetUp() {}
+
+void CompactPointerEventCodecTest::TearDown() {}
+
+/**
+ * @tc.name: CompactPointerEventCodecTest001
+ * @tc.desc: Randomized pointer events from several devices round-trip through the compact schema
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CompactPointerEventCodecTest, CompactPointerEventCodecTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::mt19937 rng(RANDOM_SEED);
+    std::uniform_int_distribution<int32_t> device(0, N_DEVICES - 1);
+    std::vector<PointerEventRecord> records;
+    for (int32_t deviceId = 0; deviceId < N_DEVICES; ++deviceId) {
+        records.push_back(MakeMouseMove(deviceId, MOVE_INTERVAL, 0, 0));
+    }
+    CompactPointerEventEncoder encoder;
+    CompactPointerEventDecoder decoder;
+
+    for (int32_t index = 0; index < N_FUZZ_EVENTS; ++index) {
+        PointerEventRecord &record = records[device(rng)];
+        Mutate(rng, record);
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+        ASSERT_EQ(encoder.Encode(record, packet), RET_OK);
+
+        PointerEventRecord decoded;
+        ASSERT_EQ(decoder.Decode(packet, decoded), RET_OK);
+        ASSERT_TRUE(IsSameRecord(decoded, record));
+        EXPECT_EQ(packet.ResidualSize(), 0);
+    }
+}
+
+/**
+ * @tc.name: CompactPointerEventCodecTest002
+ * @tc.desc: A mouse move that differs from its predecessor in a few fields is coded in a few bytes
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CompactPointerEventCodecTest, CompactPointerEventCodecTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    CompactPointerEventEncoder encoder;
+    NetPacket keyframe(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(MakeMouseMove(1, MOVE_INTERVAL, 100, 100), keyframe), RET_OK);
+    NetPacket delta(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(MakeMouseMove(1, MOVE_INTERVAL * 2, 103, 98), delta), RET_OK);
+    EXPECT_LT(delta.Size(), keyframe.Size());
+    EXPECT_LT(delta.Size(), 32U);
+}
+
+/**
+ * @tc.name: CompactPointerEventCodecTest003
+ * @tc.desc: A delta that does not follow the last decoded event is rejected until the next keyframe
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CompactPointerEventCodecTest, CompactPointerEventCodecTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    CompactPointerEventEncoder encoder;
+    CompactPointerEventDecoder decoder;
+    PointerEventRecord decoded;
+    NetPacket first(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(MakeMouseMove(1, MOVE_INTERVAL, 100, 100), first), RET_OK);
+    ASSERT_EQ(decoder.Decode(first, decoded), RET_OK);
+
+    NetPacket lost(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(MakeMouseMove(1, MOVE_INTERVAL * 2, 101, 100), lost), RET_OK);
+    NetPacket gap(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(MakeMouseMove(1, MOVE_INTERVAL * 3, 102, 100), gap), RET_OK);
+    EXPECT_EQ(decoder.Decode(gap, decoded), RET_ERR);
+
+    encoder.Reset();
+    PointerEventRecord record = MakeMouseMove(1, MOVE_INTERVAL * 4, 103, 100);
+    NetPacket resync(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(record, resync), RET_OK);
+    ASSERT_EQ(decoder.Decode(resync, decoded), RET_OK);
+    EXPECT_TRUE(IsSameRecord(decoded, record));
+}
+
+/**
+ * @tc.name: CompactPointerEventCodecTest004
+ * @tc.desc: Truncated packets are rejected without consuming input
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CompactPointerEventCodecTest, CompactPointerEventCodecTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::mt19937 rng(RANDOM_SEED);
+    PointerEventRecord record = MakeMouseMove(1, MOVE_INTERVAL, 100, 100);
+    for (int32_t index = 0; index < N_MOVES; ++index) {
+        Mutate(rng, record);
+    }
+    CompactPointerEventEncoder encoder;
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(record, packet), RET_OK);
+    const char *data = packet.ReadBuf();
+    size_t size = static_cast<size_t>(packet.ResidualSize());
+
+    for (size_t length = 0; length < size; ++length) {
+        NetPacket truncated(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+        if (length > 0) {
+            ASSERT_TRUE(truncated.Write(data, length));
+        }
+        CompactPointerEventDecoder decoder;
+        PointerEventRecord decoded;
+        EXPECT_EQ(decoder.Decode(truncated, decoded), RET_ERR);
+        EXPECT_EQ(truncated.ResidualSize(), static_cast<int32_t>(length));
+    }
+}
+
+/**
+ * @tc.name: CompactPointerEventCodecTest005
+ * @tc.desc: Pointer events converted to records and back keep the fields carried by the legacy schema
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CompactPointerEventCodecTest, CompactPointerEventCodecTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = MMI::PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetDeviceId(1);
+    pointerEvent->SetAxisValue(MMI::PointerEvent::AXIS_TYPE_SCROLL_VERTICAL, 1.5);
+    MMI::PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayX(100);
+    item.SetDisplayY(200);
+    item.SetRawDx(3);
+    item.SetRawDy(-4);
+    pointerEvent->AddPointerItem(item);
+
+    CompactPointerEventEncoder encoder;
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    ASSERT_EQ(encoder.Encode(pointerEvent, MOVE_INTERVAL, packet), RET_OK);
+
+    auto decoded = MMI::PointerEvent::Create();
+    ASSERT_NE(decoded, nullptr);
+    CompactPointerEventDecoder decoder;
+    int64_t interceptorTime { 0 };
+    ASSERT_EQ(decoder.Decode(packet, decoded, interceptorTime), RET_OK);
+    EXPECT_EQ(interceptorTime, MOVE_INTERVAL);
+    EXPECT_EQ(decoded->GetPointerAction(), MMI::PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(decoded->GetSourceType(), MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    EXPECT_EQ(decoded->GetDeviceId(), 1);
+    EXPECT_EQ(decoded->GetAxisValue(MMI::PointerEvent::AXIS_TYPE_SCROLL_VERTICAL), 1.5);
+    MMI::PointerEvent::PointerItem decodedItem;
+    ASSERT_TRUE(decoded->GetPointerItem(0, decodedItem));
+    EXPECT_EQ(decodedItem.GetDisplayX(), 100);
+    EXPECT_EQ(decodedItem.GetDisplayY(), 200);
+    EXPECT_EQ(decodedItem.GetRawDx(), 3);
+    EXPECT_EQ(decodedItem.GetRawDy(), -4);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
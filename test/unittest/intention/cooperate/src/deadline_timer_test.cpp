@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "deadline_timer.h"
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DeadlineTimerTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+using namespace Cooperate;
+namespace {
+constexpr std::chrono::milliseconds DEADLINE { 2 };
+// TimerManager does not go below 50 ms; a deadline that late was not served by DeadlineTimer.
+constexpr std::chrono::milliseconds MAX_LATENESS { 25 };
+constexpr std::chrono::milliseconds MAX_WAIT_TIME { 500 };
+} // namespace
+
+class DeadlineTimerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void DeadlineTimerTest::SetUpTestCase() {}
+
+void DeadlineTimerTest::TearDownTestCase() {}
+
+void DeadlineTimerTest::SetUp() {}
+
+void DeadlineTimerTest::TearDown() {}
+
+/**
+ * @tc.name: DeadlineTimerTest001
+ * @tc.desc: The callback runs once its deadline has passed, within a few milliseconds
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeadlineTimerTest, DeadlineTimerTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeadlineTimer timer;
+    std::promise<std::chrono::steady_clock::time_point> fired;
+    auto future = fired.get_future();
+    auto startTime = std::chrono::steady_clock::now();
+
+    ASSERT_EQ(timer.Arm(DEADLINE, [&fired] {
+        fired.set_value(std::chrono::steady_clock::now());
+    }), RET_OK);
+    ASSERT_EQ(future.wait_for(MAX_WAIT_TIME), std::future_status::ready);
+    auto elapsed = future.get() - startTime;
+    EXPECT_GE(elapsed, DEADLINE);
+    EXPECT_LT(elapsed, DEADLINE + MAX_LATENESS);
+    EXPECT_FALSE(timer.IsArmed());
+}
+
+/**
+ * @tc.name: DeadlineTimerTest002
+ * @tc.desc: A cancelled callback does not run
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeadlineTimerTest, DeadlineTimerTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeadlineTimer timer;
+    std::atomic<int32_t> nCalls { 0 };
+
+    ASSERT_EQ(timer.Arm(DEADLINE, [&nCalls] {
+        ++nCalls;
+    }), RET_OK);
+    timer.Cancel();
+    EXPECT_FALSE(timer.IsArmed());
+    std::this_thread::sleep_for(DEADLINE * 10);
+    EXPECT_EQ(nCalls.load(), 0);
+}
+
+/**
+ * @tc.name: DeadlineTimerTest003
+ * @tc.desc: Arming again replaces the pending callback, and the timer can be armed after it fired
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeadlineTimerTest, DeadlineTimerTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeadlineTimer timer;
+    std::atomic<int32_t> nReplaced { 0 };
+    std::promise<void> first;
+    std::promise<void> second;
+
+    ASSERT_EQ(timer.Arm(MAX_WAIT_TIME, [&nReplaced] {
+        ++nReplaced;
+    }), RET_OK);
+    ASSERT_EQ(timer.Arm(DEADLINE, [&first] {
+        first.set_value();
+    }), RET_OK);
+    ASSERT_EQ(first.get_future().wait_for(MAX_WAIT_TIME), std::future_status::ready);
+    ASSERT_EQ(timer.Arm(DEADLINE, [&second] {
+        second.set_value();
+    }), RET_OK);
+    ASSERT_EQ(second.get_future().wait_for(MAX_WAIT_TIME), std::future_status::ready);
+    EXPECT_EQ(nReplaced.load(), 0);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -14,6 +14,9 @@
  */
 #include "hot_area_test.h"
 
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include "cooperate_context.h"
 #include "cooperate_free.h"
 #include "cooperate_in.h"
@@ -29,6 +32,7 @@
 #include "mouse_location.h"
 #include "socket_session.h"
 #include "state_machine.h"
+#include "utility.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -45,6 +49,9 @@ constexpr int32_t HOTAREA_250 { 250 };
 constexpr int32_t HOTAREA_200 { 200 };
 constexpr int32_t HOTAREA_150 { 150 };
 constexpr int32_t HOTAREA_50 { 50 };
+constexpr int32_t MAX_NOTIFY_RATE { 10 };
+constexpr int64_t NOTIFY_INTERVAL_US { 100000 };
+constexpr int64_t CLOCK_STEP_US { 10000 };
 std::shared_ptr<Context> g_context { nullptr };
 std::shared_ptr<Context> g_contextOne { nullptr };
 std::shared_ptr<HotplugObserver> g_observer { nullptr };
@@ -282,6 +289,77 @@ HWTEST_F(HotAreaTest, HotAreaTest001, TestSize.Level1)
     ret = g_context->hotArea_.ProcessData(pointerEvent);
     EXPECT_EQ(ret, RET_OK);
 }
+
+/**
+ * @tc.name: HotAreaTest002
+ * @tc.desc: Verify the default and per-listener notify policy by the notifications delivered,
+ *           including a rate-limited transition that goes out after the pointer stopped
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(HotAreaTest, HotAreaTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    int32_t pid = IPCSkeleton::GetCallingPid();
+    HotArea::NotifyPolicy policy { .edgeTriggered = true, .maxRate = 0 };
+    EXPECT_FALSE(g_context->hotArea_.SetListenerPolicy(pid, policy));
+
+    int32_t sockFds[2] { -1, -1 };
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockFds), 0);
+    auto session = std::make_shared<SocketSession>("test", 1, 1, sockFds[0], IPCSkeleton::GetCallingUid(), pid);
+    g_socketSessionMgr.sessions_.clear();
+    g_socketSessionMgr.sessions_.emplace(sockFds[0], session);
+    RegisterHotareaListenerEvent registerHotareaListenerEvent { pid, 1 };
+    g_context->hotArea_.AddListener(registerHotareaListenerEvent);
+    int64_t now { 0 };
+    {
+        std::lock_guard guard(g_context->hotArea_.lock_);
+        g_context->hotArea_.clock_ = [&now] {
+            return now;
+        };
+    }
+
+    uint64_t nDelivered = g_context->hotArea_.GetDeliveredCount();
+    uint64_t nSuppressed = g_context->hotArea_.GetSuppressedCount();
+    g_context->hotArea_.OnHotAreaMessage(HotAreaType::AREA_LEFT, true);
+    g_context->hotArea_.OnHotAreaMessage(HotAreaType::AREA_LEFT, true);
+    EXPECT_EQ(g_context->hotArea_.GetDeliveredCount(), nDelivered + 2);
+    EXPECT_EQ(g_context->hotArea_.GetSuppressedCount(), nSuppressed);
+
+    EXPECT_TRUE(g_context->hotArea_.SetListenerPolicy(pid, policy));
+    g_context->hotArea_.OnHotAreaMessage(HotAreaType::AREA_LEFT, true);
+    g_context->hotArea_.OnHotAreaMessage(HotAreaType::AREA_RIGHT, false);
+    g_context->hotArea_.OnHotAreaMessage(HotAreaType::AREA_RIGHT, false);
+    EXPECT_EQ(g_context->hotArea_.GetDeliveredCount(), nDelivered + 3);
+    EXPECT_EQ(g_context->hotArea_.GetSuppressedCount(), nSuppressed + 2);
+
+    policy.maxRate = MAX_NOTIFY_RATE;
+    EXPECT_TRUE(g_context->hotArea_.SetListenerPolicy(pid, policy));
+    now += NOTIFY_INTERVAL_US;
+    g_context->hotArea_.OnHotAreaMessage(HotAreaType::AREA_LEFT, true);
+    EXPECT_EQ(g_context->hotArea_.GetDeliveredCount(), nDelivered + 4);
+    now += CLOCK_STEP_US;
+    g_context->hotArea_.OnHotAreaMessage(HotAreaType::AREA_RIGHT, false);
+    EXPECT_EQ(g_context->hotArea_.GetDeliveredCount(), nDelivered + 4);
+    EXPECT_EQ(g_context->hotArea_.GetSuppressedCount(), nSuppressed + 3);
+    g_context->hotArea_.FlushPending();
+    EXPECT_EQ(g_context->hotArea_.GetDeliveredCount(), nDelivered + 4);
+    now += NOTIFY_INTERVAL_US;
+    g_context->hotArea_.FlushPending();
+    EXPECT_EQ(g_context->hotArea_.GetDeliveredCount(), nDelivered + 5);
+    g_context->hotArea_.FlushPending();
+    EXPECT_EQ(g_context->hotArea_.GetDeliveredCount(), nDelivered + 5);
+    {
+        std::lock_guard guard(g_context->hotArea_.lock_);
+        g_context->hotArea_.clock_ = &Utility::GetSysClockTime;
+    }
+
+    UnregisterHotareaListenerEvent unregisterHotareaListenerEvent { pid, 1 };
+    g_context->hotArea_.RemoveListener(unregisterHotareaListenerEvent);
+    EXPECT_FALSE(g_context->hotArea_.SetListenerPolicy(pid, policy));
+    g_socketSessionMgr.sessions_.clear();
+    ::close(sockFds[1]);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "input_event_transmission/input_event_batcher.h"
+
+#undef LOG_TAG
+#define LOG_TAG "InputEventBatcherTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+using namespace Cooperate;
+namespace {
+constexpr size_t BYTE_BUDGET { 64 };
+constexpr int32_t N_EVENTS { 3 };
+
+struct UnpackedPacket {
+    MessageId msgId { MessageId::INVALID };
+    std::vector<int32_t> values;
+};
+
+void MakePacket(int32_t value, size_t nValues, NetPacket &packet)
+{
+    for (size_t index = 0; index < nValues; ++index) {
+        packet << value;
+    }
+}
+
+int32_t UnpackAll(NetPacket &frame, std::vector<UnpackedPacket> &packets)
+{
+    return InputEventBatcher::Unpack(frame, [&packets](NetPacket &packet) {
+        UnpackedPacket unpacked { .msgId = packet.GetMsgId() };
+        int32_t value { 0 };
+        while ((packet.ResidualSize() > 0) && packet.Read(value)) {
+            unpacked.values.push_back(value);
+        }
+        packets.push_back(unpacked);
+    });
+}
+} // namespace
+
+class InputEventBatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void InputEventBatcherTest::SetUpTestCase() {}
+
+void InputEventBatcherTest::TearDownTestCase() {}
+
+void InputEventBatcherTest::SetUp() {}
+
+void InputEventBatcherTest::TearDown() {}
+
+/**
+ * @tc.name: InputEventBatcherTest001
+ * @tc.desc: Packets appended to a batch are unpacked from its frame in order and unchanged
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventBatcherTest, InputEventBatcherTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputEventBatcher batcher;
+    EXPECT_TRUE(batcher.IsEmpty());
+    for (int32_t index = 0; index < N_EVENTS; ++index) {
+        NetPacket packet(index == 0 ? MessageId::DSOFTBUS_INPUT_KEY_EVENT :
+            MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+        MakePacket(index, static_cast<size_t>(index + 1), packet);
+        ASSERT_TRUE(batcher.Append(packet));
+    }
+    EXPECT_EQ(batcher.GetEventCount(), static_cast<size_t>(N_EVENTS));
+
+    NetPacket frame(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    ASSERT_EQ(batcher.Flush(frame), RET_OK);
+    EXPECT_TRUE(batcher.IsEmpty());
+
+    std::vector<UnpackedPacket> packets;
+    ASSERT_EQ(UnpackAll(frame, packets), RET_OK);
+    ASSERT_EQ(packets.size(), static_cast<size_t>(N_EVENTS));
+    EXPECT_EQ(packets[0].msgId, MessageId::DSOFTBUS_INPUT_KEY_EVENT);
+    for (int32_t index = 0; index < N_EVENTS; ++index) {
+        EXPECT_EQ(packets[index].values, std::vector<int32_t>(static_cast<size_t>(index + 1), index));
+    }
+    EXPECT_EQ(packets[N_EVENTS - 1].msgId, MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+}
+
+/**
+ * @tc.name: InputEventBatcherTest002
+ * @tc.desc: A batch takes packets up to its byte budget, but always takes the first one
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventBatcherTest, InputEventBatcherTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputEventBatcher batcher(BYTE_BUDGET);
+    NetPacket small(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    MakePacket(1, 4, small);
+    size_t nFit = BYTE_BUDGET / static_cast<size_t>(small.GetPacketLength());
+    for (size_t index = 0; index < nFit; ++index) {
+        ASSERT_TRUE(batcher.Append(small));
+    }
+    EXPECT_FALSE(batcher.Append(small));
+    EXPECT_EQ(batcher.GetEventCount(), nFit);
+
+    NetPacket frame(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    ASSERT_EQ(batcher.Flush(frame), RET_OK);
+    NetPacket large(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    MakePacket(2, BYTE_BUDGET, large);
+    EXPECT_TRUE(batcher.Append(large));
+    EXPECT_TRUE(batcher.IsFull());
+    EXPECT_FALSE(batcher.Append(small));
+}
+
+/**
+ * @tc.name: InputEventBatcherTest003
+ * @tc.desc: Batches neither nest nor flush when empty
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventBatcherTest, InputEventBatcherTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputEventBatcher batcher;
+    NetPacket frame(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    EXPECT_EQ(batcher.Flush(frame), RET_ERR);
+    EXPECT_FALSE(batcher.Append(frame));
+    EXPECT_TRUE(batcher.IsEmpty());
+}
+
+/**
+ * @tc.name: InputEventBatcherTest004
+ * @tc.desc: Unpacking stops at a truncated packet and rejects a nested batch
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventBatcherTest, InputEventBatcherTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputEventBatcher batcher;
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_KEY_EVENT);
+    MakePacket(1, 2, packet);
+    ASSERT_TRUE(batcher.Append(packet));
+    ASSERT_TRUE(batcher.Append(packet));
+    NetPacket frame(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    ASSERT_EQ(batcher.Flush(frame), RET_OK);
+
+    NetPacket truncated(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    ASSERT_TRUE(truncated.Write(frame.Data(), frame.Size() - 1));
+    std::vector<UnpackedPacket> packets;
+    EXPECT_EQ(UnpackAll(truncated, packets), RET_ERR);
+    EXPECT_EQ(packets.size(), 1U);
+
+    NetPacket nested(MessageId::DSOFTBUS_INPUT_EVENT_BATCH);
+    PackHead head { .idMsg = MessageId::DSOFTBUS_INPUT_EVENT_BATCH, .size = 0 };
+    nested << head;
+    packets.clear();
+    EXPECT_EQ(UnpackAll(nested, packets), RET_ERR);
+    EXPECT_TRUE(packets.empty());
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
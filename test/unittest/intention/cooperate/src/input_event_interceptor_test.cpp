@@ -13,6 +13,10 @@
  * limitations under the License.
  */
 #include "input_event_interceptor_test.h"
+
+#include <chrono>
+#include <thread>
+
 #include "ddm_adapter.h"
 
 #undef LOG_TAG
@@ -32,6 +36,10 @@ std::unique_ptr<IDSoftbusAdapter> dsoftbus_;
 SocketSessionManager socketSessionMgr_;
 InputEventInterceptor *interceptor_ = {nullptr};
 auto env_ = ContextService::GetInstance();
+// TimerManager does not go below 50 ms, a batch held that long was not flushed by its deadline.
+constexpr std::chrono::milliseconds MAX_BATCH_HOLD_TIME { 25 };
+constexpr std::chrono::milliseconds MAX_WAIT_TIME { 500 };
+constexpr std::chrono::microseconds POLL_INTERVAL { 100 };
 } // namespace
 
 ContextService::ContextService()
@@ -263,6 +271,54 @@ HWTEST_F(InputEventInterceptorTest, InputEventInterceptorTest_ReportPointerEvent
     pointerEvent->AddPointerItem(pointerItem);
     ASSERT_NO_FATAL_FAILURE(interceptor_->ReportPointerEvent(pointerEvent));
 }
+
+/**
+ * @tc.name: InputEventInterceptorTest_BatchDeadline
+ * @tc.desc: A batched move leaves within a few milliseconds, well below the TimerManager floor
+ * @tc.type: FUNC
+ */
+HWTEST_F(InputEventInterceptorTest, InputEventInterceptorTest_BatchDeadline, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    interceptor_->peerSchema_ = INPUT_EVENT_BATCH_SCHEMA;
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    packet << static_cast<int32_t>(1);
+    auto startTime = std::chrono::steady_clock::now();
+    interceptor_->TransmitPacket(packet, false);
+    bool flushed = false;
+
+    while (!flushed && (std::chrono::steady_clock::now() - startTime < MAX_WAIT_TIME)) {
+        {
+            std::lock_guard<std::mutex> guard(interceptor_->batchMutex_);
+            flushed = interceptor_->batcher_.IsEmpty();
+        }
+        if (!flushed) {
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        }
+    }
+    auto holdTime = std::chrono::steady_clock::now() - startTime;
+    interceptor_->peerSchema_ = LEGACY_POINTER_EVENT_SCHEMA;
+    ASSERT_TRUE(flushed);
+    EXPECT_LT(holdTime, MAX_BATCH_HOLD_TIME);
+    EXPECT_GE(holdTime, std::chrono::milliseconds(DEFAULT_BATCH_DEADLINE_MS));
+}
+
+/**
+ * @tc.name: InputEventInterceptorTest_SendFailure
+ * @tc.desc: A pointer frame that does not get out makes the next compact pointer event a keyframe
+ * @tc.type: FUNC
+ */
+HWTEST_F(InputEventInterceptorTest, InputEventInterceptorTest_SendFailure, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    interceptor_->resetEncoder_ = false;
+    interceptor_->remoteNetworkId_ = "unconnected";
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT_COMPACT);
+    packet << static_cast<int32_t>(1);
+    interceptor_->TransmitPacket(packet, true);
+    EXPECT_TRUE(interceptor_->resetEncoder_.load());
+    interceptor_->remoteNetworkId_.clear();
+}
 } //namespace Cooperate
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -35,6 +35,27 @@ namespace {
 constexpr int32_t TIME_WAIT_FOR_OP_MS { 20 };
 constexpr int32_t TEMP_RAW { 10 };
 constexpr int32_t TEMP_MIN_RAW { 0 };
+constexpr int32_t STEP_RAW { 4 };
+constexpr int32_t N_MOVES { 32 };
+constexpr int64_t MIN_WINDOW_US { 2000 };
+constexpr int64_t MAX_WINDOW_US { 16000 };
+
+std::shared_ptr<MMI::PointerEvent> CreateMoveEvent(int32_t rawDx, int32_t rawDy)
+{
+    auto pointerEvent = MMI::PointerEvent::Create();
+    if (pointerEvent == nullptr) {
+        return nullptr;
+    }
+    MMI::PointerEvent::PointerItem pointerItem;
+    pointerItem.SetPointerId(0);
+    pointerItem.SetRawDx(rawDx);
+    pointerItem.SetRawDy(rawDy);
+    pointerEvent->AddPointerItem(pointerItem);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+    return pointerEvent;
+}
 } // namespace
 
 class InputEventSamplerTest : public testing::Test {
@@ -426,6 +447,91 @@ HWTEST_F(InputEventSamplerTest, TestIsAggregationIntervalMatched_01, TestSize.Le
     sampler.UpdateAggregationTimeStamp();
     ASSERT_NO_FATAL_FAILURE(sampler.IsAggregationIntervalMatched());
 }
+
+/**
+ * @tc.name: TestComputeWindowUs_01
+ * @tc.desc: Test that the adaptive window follows pointer velocity and is capped by link RTT
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventSamplerTest, TestComputeWindowUs_01, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    Cooperate::InputEventSampler sampler;
+    sampler.adaptive_.velocity = 0.0;
+    ASSERT_EQ(sampler.ComputeWindowUs(), MIN_WINDOW_US);
+    sampler.adaptive_.velocity = 100.0;
+    sampler.SetLinkRtt(40);
+    ASSERT_EQ(sampler.ComputeWindowUs(), 10000);
+    sampler.SetLinkRtt(1000);
+    ASSERT_EQ(sampler.ComputeWindowUs(), MAX_WINDOW_US);
+    sampler.SetLinkRtt(0);
+    ASSERT_EQ(sampler.ComputeWindowUs(), MIN_WINDOW_US);
+}
+
+/**
+ * @tc.name: TestHandleAdaptiveMouseEvent_01
+ * @tc.desc: Test that adaptive sampling aggregates moves without losing displacement
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventSamplerTest, TestHandleAdaptiveMouseEvent_01, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    Cooperate::InputEventSampler sampler;
+    int32_t nForwarded { 0 };
+    int32_t forwardedDx { 0 };
+    sampler.SetPointerEventHandler([&](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
+        MMI::PointerEvent::PointerItem pointerItem;
+        if (pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem)) {
+            ++nForwarded;
+            forwardedDx += pointerItem.GetRawDx();
+        }
+    });
+    auto now = std::chrono::steady_clock::now();
+    for (int32_t index = 0; index < N_MOVES; ++index) {
+        sampler.HandleAdaptiveMouseEvent(CreateMoveEvent(STEP_RAW, 0), now + std::chrono::milliseconds(index));
+    }
+    EXPECT_GT(nForwarded, 1);
+    EXPECT_LT(nForwarded, N_MOVES);
+    EXPECT_EQ(forwardedDx + sampler.adaptive_.pendingDx, STEP_RAW * N_MOVES);
+
+    auto buttonEvent = CreateMoveEvent(STEP_RAW, 0);
+    ASSERT_NE(buttonEvent, nullptr);
+    buttonEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN);
+    sampler.HandleAdaptiveMouseEvent(buttonEvent, now + std::chrono::milliseconds(N_MOVES));
+    EXPECT_EQ(sampler.adaptive_.pendingDx, 0);
+    EXPECT_EQ(forwardedDx, STEP_RAW * (N_MOVES + 1));
+    Cooperate::InputEventSamplerStats stats = sampler.GetStats();
+    EXPECT_EQ(stats.nOutputEvents, static_cast<uint64_t>(nForwarded));
+    EXPECT_GE(stats.maxAddedLatencyUs, stats.avgAddedLatencyUs);
+}
+
+/**
+ * @tc.name: TestGetStats_01
+ * @tc.desc: Test sampler statistics in adaptive mode
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventSamplerTest, TestGetStats_01, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    Cooperate::InputEventSampler sampler;
+    sampler.SetPointerEventHandler([](std::shared_ptr<MMI::PointerEvent> pointerEvent) {});
+    sampler.SetSamplingMode(Cooperate::SamplingMode::ADAPTIVE);
+    for (int32_t index = 0; index < N_MOVES; ++index) {
+        sampler.OnPointerEvent(CreateMoveEvent(STEP_RAW, STEP_RAW));
+    }
+    Cooperate::InputEventSamplerStats stats = sampler.GetStats();
+    EXPECT_EQ(stats.nInputEvents, static_cast<uint64_t>(N_MOVES));
+    EXPECT_GE(stats.nOutputEvents, 1U);
+    EXPECT_GE(stats.aggregationRatio, 1.0);
+    EXPECT_GT(stats.inputRate, 0.0);
+    sampler.ResetStats();
+    stats = sampler.GetStats();
+    EXPECT_EQ(stats.nInputEvents, 0U);
+    EXPECT_EQ(stats.nOutputEvents, 0U);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "mouse_location_stream.h"
+
+#undef LOG_TAG
+#define LOG_TAG "MouseLocationStreamTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+using namespace Cooperate;
+namespace {
+constexpr uint16_t SESSION_ID { 7 };
+constexpr int32_t FRAME_RATE { 100 };
+constexpr int64_t FRAME_INTERVAL { 10000 };
+constexpr int64_t START_TIME { 1000000 };
+constexpr int32_t DISPLAY_WIDTH { 1920 };
+constexpr int32_t DISPLAY_HEIGHT { 1080 };
+constexpr int32_t N_FRAMES { 40 };
+
+StreamLocation MakeLocation(int32_t displayX, int32_t displayY)
+{
+    return StreamLocation {
+        .displayX = displayX,
+        .displayY = displayY,
+        .displayWidth = DISPLAY_WIDTH,
+        .displayHeight = DISPLAY_HEIGHT,
+    };
+}
+
+bool EncodeFrame(MouseLocationStreamEncoder &encoder, int64_t now, LocationFrame &frame)
+{
+    NetPacket packet(MessageId::DSOFTBUS_MOUSE_LOCATION_STREAM);
+    if (!encoder.Encode(now, packet)) {
+        return false;
+    }
+    return (MouseLocationStreamDecoder::ReadFrame(packet, frame) == RET_OK);
+}
+
+bool IsSameLocation(const StreamLocation &lhs, const StreamLocation &rhs)
+{
+    return ((lhs.displayX == rhs.displayX) && (lhs.displayY == rhs.displayY) &&
+        (lhs.displayWidth == rhs.displayWidth) && (lhs.displayHeight == rhs.displayHeight));
+}
+} // namespace
+
+class MouseLocationStreamTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void MouseLocationStreamTest::SetUpTestCase() {}
+
+void MouseLocationStreamTest::TearDownTestCase() {}
+
+void MouseLocationStreamTest::SetUp() {}
+
+void MouseLocationStreamTest::TearDown() {}
+
+/**
+ * @tc.name: MouseLocationStreamTest001
+ * @tc.desc: The first frame of a stream is a keyframe and round-trips unchanged
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseLocationStreamTest, MouseLocationStreamTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    MouseLocationStreamEncoder encoder(SESSION_ID, FRAME_RATE);
+    MouseLocationStreamDecoder decoder;
+    StreamLocation origin = MakeLocation(100, 200);
+    encoder.Push(origin);
+    EXPECT_TRUE(encoder.HasPending());
+    EXPECT_EQ(encoder.GetDelay(START_TIME), 0);
+
+    LocationFrame frame;
+    ASSERT_TRUE(EncodeFrame(encoder, START_TIME, frame));
+    EXPECT_EQ(frame.kind, LocationFrame::KEYFRAME);
+    EXPECT_EQ(frame.sessionId, SESSION_ID);
+    EXPECT_FALSE(encoder.HasPending());
+
+    StreamLocation location;
+    ASSERT_TRUE(decoder.Apply(frame, location));
+    EXPECT_TRUE(IsSameLocation(location, origin));
+}
+
+/**
+ * @tc.name: MouseLocationStreamTest002
+ * @tc.desc: Locations pushed within one frame interval are coalesced into one delta frame
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseLocationStreamTest, MouseLocationStreamTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    MouseLocationStreamEncoder encoder(SESSION_ID, FRAME_RATE);
+    MouseLocationStreamDecoder decoder;
+    LocationFrame frame;
+    StreamLocation location;
+    encoder.Push(MakeLocation(100, 200));
+    ASSERT_TRUE(EncodeFrame(encoder, START_TIME, frame));
+    ASSERT_TRUE(decoder.Apply(frame, location));
+
+    encoder.Push(MakeLocation(101, 199));
+    encoder.Push(MakeLocation(103, 196));
+    EXPECT_EQ(encoder.GetDelay(START_TIME + FRAME_INTERVAL / 2), FRAME_INTERVAL / 2);
+    EXPECT_FALSE(EncodeFrame(encoder, START_TIME + FRAME_INTERVAL / 2, frame));
+    EXPECT_TRUE(encoder.HasPending());
+
+    ASSERT_TRUE(EncodeFrame(encoder, START_TIME + FRAME_INTERVAL, frame));
+    EXPECT_EQ(frame.kind, LocationFrame::DELTA);
+    ASSERT_TRUE(decoder.Apply(frame, location));
+    EXPECT_TRUE(IsSameLocation(location, MakeLocation(103, 196)));
+
+    encoder.Push(MakeLocation(103, 196));
+    EXPECT_FALSE(encoder.HasPending());
+    EXPECT_EQ(encoder.GetDelay(START_TIME + FRAME_INTERVAL), -1);
+}
+
+/**
+ * @tc.name: MouseLocationStreamTest003
+ * @tc.desc: Delta frames out of sequence or from another session are dropped until the next keyframe
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseLocationStreamTest, MouseLocationStreamTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    MouseLocationStreamEncoder encoder(SESSION_ID, FRAME_RATE);
+    MouseLocationStreamDecoder decoder;
+    LocationFrame frame;
+    StreamLocation location;
+    int64_t now = START_TIME;
+    encoder.Push(MakeLocation(0, 0));
+    ASSERT_TRUE(EncodeFrame(encoder, now, frame));
+    ASSERT_TRUE(decoder.Apply(frame, location));
+
+    now += FRAME_INTERVAL;
+    encoder.Push(MakeLocation(1, 1));
+    ASSERT_TRUE(EncodeFrame(encoder, now, frame));
+    now += FRAME_INTERVAL;
+    encoder.Push(MakeLocation(2, 2));
+    ASSERT_TRUE(EncodeFrame(encoder, now, frame));
+    EXPECT_FALSE(decoder.Apply(frame, location));
+    EXPECT_EQ(decoder.GetDroppedCount(), 1U);
+
+    LocationFrame stranger = frame;
+    stranger.sessionId = SESSION_ID + 1;
+    EXPECT_FALSE(decoder.Apply(stranger, location));
+    EXPECT_EQ(decoder.GetDroppedCount(), 2U);
+
+    encoder.RequestKeyframe();
+    now += FRAME_INTERVAL;
+    encoder.Push(MakeLocation(3, 3));
+    ASSERT_TRUE(EncodeFrame(encoder, now, frame));
+    EXPECT_EQ(frame.kind, LocationFrame::KEYFRAME);
+    ASSERT_TRUE(decoder.Apply(frame, location));
+    EXPECT_TRUE(IsSameLocation(location, MakeLocation(3, 3)));
+}
+
+/**
+ * @tc.name: MouseLocationStreamTest004
+ * @tc.desc: Keyframes are sent periodically, on display change and when a delta does not fit
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseLocationStreamTest, MouseLocationStreamTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    MouseLocationStreamEncoder encoder(SESSION_ID, FRAME_RATE);
+    MouseLocationStreamDecoder decoder;
+    LocationFrame frame;
+    StreamLocation location;
+    int64_t now = START_TIME;
+    int32_t nKeyframes = 0;
+    for (int32_t i = 0; i < N_FRAMES; ++i, now += FRAME_INTERVAL) {
+        encoder.Push(MakeLocation(i, -i));
+        ASSERT_TRUE(EncodeFrame(encoder, now, frame));
+        nKeyframes += (frame.kind == LocationFrame::KEYFRAME ? 1 : 0);
+        ASSERT_TRUE(decoder.Apply(frame, location));
+        EXPECT_TRUE(IsSameLocation(location, MakeLocation(i, -i)));
+    }
+    EXPECT_EQ(nKeyframes, 2);
+
+    StreamLocation rotated { .displayX = 0, .displayY = 0, .displayWidth = DISPLAY_HEIGHT,
+        .displayHeight = DISPLAY_WIDTH };
+    encoder.Push(rotated);
+    ASSERT_TRUE(EncodeFrame(encoder, now, frame));
+    EXPECT_EQ(frame.kind, LocationFrame::KEYFRAME);
+
+    now += FRAME_INTERVAL;
+    rotated.displayX = INT16_MAX + 1;
+    encoder.Push(rotated);
+    ASSERT_TRUE(EncodeFrame(encoder, now, frame));
+    EXPECT_EQ(frame.kind, LocationFrame::KEYFRAME);
+    ASSERT_TRUE(decoder.Apply(frame, location));
+    EXPECT_TRUE(IsSameLocation(location, rotated));
+}
+
+/**
+ * @tc.name: MouseLocationStreamTest005
+ * @tc.desc: Truncated frames and frames of unknown kind are rejected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseLocationStreamTest, MouseLocationStreamTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    LocationFrame frame;
+    NetPacket truncated(MessageId::DSOFTBUS_MOUSE_LOCATION_STREAM);
+    truncated << static_cast<uint8_t>(LocationFrame::KEYFRAME) << SESSION_ID << static_cast<uint16_t>(1);
+    EXPECT_EQ(MouseLocationStreamDecoder::ReadFrame(truncated, frame), RET_ERR);
+
+    NetPacket unknown(MessageId::DSOFTBUS_MOUSE_LOCATION_STREAM);
+    unknown << static_cast<uint8_t>(0) << SESSION_ID << static_cast<uint16_t>(1);
+    EXPECT_EQ(MouseLocationStreamDecoder::ReadFrame(unknown, frame), RET_ERR);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
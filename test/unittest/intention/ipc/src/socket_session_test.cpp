@@ -15,6 +15,9 @@
 
 #include "socket_session_test.h"
 
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include "ipc_skeleton.h"
 #include "message_parcel.h"
 
@@ -41,6 +44,7 @@ IContext *g_context { nullptr };
 Intention g_intention { Intention::UNKNOWN_INTENTION };
 constexpr int32_t TIME_WAIT_FOR_OP_MS { 20 };
 constexpr int32_t NUM_ONE { 1 };
+constexpr int32_t MAX_N_PACKETS { 1024 };
 } // namespace
 
 void SocketSessionTest::SetUpTestCase() {}
@@ -392,6 +396,42 @@ HWTEST_F(SocketSessionTest, SocketSessionTest33, TestSize.Level0)
     ASSERT_NO_FATAL_FAILURE(socketConnection.OnReadable(fd));
     ASSERT_NO_FATAL_FAILURE(socketConnection.OnShutdown(fd));
 }
+
+/**
+ * @tc.name: SocketSessionTest34
+ * @tc.desc: A session that can not send right away is watched for EPOLLOUT and flushed when writable
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(SocketSessionTest, SocketSessionTest34, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    int32_t sockFds[2] { -1, -1 };
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockFds), 0);
+    int32_t uid = IPCSkeleton::GetCallingUid();
+    int32_t pid = IPCSkeleton::GetCallingPid();
+    auto session = std::make_shared<SocketSession>("test", NUM_ONE, NUM_ONE, sockFds[0], uid, pid);
+    ASSERT_EQ(g_socketSessionManager->Enable(), RET_OK);
+    ASSERT_TRUE(g_socketSessionManager->AddSession(session));
+
+    NetPacket pkt(MessageId::COORDINATION_MESSAGE);
+    pkt << std::string(BUF_CMD_SIZE, 'x');
+    for (int32_t index = 0; (index < MAX_N_PACKETS) && (session->GetSendQueueDepth() == 0); ++index) {
+        ASSERT_TRUE(session->SendMsg(pkt));
+    }
+    ASSERT_GT(session->GetSendQueueDepth(), 0U);
+    EXPECT_EQ(session->GetEvents() & EPOLLOUT, EPOLLOUT);
+
+    char buf[BUF_CMD_SIZE] {};
+    for (int32_t index = 0; (index < MAX_N_PACKETS) && (session->GetSendQueueDepth() > 0); ++index) {
+        while (::recv(sockFds[1], buf, sizeof(buf), MSG_DONTWAIT) > 0) {}
+        g_socketSessionManager->DispatchOne();
+    }
+    EXPECT_EQ(session->GetSendQueueDepth(), 0U);
+    EXPECT_EQ(session->GetEvents() & EPOLLOUT, 0U);
+    g_socketSessionManager->ReleaseSession(sockFds[0]);
+    ::close(sockFds[1]);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
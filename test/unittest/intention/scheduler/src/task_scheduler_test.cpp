@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "task_scheduler.h"
+
+#undef LOG_TAG
+#define LOG_TAG "TaskSchedulerTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t POLL_TIMEOUT_MS { 10 };
+constexpr int32_t N_PRODUCERS { 4 };
+constexpr int32_t TASKS_PER_PRODUCER { 2000 };
+constexpr int32_t N_BURST_TASKS { 100 };
+constexpr int32_t MAX_TASKS_LIMIT { 1000 };
+constexpr int32_t SYNC_RESULT { 42 };
+} // namespace
+
+class TaskSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+
+    void StartWorker(TaskScheduler &scheduler);
+    void StopWorker();
+
+    std::atomic_bool running_ { false };
+    std::thread worker_;
+};
+
+void TaskSchedulerTest::StartWorker(TaskScheduler &scheduler)
+{
+    running_ = true;
+    std::promise<void> started;
+    auto future = started.get_future();
+    worker_ = std::thread([this, &scheduler, &started] {
+        scheduler.SetWorkerThreadId(GetThisThreadId());
+        started.set_value();
+        struct pollfd pfd { scheduler.GetReadFd(), POLLIN, 0 };
+        while (running_) {
+            if (::poll(&pfd, 1, POLL_TIMEOUT_MS) > 0) {
+                scheduler.ProcessTasks();
+            }
+        }
+    });
+    future.wait();
+}
+
+void TaskSchedulerTest::StopWorker()
+{
+    running_ = false;
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+/**
+ * @tc.name: TaskSchedulerTest001
+ * @tc.desc: Async tasks from several threads all run, in posting order per thread.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TaskSchedulerTest, TaskSchedulerTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TaskScheduler scheduler;
+    ASSERT_TRUE(scheduler.Init());
+    StartWorker(scheduler);
+    std::vector<int32_t> lastSeen(N_PRODUCERS, -1);
+    std::atomic<int32_t> nOutOfOrder { 0 };
+    std::atomic<int32_t> nDone { 0 };
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < N_PRODUCERS; ++producer) {
+        producers.emplace_back([&, producer] {
+            for (int32_t seq = 0; seq < TASKS_PER_PRODUCER;) {
+                int32_t ret = scheduler.PostAsyncTask([&, producer, seq] {
+                    if (lastSeen[producer] + 1 != seq) {
+                        ++nOutOfOrder;
+                    }
+                    lastSeen[producer] = seq;
+                    ++nDone;
+                    return RET_OK;
+                });
+                if (ret == RET_OK) {
+                    ++seq;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    scheduler.PostSyncTask([] { return RET_OK; });
+    StopWorker();
+    EXPECT_EQ(nDone.load(), N_PRODUCERS * TASKS_PER_PRODUCER);
+    EXPECT_EQ(nOutOfOrder.load(), 0);
+}
+
+/**
+ * @tc.name: TaskSchedulerTest002
+ * @tc.desc: A burst of posts signals the eventfd once, and a partial drain signals it again.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TaskSchedulerTest, TaskSchedulerTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TaskScheduler scheduler;
+    ASSERT_TRUE(scheduler.Init());
+    int32_t nDone = 0;
+    for (int32_t index = 0; index < N_BURST_TASKS; ++index) {
+        EXPECT_EQ(scheduler.PostAsyncTask([&nDone] {
+            ++nDone;
+            return RET_OK;
+        }), RET_OK);
+    }
+    eventfd_t value = 0;
+    ASSERT_EQ(::eventfd_read(scheduler.GetReadFd(), &value), 0);
+    EXPECT_EQ(value, 1);
+    ASSERT_EQ(::eventfd_write(scheduler.GetReadFd(), value), 0);
+
+    scheduler.ProcessTasks();
+    EXPECT_GT(nDone, 0);
+    EXPECT_LT(nDone, N_BURST_TASKS);
+    struct pollfd pfd { scheduler.GetReadFd(), POLLIN, 0 };
+    ASSERT_EQ(::poll(&pfd, 1, 0), 1);
+    scheduler.ProcessTasks();
+    EXPECT_EQ(nDone, N_BURST_TASKS);
+    EXPECT_EQ(::poll(&pfd, 1, 0), 0);
+}
+
+/**
+ * @tc.name: TaskSchedulerTest003
+ * @tc.desc: Sync tasks return the callback result, and run inline on the worker thread.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TaskSchedulerTest, TaskSchedulerTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TaskScheduler scheduler;
+    ASSERT_TRUE(scheduler.Init());
+    StartWorker(scheduler);
+    for (int32_t index = 0; index < N_BURST_TASKS; ++index) {
+        EXPECT_EQ(scheduler.PostSyncTask([index] { return index; }), index);
+    }
+    int32_t ret = scheduler.PostSyncTask([&scheduler] {
+        bool inline_ = false;
+        int32_t nested = scheduler.PostSyncTask([&inline_] {
+            inline_ = true;
+            return SYNC_RESULT;
+        });
+        return ((inline_ && (nested == SYNC_RESULT)) ? RET_OK : RET_ERR);
+    });
+    EXPECT_EQ(ret, RET_OK);
+    EXPECT_EQ(scheduler.PostSyncTask(nullptr), ERROR_NULL_POINTER);
+    StopWorker();
+}
+
+/**
+ * @tc.name: TaskSchedulerTest004
+ * @tc.desc: Posting fails once the queue holds MAX_TASKS_LIMIT tasks.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TaskSchedulerTest, TaskSchedulerTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TaskScheduler scheduler;
+    EXPECT_EQ(scheduler.PostAsyncTask([] { return RET_OK; }), ETASKS_POST_ASYNCTASK_FAIL);
+    ASSERT_TRUE(scheduler.Init());
+    for (int32_t index = 0; index < MAX_TASKS_LIMIT; ++index) {
+        EXPECT_EQ(scheduler.PostAsyncTask([] { return RET_OK; }), RET_OK);
+    }
+    EXPECT_EQ(scheduler.PostAsyncTask([] { return RET_OK; }), ETASKS_POST_ASYNCTASK_FAIL);
+}
+
+/**
+ * @tc.name: TaskSchedulerTest005
+ * @tc.desc: A sync task that times out before running is discarded, not run.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TaskSchedulerTest, TaskSchedulerTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TaskScheduler scheduler;
+    ASSERT_TRUE(scheduler.Init());
+    bool executed = false;
+    EXPECT_EQ(scheduler.PostSyncTask([&executed] {
+        executed = true;
+        return RET_OK;
+    }), ETASKS_WAIT_TIMEOUT);
+    scheduler.ProcessTasks();
+    EXPECT_FALSE(executed);
+}
+
+/**
+ * @tc.name: TaskSchedulerTest006
+ * @tc.desc: A sync task still running at the timeout is not awaited, it finishes on the worker afterwards.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TaskSchedulerTest, TaskSchedulerTest006, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TaskScheduler scheduler;
+    ASSERT_TRUE(scheduler.Init());
+    StartWorker(scheduler);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic_bool finished { false };
+    EXPECT_EQ(scheduler.PostSyncTask([released, &finished] {
+        released.wait();
+        finished = true;
+        return RET_OK;
+    }), ETASKS_WAIT_TIMEOUT);
+    EXPECT_FALSE(finished);
+    release.set_value();
+    EXPECT_EQ(scheduler.PostSyncTask([] { return SYNC_RESULT; }), SYNC_RESULT);
+    EXPECT_TRUE(finished);
+    StopWorker();
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "timer_wheel.h"
+
+#undef LOG_TAG
+#define LOG_TAG "TimerWheelTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int64_t START_TIME { 1000 };
+constexpr int32_t SHORT_INTERVAL_MS { 50 };
+constexpr int32_t DEFAULT_INTERVAL_MS { 100 };
+constexpr int32_t LONG_INTERVAL_MS { 600000 };
+constexpr int32_t REPEAT_ONCE { 1 };
+constexpr int32_t REPEAT_THREE_TIMES { 3 };
+constexpr int32_t REPEAT_FOREVER { 0 };
+constexpr size_t MANY_TIMERS { 5000 };
+} // namespace
+
+class TimerWheelTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: TimerWheelTest001
+ * @tc.desc: Timers fire on their expiry tick, in expiry order.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerWheelTest, TimerWheelTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TimerWheel wheel;
+    std::vector<int32_t> fired;
+    int32_t timer1 = wheel.AddTimer(START_TIME, DEFAULT_INTERVAL_MS, REPEAT_ONCE, [&fired] { fired.push_back(1); });
+    int32_t timer2 = wheel.AddTimer(START_TIME, SHORT_INTERVAL_MS, REPEAT_ONCE, [&fired] { fired.push_back(2); });
+    int32_t timer3 = wheel.AddTimer(START_TIME, DEFAULT_INTERVAL_MS, REPEAT_ONCE, [&fired] { fired.push_back(3); });
+    EXPECT_GE(timer1, 0);
+    EXPECT_GE(timer2, 0);
+    EXPECT_GE(timer3, 0);
+    EXPECT_EQ(wheel.GetTimerCount(), 3);
+    EXPECT_EQ(wheel.GetNextExpireTime(), START_TIME + SHORT_INTERVAL_MS);
+
+    wheel.ProcessTimers(START_TIME + SHORT_INTERVAL_MS - 1);
+    EXPECT_TRUE(fired.empty());
+    wheel.ProcessTimers(START_TIME + SHORT_INTERVAL_MS);
+    EXPECT_EQ(fired, std::vector<int32_t>({ 2 }));
+    wheel.ProcessTimers(START_TIME + DEFAULT_INTERVAL_MS);
+    EXPECT_EQ(fired, std::vector<int32_t>({ 2, 1, 3 }));
+    EXPECT_FALSE(wheel.IsExist(timer1));
+    EXPECT_EQ(wheel.GetTimerCount(), 0);
+    EXPECT_EQ(wheel.GetNextExpireTime(), -1);
+}
+
+/**
+ * @tc.name: TimerWheelTest002
+ * @tc.desc: A repeating timer fires the given number of times without drifting.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerWheelTest, TimerWheelTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TimerWheel wheel;
+    std::vector<int64_t> fired;
+    int64_t nowTime = START_TIME;
+    int32_t timerId = wheel.AddTimer(nowTime, DEFAULT_INTERVAL_MS, REPEAT_THREE_TIMES, [&fired, &nowTime] {
+        fired.push_back(nowTime);
+    });
+    for (nowTime = START_TIME; nowTime <= START_TIME + 10 * DEFAULT_INTERVAL_MS; nowTime += 7) {
+        wheel.ProcessTimers(nowTime);
+    }
+    ASSERT_EQ(fired.size(), REPEAT_THREE_TIMES);
+    for (size_t index = 0; index < fired.size(); ++index) {
+        int64_t expireTime = START_TIME + DEFAULT_INTERVAL_MS * static_cast<int64_t>(index + 1);
+        EXPECT_GE(fired[index], expireTime);
+        EXPECT_LT(fired[index], expireTime + 7);
+    }
+    EXPECT_FALSE(wheel.IsExist(timerId));
+}
+
+/**
+ * @tc.name: TimerWheelTest003
+ * @tc.desc: Remove and reset act on live timers only, and ids of removed timers are not reused as is.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerWheelTest, TimerWheelTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TimerWheel wheel;
+    int32_t count = 0;
+    int32_t timerId = wheel.AddTimer(START_TIME, DEFAULT_INTERVAL_MS, REPEAT_ONCE, [&count] { ++count; });
+    EXPECT_TRUE(wheel.IsExist(timerId));
+    EXPECT_EQ(wheel.ResetTimer(START_TIME + SHORT_INTERVAL_MS, timerId), RET_OK);
+    wheel.ProcessTimers(START_TIME + DEFAULT_INTERVAL_MS);
+    EXPECT_EQ(count, 0);
+    wheel.ProcessTimers(START_TIME + SHORT_INTERVAL_MS + DEFAULT_INTERVAL_MS);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(wheel.RemoveTimer(timerId), RET_ERR);
+    EXPECT_EQ(wheel.ResetTimer(START_TIME, timerId), RET_ERR);
+
+    int32_t newTimerId = wheel.AddTimer(START_TIME, DEFAULT_INTERVAL_MS, REPEAT_ONCE, [&count] { ++count; });
+    EXPECT_NE(newTimerId, timerId);
+    EXPECT_FALSE(wheel.IsExist(timerId));
+    EXPECT_EQ(wheel.RemoveTimer(newTimerId), RET_OK);
+    EXPECT_EQ(wheel.RemoveTimer(newTimerId), RET_ERR);
+    EXPECT_EQ(wheel.GetTimerCount(), 0);
+    EXPECT_EQ(wheel.AddTimer(START_TIME, DEFAULT_INTERVAL_MS, REPEAT_ONCE, nullptr), -1);
+}
+
+/**
+ * @tc.name: TimerWheelTest004
+ * @tc.desc: A long timer moves down the levels and still fires on its exact tick.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerWheelTest, TimerWheelTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TimerWheel wheel;
+    int32_t count = 0;
+    wheel.AddTimer(START_TIME, LONG_INTERVAL_MS, REPEAT_ONCE, [&count] { ++count; });
+    int64_t expireTime = START_TIME + LONG_INTERVAL_MS;
+    int32_t nWakeups = 0;
+    for (int64_t nextTime = wheel.GetNextExpireTime(); (nextTime >= 0) && (nextTime < expireTime);
+        nextTime = wheel.GetNextExpireTime()) {
+        wheel.ProcessTimers(nextTime);
+        ++nWakeups;
+        EXPECT_EQ(count, 0);
+    }
+    EXPECT_LE(nWakeups, 4);
+    EXPECT_EQ(wheel.GetNextExpireTime(), expireTime);
+    wheel.ProcessTimers(expireTime - 1);
+    EXPECT_EQ(count, 0);
+    wheel.ProcessTimers(expireTime);
+    EXPECT_EQ(count, 1);
+}
+
+/**
+ * @tc.name: TimerWheelTest005
+ * @tc.desc: Thousands of timers each fire once, on the first tick at or after their expiry.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerWheelTest, TimerWheelTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TimerWheel wheel;
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int32_t> intervals(SHORT_INTERVAL_MS, LONG_INTERVAL_MS / 10);
+    std::uniform_int_distribution<int32_t> steps(1, 500);
+    std::vector<int64_t> expireTimes(MANY_TIMERS);
+    std::vector<int64_t> firedTimes(MANY_TIMERS, -1);
+    std::vector<int64_t> previousTimes(MANY_TIMERS, -1);
+    int64_t nowTime = START_TIME;
+    int64_t lastTime = START_TIME;
+
+    for (size_t index = 0; index < MANY_TIMERS; ++index) {
+        int32_t interval = intervals(rng);
+        expireTimes[index] = nowTime + interval;
+        int32_t timerId = wheel.AddTimer(nowTime, interval, REPEAT_ONCE, [&, index] {
+            firedTimes[index] = nowTime;
+            previousTimes[index] = lastTime;
+        });
+        ASSERT_GE(timerId, 0);
+    }
+    while (wheel.GetTimerCount() > 0) {
+        lastTime = nowTime;
+        nowTime += steps(rng);
+        wheel.ProcessTimers(nowTime);
+    }
+    for (size_t index = 0; index < MANY_TIMERS; ++index) {
+        EXPECT_GE(firedTimes[index], expireTimes[index]);
+        EXPECT_LT(previousTimes[index], expireTimes[index]);
+    }
+}
+
+/**
+ * @tc.name: TimerWheelTest006
+ * @tc.desc: Callbacks may remove due timers and add new ones while timers are processed.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerWheelTest, TimerWheelTest006, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TimerWheel wheel;
+    std::vector<int32_t> fired;
+    int32_t timer2 = -1;
+    int32_t timer1 = wheel.AddTimer(START_TIME, DEFAULT_INTERVAL_MS, REPEAT_FOREVER, [&] {
+        fired.push_back(1);
+        wheel.RemoveTimer(timer2);
+        wheel.RemoveTimer(timer1);
+        wheel.AddTimer(START_TIME + DEFAULT_INTERVAL_MS, SHORT_INTERVAL_MS, REPEAT_ONCE, [&fired] {
+            fired.push_back(3);
+        });
+    });
+    timer2 = wheel.AddTimer(START_TIME, DEFAULT_INTERVAL_MS, REPEAT_ONCE, [&fired] { fired.push_back(2); });
+    wheel.ProcessTimers(START_TIME + DEFAULT_INTERVAL_MS + SHORT_INTERVAL_MS);
+    EXPECT_EQ(fired, std::vector<int32_t>({ 1, 3 }));
+    EXPECT_EQ(wheel.GetTimerCount(), 0);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
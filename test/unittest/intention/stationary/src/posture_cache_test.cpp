@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "fi_log.h"
+#include "posture_cache.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PostureCacheTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int64_t STALE_NS { 20000000 };
+constexpr int32_t IDLE_GRACE_MS { 50 };
+constexpr int32_t WAIT_TIMEOUT_MS { 200 };
+constexpr int32_t SHORT_TIMEOUT_MS { 10 };
+constexpr int32_t SAMPLE_INTERVAL_MS { 2 };
+constexpr int32_t MAX_N_POLLS { 200 };
+constexpr float SAMPLE_W { 0.5F };
+} // namespace
+
+// Stands in for the rotation-vector sensor: once started it reports a sample
+// every SAMPLE_INTERVAL_MS until stopped.
+class FakePostureSensor {
+public:
+    ~FakePostureSensor()
+    {
+        Stop();
+    }
+
+    int32_t Start()
+    {
+        ++nStarts_;
+        if (failStart_) {
+            return RET_ERR;
+        }
+        running_ = true;
+        worker_ = std::thread([this] {
+            while (running_) {
+                if (reporting_ && (cache_ != nullptr)) {
+                    PostureCache::Sample sample;
+                    sample.w = SAMPLE_W;
+                    cache_->Update(sample);
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(SAMPLE_INTERVAL_MS));
+            }
+        });
+        return RET_OK;
+    }
+
+    void Stop()
+    {
+        if (acquireOnStop_.exchange(false) && (cache_ != nullptr)) {
+            // Takes the cache lock from another thread while the sensor is being stopped.
+            std::thread([this] { acquired_ = (cache_->Acquire() == RET_OK); }).join();
+        }
+        running_ = false;
+        if (worker_.joinable()) {
+            worker_.join();
+            ++nStops_;
+        }
+    }
+
+    PostureCache *cache_ { nullptr };
+    std::atomic<bool> failStart_ { false };
+    std::atomic<bool> reporting_ { true };
+    std::atomic<bool> acquireOnStop_ { false };
+    std::atomic<bool> acquired_ { false };
+    std::atomic<bool> running_ { false };
+    std::atomic<int32_t> nStarts_ { 0 };
+    std::atomic<int32_t> nStops_ { 0 };
+    std::thread worker_;
+};
+
+class PostureCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp();
+    void TearDown();
+
+    FakePostureSensor sensor_;
+    std::unique_ptr<PostureCache> cache_;
+};
+
+void PostureCacheTest::SetUp()
+{
+    PostureCache::Options options;
+    options.staleNs = STALE_NS;
+    options.idleGraceMs = IDLE_GRACE_MS;
+    cache_ = std::make_unique<PostureCache>(
+        [this] { return sensor_.Start(); }, [this] { sensor_.Stop(); }, options);
+    sensor_.cache_ = cache_.get();
+}
+
+void PostureCacheTest::TearDown()
+{
+    cache_.reset();
+    sensor_.cache_ = nullptr;
+}
+
+/**
+ * @tc.name: PostureCacheTest001
+ * @tc.desc: Test GetLatest, the first call starts the sensor and waits for a sample
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PostureCacheTest, PostureCacheTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PostureCache::Sample sample;
+    EXPECT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    EXPECT_FLOAT_EQ(sample.w, SAMPLE_W);
+    EXPECT_TRUE(cache_->IsActive());
+    EXPECT_EQ(sensor_.nStarts_, 1);
+}
+
+/**
+ * @tc.name: PostureCacheTest002
+ * @tc.desc: Test GetLatest, repeated calls are served from the cache without restarting the sensor
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PostureCacheTest, PostureCacheTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PostureCache::Sample sample;
+    ASSERT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    for (int32_t i = 0; i < MAX_N_POLLS; ++i) {
+        EXPECT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    }
+    EXPECT_EQ(sensor_.nStarts_, 1);
+    EXPECT_EQ(sensor_.nStops_, 0);
+}
+
+/**
+ * @tc.name: PostureCacheTest003
+ * @tc.desc: Test GetLatest, a stale sample is only returned after waiting for a fresh one
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PostureCacheTest, PostureCacheTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PostureCache::Sample sample;
+    ASSERT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    sensor_.reporting_ = false;
+    std::this_thread::sleep_for(std::chrono::nanoseconds(STALE_NS * 2));
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(cache_->GetLatest(sample, SHORT_TIMEOUT_MS), RET_OK);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(SHORT_TIMEOUT_MS));
+    EXPECT_FLOAT_EQ(sample.w, SAMPLE_W);
+}
+
+/**
+ * @tc.name: PostureCacheTest004
+ * @tc.desc: Test idle shutdown, the sensor stops after the grace period and restarts on demand
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PostureCacheTest, PostureCacheTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PostureCache::Sample sample;
+    ASSERT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    for (int32_t i = 0; (i < MAX_N_POLLS) && cache_->IsActive(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(SAMPLE_INTERVAL_MS));
+    }
+    EXPECT_FALSE(cache_->IsActive());
+    EXPECT_EQ(sensor_.nStops_, 1);
+
+    EXPECT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    EXPECT_EQ(sensor_.nStarts_, 2);
+}
+
+/**
+ * @tc.name: PostureCacheTest005
+ * @tc.desc: Test Acquire, the sensor stays on while a user holds it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PostureCacheTest, PostureCacheTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ASSERT_EQ(cache_->Acquire(), RET_OK);
+    ASSERT_EQ(cache_->Acquire(), RET_OK);
+    EXPECT_EQ(sensor_.nStarts_, 1);
+    cache_->Release();
+    std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_GRACE_MS * 2));
+    EXPECT_TRUE(cache_->IsActive());
+    cache_->Release();
+}
+
+/**
+ * @tc.name: PostureCacheTest006
+ * @tc.desc: Test GetLatest, errors are reported when the sensor fails to start or never reports
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PostureCacheTest, PostureCacheTest006, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PostureCache::Sample sample;
+    sensor_.failStart_ = true;
+    EXPECT_EQ(cache_->GetLatest(sample, SHORT_TIMEOUT_MS), RET_ERR);
+    EXPECT_FALSE(cache_->IsActive());
+
+    sensor_.failStart_ = false;
+    sensor_.reporting_ = false;
+    EXPECT_EQ(cache_->GetLatest(sample, SHORT_TIMEOUT_MS), RET_ERR);
+    EXPECT_TRUE(cache_->IsActive());
+}
+
+/**
+ * @tc.name: PostureCacheTest007
+ * @tc.desc: Test idle shutdown, a user acquiring while the sensor is being stopped gets it restarted
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PostureCacheTest, PostureCacheTest007, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PostureCache::Sample sample;
+    sensor_.acquireOnStop_ = true;
+    ASSERT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    for (int32_t i = 0; (i < MAX_N_POLLS) && (sensor_.nStarts_ < 2); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(SAMPLE_INTERVAL_MS));
+    }
+    EXPECT_TRUE(sensor_.acquired_);
+    EXPECT_EQ(sensor_.nStops_, 1);
+    EXPECT_EQ(sensor_.nStarts_, 2);
+    EXPECT_TRUE(cache_->IsActive());
+    EXPECT_EQ(cache_->GetLatest(sample, WAIT_TIMEOUT_MS), RET_OK);
+    cache_->Release();
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
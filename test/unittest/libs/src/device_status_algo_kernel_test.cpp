@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "algo_kernel.h"
+#include "devicestatus_data_define.h"
+#include "devicestatus_define.h"
+
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+#include "algo_absolute_still.h"
+#include "algo_horizontal.h"
+#include "algo_vertical.h"
+#endif // DEVICE_STATUS_SENSOR_ENABLE
+
+#undef LOG_TAG
+#define LOG_TAG "DeviceStatusAlgoKernelTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr uint32_t TRACE_SEED { 20250101 };
+constexpr size_t SAMPLES_PER_POSTURE { 40 };
+constexpr size_t N_POSTURES { 250 };
+constexpr size_t MAX_WINDOW_SIZE { 13 };
+constexpr float GRAVITY { 9.80665F };
+constexpr float NOISE { 0.15F };
+constexpr float SHAKE { 6.0F };
+constexpr double DEGREE_TO_RADIAN { PI / ANGLE_180_DEGREE };
+const std::vector<double> BOUNDARY_ANGLES { 0.0, 5.0, 80.0, 110.0, 160.0, 180.0 };
+
+// Samples in the axes of the sensor.
+struct AccelTrace {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+
+    void Append(float sampleX, float sampleY, float sampleZ)
+    {
+        x.push_back(sampleX);
+        y.push_back(sampleY);
+        z.push_back(sampleZ);
+    }
+
+    AccelWindow Window(size_t begin, size_t count) const
+    {
+        return AccelWindow { x.data() + begin, y.data() + begin, z.data() + begin, count };
+    }
+};
+
+// A device put down, picked up, turned and shaken in turn, at 10 Hz.
+AccelTrace MakeTrace()
+{
+    std::mt19937 engine(TRACE_SEED);
+    std::uniform_real_distribution<float> angle(-PI, PI);
+    std::normal_distribution<float> noise(0.0F, NOISE);
+    std::uniform_int_distribution<int32_t> posture(0, 5);
+    AccelTrace trace;
+    for (size_t index = 0; index < N_POSTURES; ++index) {
+        int32_t kind = posture(engine);
+        float pitch = angle(engine);
+        float roll = angle(engine);
+        if (kind == 0) {
+            pitch = 0.0F;
+            roll = 0.0F;
+        } else if (kind == 1) {
+            pitch = PI / 2;
+        } else if (kind == 2) {
+            pitch = BOUNDARY_ANGLES[engine() % BOUNDARY_ANGLES.size()] * DEGREE_TO_RADIAN;
+        }
+        float baseX = GRAVITY * std::sin(roll) * std::cos(pitch);
+        float baseY = GRAVITY * std::sin(pitch);
+        float baseZ = GRAVITY * std::cos(roll) * std::cos(pitch);
+        float scale = ((kind == 5) ? SHAKE : 1.0F);
+        for (size_t sample = 0; sample < SAMPLES_PER_POSTURE; ++sample) {
+            trace.Append(baseX + scale * noise(engine), baseY + scale * noise(engine), baseZ + scale * noise(engine));
+        }
+    }
+    return trace;
+}
+
+// Samples that sit on, or next to, the edges of the scalar judgements.
+AccelTrace MakeEdgeCases()
+{
+    AccelTrace trace;
+    const std::vector<float> magnitudes { RESULTANT_ACC_LOW_THRHD, RESULTANT_ACC_UP_THRHD };
+    for (float magnitude : magnitudes) {
+        for (float value : { std::nextafter(magnitude, 0.0F), magnitude, std::nextafter(magnitude, GRAVITY * 2) }) {
+            trace.Append(0.0F, 0.0F, value);
+            trace.Append(value / std::sqrt(3.0F), value / std::sqrt(3.0F), value / std::sqrt(3.0F));
+        }
+    }
+    for (double degree : BOUNDARY_ANGLES) {
+        double radian = degree * DEGREE_TO_RADIAN;
+        for (double delta : { -1e-6, 0.0, 1e-6 }) {
+            float sampleY = GRAVITY * std::sin(radian + delta);
+            float sampleZ = GRAVITY * std::cos(radian + delta);
+            trace.Append(sampleY, 0.0F, -sampleZ);
+            trace.Append(sampleY, sampleY, -sampleZ);
+            trace.Append(0.0F, sampleY, -sampleZ);
+        }
+    }
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float overRange = std::nextafter(static_cast<float>(ACC_VALID_THRHD), GRAVITY * GRAVITY * 2);
+    trace.Append(0.0F, 0.0F, 0.0F);
+    trace.Append(-0.0F, 0.0F, -0.0F);
+    trace.Append(1e-7F, 1e-7F, -1e-7F);
+    trace.Append(GRAVITY, 1e-7F, 1e-7F);
+    trace.Append(nan, 0.0F, GRAVITY);
+    trace.Append(0.0F, nan, GRAVITY);
+    trace.Append(0.0F, 0.0F, nan);
+    trace.Append(overRange, 0.0F, 0.0F);
+    trace.Append(0.0F, -overRange, 0.0F);
+    trace.Append(static_cast<float>(ACC_VALID_THRHD), 0.0F, 0.0F);
+    return trace;
+}
+
+using WindowJudge = void (*)(const AccelWindow &window, SampleVerdict *verdicts);
+using SampleJudge = SampleVerdict (*)(float x, float y, float z);
+
+// Judges every sample of @trace with @sampleJudge, checking and swapping axes as AlgoBase::SetData() does.
+std::vector<SampleVerdict> JudgeEachSample(const AccelTrace &trace, SampleJudge sampleJudge)
+{
+    std::vector<SampleVerdict> verdicts;
+    for (size_t index = 0; index < trace.x.size(); ++index) {
+        if ((std::abs(trace.x[index]) > ACC_VALID_THRHD) || (std::abs(trace.y[index]) > ACC_VALID_THRHD) ||
+            (std::abs(trace.z[index]) > ACC_VALID_THRHD)) {
+            verdicts.push_back(VERDICT_SKIP);
+        } else {
+            verdicts.push_back(sampleJudge(trace.y[index], trace.x[index], -trace.z[index]));
+        }
+    }
+    return verdicts;
+}
+
+// Judges @trace in windows of every size from 1 to MAX_WINDOW_SIZE.
+std::vector<SampleVerdict> JudgeInWindows(const AccelTrace &trace, WindowJudge windowJudge)
+{
+    std::vector<SampleVerdict> verdicts(trace.x.size());
+    size_t windowSize = 1;
+    for (size_t begin = 0; begin < trace.x.size(); begin += windowSize) {
+        windowSize = (windowSize % MAX_WINDOW_SIZE) + 1;
+        size_t count = std::min(windowSize, trace.x.size() - begin);
+        windowJudge(trace.Window(begin, count), verdicts.data() + begin);
+    }
+    return verdicts;
+}
+
+void ExpectSameVerdicts(const AccelTrace &trace)
+{
+    EXPECT_EQ(JudgeInWindows(trace, &AlgoKernel::JudgeAbsoluteStill),
+        JudgeEachSample(trace, &AlgoKernel::JudgeAbsoluteStill));
+    EXPECT_EQ(JudgeInWindows(trace, &AlgoKernel::JudgeHorizontal),
+        JudgeEachSample(trace, &AlgoKernel::JudgeHorizontal));
+    EXPECT_EQ(JudgeInWindows(trace, &AlgoKernel::JudgeVertical),
+        JudgeEachSample(trace, &AlgoKernel::JudgeVertical));
+}
+
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+class ResultRecorder : public IMsdp::MsdpAlgoCallback {
+public:
+    void OnResult(const Data &data) override
+    {
+        results_.emplace_back(data.type, data.value);
+    }
+
+    std::vector<std::pair<Type, OnChangedValue>> results_;
+};
+
+// Feeds @trace to @single one sample at a time and to @batch in windows, and
+// checks that both report the same changes of state.
+void ExpectSameTransitions(const AccelTrace &trace, AlgoBase &single, AlgoBase &batch)
+{
+    auto singleResults = std::make_shared<ResultRecorder>();
+    auto batchResults = std::make_shared<ResultRecorder>();
+    single.RegisterCallback(singleResults);
+    batch.RegisterCallback(batchResults);
+    for (size_t index = 0; index < trace.x.size(); ++index) {
+        AccelData data { trace.x[index], trace.y[index], trace.z[index] };
+        single.StartAlgorithm(SENSOR_TYPE_ID_ACCELEROMETER, &data);
+    }
+    size_t windowSize = 1;
+    for (size_t begin = 0; begin < trace.x.size(); begin += windowSize) {
+        windowSize = (windowSize % MAX_WINDOW_SIZE) + 1;
+        batch.ProcessWindow(trace.Window(begin, std::min(windowSize, trace.x.size() - begin)));
+    }
+    EXPECT_FALSE(singleResults->results_.empty());
+    EXPECT_EQ(batchResults->results_, singleResults->results_);
+    EXPECT_EQ(batch.state_, single.state_);
+    EXPECT_EQ(batch.counter_, single.counter_);
+}
+#endif // DEVICE_STATUS_SENSOR_ENABLE
+} // namespace
+
+class DeviceStatusAlgoKernelTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: DeviceStatusAlgoKernelTest001
+ * @tc.desc: test window verdicts match per-sample verdicts on an accelerometer trace
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusAlgoKernelTest, DeviceStatusAlgoKernelTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ExpectSameVerdicts(MakeTrace());
+}
+
+/**
+ * @tc.name: DeviceStatusAlgoKernelTest002
+ * @tc.desc: test window verdicts match per-sample verdicts on samples at the thresholds
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusAlgoKernelTest, DeviceStatusAlgoKernelTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    AccelTrace trace = MakeEdgeCases();
+    ExpectSameVerdicts(trace);
+    std::vector<SampleVerdict> verdicts = JudgeEachSample(trace, &AlgoKernel::JudgeAbsoluteStill);
+    EXPECT_EQ(verdicts.back(), VERDICT_OUT);
+    EXPECT_EQ(verdicts[verdicts.size() - 2], VERDICT_SKIP);
+    EXPECT_EQ(verdicts[verdicts.size() - 3], VERDICT_SKIP);
+}
+
+/**
+ * @tc.name: DeviceStatusAlgoKernelTest003
+ * @tc.desc: test empty and null windows
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusAlgoKernelTest, DeviceStatusAlgoKernelTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    SampleVerdict verdict = VERDICT_IN;
+    AlgoKernel::JudgeAbsoluteStill(AccelWindow {}, &verdict);
+    EXPECT_EQ(verdict, VERDICT_IN);
+    AccelTrace trace = MakeEdgeCases();
+    AlgoKernel::JudgeVertical(trace.Window(0, 0), &verdict);
+    EXPECT_EQ(verdict, VERDICT_IN);
+    AlgoKernel::JudgeHorizontal(trace.Window(0, 1), nullptr);
+    EXPECT_EQ(AlgoKernel::JudgeVertical(GRAVITY, 0.0F, 0.0F), VERDICT_SKIP);
+}
+
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+/**
+ * @tc.name: DeviceStatusAlgoKernelTest004
+ * @tc.desc: test algorithms report the same changes of state in batches as sample by sample
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusAlgoKernelTest, DeviceStatusAlgoKernelTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    AccelTrace trace = MakeTrace();
+    AccelTrace edgeCases = MakeEdgeCases();
+    trace.x.insert(trace.x.end(), edgeCases.x.begin(), edgeCases.x.end());
+    trace.y.insert(trace.y.end(), edgeCases.y.begin(), edgeCases.y.end());
+    trace.z.insert(trace.z.end(), edgeCases.z.begin(), edgeCases.z.end());
+    AlgoAbsoluteStill singleStill;
+    AlgoAbsoluteStill batchStill;
+    ExpectSameTransitions(trace, singleStill, batchStill);
+    AlgoHorizontal singleHorizontal;
+    AlgoHorizontal batchHorizontal;
+    ExpectSameTransitions(trace, singleHorizontal, batchHorizontal);
+    AlgoVertical singleVertical;
+    AlgoVertical batchVertical;
+    ExpectSameTransitions(trace, singleVertical, batchVertical);
+}
+#endif // DEVICE_STATUS_SENSOR_ENABLE
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <cstdio>
+#include <thread>
 #include <gtest/gtest.h>
 
 #include "accesstoken_kit.h"
@@ -31,6 +33,27 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 using namespace testing::ext;
+namespace {
+constexpr int32_t N_SAMPLES { 32 };
+constexpr int32_t N_OVERFLOW_SAMPLES { 1000 };
+constexpr int32_t MAX_N_POLLS { 200 };
+constexpr int32_t POLL_INTERVAL_MS { 5 };
+constexpr int32_t BATCH_SUBSCRIBER_TYPE { 1001 };
+constexpr int32_t SLOW_SUBSCRIBER_TYPE { 1002 };
+constexpr int32_t SLOW_DISPATCH_MS { 100 };
+
+template<typename Predicate>
+bool WaitFor(Predicate pred)
+{
+    for (int32_t i = 0; i < MAX_N_POLLS; ++i) {
+        if (pred()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+    }
+    return pred();
+}
+} // namespace
 
 class DeviceStatusDatahubTest : public testing::Test {
 public:
@@ -414,6 +437,68 @@ HWTEST_F(DeviceStatusDatahubTest, DeviceStatusDatahubTest020, TestSize.Level1)
     ret = SENSOR_DATA_CB.UnregisterCallbackSensor(sensorTypeId);
     ASSERT_TRUE(ret);
 }
+
+/**
+ * @tc.name: DeviceStatusDatahubTest021
+ * @tc.desc: test batch subscribers receive every pushed sample with fewer wakeups than samples
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusDatahubTest, DeviceStatusDatahubTest021, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::atomic<int32_t> nSamples { 0 };
+    std::atomic<int32_t> nBatches { 0 };
+    bool ret = SENSOR_DATA_CB.SubscribeSensorBatch(BATCH_SUBSCRIBER_TYPE,
+        [&nSamples, &nBatches](int32_t sensorTypeId, AccelData* data, size_t count) {
+            nSamples += static_cast<int32_t>(count);
+            ++nBatches;
+        });
+    ASSERT_TRUE(ret);
+    uint64_t nWakeups = SENSOR_DATA_CB.GetWakeupCount();
+    AccelData data;
+    data.x = 1;
+    data.y = 2;
+    data.z = 9;
+    for (int32_t i = 0; i < N_SAMPLES; ++i) {
+        SENSOR_DATA_CB.PushData(SENSOR_TYPE_ID_ACCELEROMETER, reinterpret_cast<uint8_t*>(&data));
+    }
+    EXPECT_TRUE(WaitFor([&nSamples] { return (nSamples >= N_SAMPLES); }));
+    EXPECT_LE(nBatches, N_SAMPLES);
+    EXPECT_LE(SENSOR_DATA_CB.GetWakeupCount() - nWakeups, static_cast<uint64_t>(N_SAMPLES));
+    ret = SENSOR_DATA_CB.UnsubscribeSensorEvent(BATCH_SUBSCRIBER_TYPE, nullptr);
+    ASSERT_TRUE(ret);
+}
+
+/**
+ * @tc.name: DeviceStatusDatahubTest022
+ * @tc.desc: test samples are dropped instead of queued without bound when the algorithm thread lags
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusDatahubTest, DeviceStatusDatahubTest022, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::atomic<int32_t> nCalls { 0 };
+    bool ret = SENSOR_DATA_CB.SubscribeSensorBatch(SLOW_SUBSCRIBER_TYPE,
+        [&nCalls](int32_t sensorTypeId, AccelData* data, size_t count) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(SLOW_DISPATCH_MS));
+            ++nCalls;
+        });
+    ASSERT_TRUE(ret);
+    uint64_t nDropped = SENSOR_DATA_CB.GetDroppedCount();
+    AccelData data;
+    data.x = 1;
+    data.y = 2;
+    data.z = 9;
+    for (int32_t i = 0; i < N_OVERFLOW_SAMPLES; ++i) {
+        SENSOR_DATA_CB.PushData(SENSOR_TYPE_ID_ACCELEROMETER, reinterpret_cast<uint8_t*>(&data));
+    }
+    EXPECT_GT(SENSOR_DATA_CB.GetDroppedCount(), nDropped);
+    ret = SENSOR_DATA_CB.UnsubscribeSensorEvent(SLOW_SUBSCRIBER_TYPE, nullptr);
+    ASSERT_TRUE(ret);
+    int32_t nCallsAfterUnsubscribe = nCalls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLOW_DISPATCH_MS * 2));
+    EXPECT_EQ(nCalls, nCallsAfterUnsubscribe);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
@@ -15,7 +15,9 @@
 
 #include <cstdio>
 #include <dlfcn.h>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <sstream>
 
 #include <sys/epoll.h>
 #include <sys/timerfd.h>
@@ -50,6 +52,26 @@ const std::string DEVICESTATUS_MOCK_LIB_PATH { "/system/lib64/libdevicestatus_mo
 #else
 const std::string DEVICESTATUS_MOCK_LIB_PATH { "/system/lib/libdevicestatus_mock.z.so" };
 #endif
+const std::string MSDP_DATA_PATH { "/data/msdp/device_status_data.json" };
+
+bool WriteMockData(const std::string &content)
+{
+    std::ofstream file(MSDP_DATA_PATH, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << content;
+    file.close();
+    return !file.fail();
+}
+
+std::string ReadMockData()
+{
+    std::ifstream file(MSDP_DATA_PATH);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
 } // namespace
 
 class DeviceStatusMsdpMocKTest : public testing::Test {
@@ -583,6 +605,64 @@ HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest030, TestSize.Level1)
     deviceStatusMsdpMock.callbacks_.clear();
     EXPECT_TRUE(deviceStatusMsdpMock.alive_);
 }
+
+/**
+ * @tc.name: DeviceStatusMsdpMocKTest031
+ * @tc.desc: test each type cycles through its own mock values
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest031, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusDataParse dataParse;
+    const std::string fileData { R"({"still":[1,2,"x"],"LID_OPEN":[2]})" };
+    Type still = Type::TYPE_STILL;
+    Type lidOpen = Type::TYPE_LID_OPEN;
+    Data data;
+    EXPECT_TRUE(dataParse.DeviceStatusDataInit(fileData, true, still, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_ENTER);
+    EXPECT_TRUE(dataParse.DeviceStatusDataInit(fileData, true, lidOpen, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_EXIT);
+    EXPECT_TRUE(dataParse.DeviceStatusDataInit(fileData, true, still, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_EXIT);
+    EXPECT_FALSE(dataParse.DeviceStatusDataInit(fileData, true, still, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_INVALID);
+    EXPECT_TRUE(dataParse.DeviceStatusDataInit(fileData, true, still, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_ENTER);
+
+    EXPECT_TRUE(dataParse.DisableCount(still));
+    EXPECT_TRUE(dataParse.DeviceStatusDataInit(fileData, true, still, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_ENTER);
+    Type absoluteStill = Type::TYPE_ABSOLUTE_STILL;
+    EXPECT_FALSE(dataParse.DeviceStatusDataInit(fileData, true, absoluteStill, data));
+    EXPECT_FALSE(dataParse.DeviceStatusDataInit("[1,2]", true, still, data));
+    EXPECT_FALSE(dataParse.DisableCount(Type::TYPE_INVALID));
+}
+
+/**
+ * @tc.name: DeviceStatusMsdpMocKTest032
+ * @tc.desc: test mock data is parsed again only after the file changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest032, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::string original = ReadMockData();
+    ASSERT_TRUE(WriteMockData(R"({"still":[1,2]})"));
+    DeviceStatusDataParse dataParse;
+    Data data;
+    EXPECT_TRUE(dataParse.ParseDeviceStatusData(Type::TYPE_STILL, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_ENTER);
+    auto mockData = dataParse.mockData_.get();
+    EXPECT_TRUE(dataParse.ParseDeviceStatusData(Type::TYPE_STILL, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_EXIT);
+    EXPECT_EQ(dataParse.mockData_.get(), mockData);
+
+    ASSERT_TRUE(WriteMockData(R"({"still":[2,2,2]})"));
+    EXPECT_TRUE(dataParse.ParseDeviceStatusData(Type::TYPE_STILL, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_EXIT);
+    EXPECT_TRUE(WriteMockData(original));
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
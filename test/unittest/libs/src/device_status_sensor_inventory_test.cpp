@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef DEVICE_STATUS_SENSOR_ENABLE
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_algorithm_manager.h"
+#include "devicestatus_define.h"
+#include "sensor_data_callback.h"
+#include "sensor_inventory.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DeviceStatusSensorInventoryTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+// Stands in for the sensor service and records every round trip to it.
+class FakeSensorProvider final : public ISensorProvider {
+public:
+    bool GetSensorTypeIds(std::vector<int32_t> &sensorTypeIds) override
+    {
+        ++nQueries;
+        sensorTypeIds.assign(sensors.begin(), sensors.end());
+        return true;
+    }
+
+    bool ActivateSensor(int32_t sensorTypeId) override
+    {
+        ++nActivations;
+        if (sensors.find(sensorTypeId) == sensors.end()) {
+            return false;
+        }
+        active.insert(sensorTypeId);
+        return true;
+    }
+
+    bool DeactivateSensor(int32_t sensorTypeId) override
+    {
+        ++nDeactivations;
+        return (active.erase(sensorTypeId) > 0);
+    }
+
+    std::set<int32_t> sensors { SENSOR_TYPE_ID_ACCELEROMETER };
+    std::set<int32_t> active;
+    int32_t nQueries { 0 };
+    int32_t nActivations { 0 };
+    int32_t nDeactivations { 0 };
+};
+
+bool IsSubscribed(Type type)
+{
+    auto subscribers = SENSOR_DATA_CB.subscribers_;
+    return (subscribers->find(type) != subscribers->end());
+}
+} // namespace
+
+class DeviceStatusSensorInventoryTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+
+protected:
+    std::shared_ptr<FakeSensorProvider> provider_ { nullptr };
+    std::shared_ptr<AlgoMgr> algoMgr_ { nullptr };
+};
+
+void DeviceStatusSensorInventoryTest::SetUp()
+{
+    provider_ = std::make_shared<FakeSensorProvider>();
+    algoMgr_ = std::make_shared<AlgoMgr>(provider_);
+}
+
+void DeviceStatusSensorInventoryTest::TearDown()
+{
+    algoMgr_ = nullptr;
+    provider_ = nullptr;
+}
+
+/**
+ * @tc.name: DeviceStatusSensorInventoryTest001
+ * @tc.desc: test stationary types share one inventory query and one activation of the accelerometer
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusSensorInventoryTest, DeviceStatusSensorInventoryTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ASSERT_EQ(algoMgr_->Enable(Type::TYPE_ABSOLUTE_STILL), RET_OK);
+    ASSERT_EQ(algoMgr_->Enable(Type::TYPE_HORIZONTAL_POSITION), RET_OK);
+    ASSERT_EQ(algoMgr_->Enable(Type::TYPE_VERTICAL_POSITION), RET_OK);
+    ASSERT_EQ(algoMgr_->Enable(Type::TYPE_HORIZONTAL_POSITION), RET_OK);
+    EXPECT_EQ(provider_->nQueries, 1);
+    EXPECT_EQ(provider_->nActivations, 1);
+    EXPECT_TRUE(IsSubscribed(Type::TYPE_ABSOLUTE_STILL));
+    EXPECT_TRUE(IsSubscribed(Type::TYPE_HORIZONTAL_POSITION));
+    EXPECT_TRUE(IsSubscribed(Type::TYPE_VERTICAL_POSITION));
+
+    EXPECT_EQ(algoMgr_->Disable(Type::TYPE_ABSOLUTE_STILL), RET_OK);
+    EXPECT_EQ(algoMgr_->Disable(Type::TYPE_HORIZONTAL_POSITION), RET_ERR);
+    EXPECT_EQ(algoMgr_->Disable(Type::TYPE_HORIZONTAL_POSITION), RET_OK);
+    EXPECT_FALSE(IsSubscribed(Type::TYPE_ABSOLUTE_STILL));
+    EXPECT_FALSE(IsSubscribed(Type::TYPE_HORIZONTAL_POSITION));
+    EXPECT_EQ(provider_->nDeactivations, 0);
+    EXPECT_EQ(provider_->active.count(SENSOR_TYPE_ID_ACCELEROMETER), 1);
+
+    EXPECT_EQ(algoMgr_->Disable(Type::TYPE_VERTICAL_POSITION), RET_OK);
+    EXPECT_FALSE(IsSubscribed(Type::TYPE_VERTICAL_POSITION));
+    EXPECT_EQ(provider_->nDeactivations, 1);
+    EXPECT_TRUE(provider_->active.empty());
+}
+
+/**
+ * @tc.name: DeviceStatusSensorInventoryTest002
+ * @tc.desc: test the inventory is queried again only after a sensor is plugged in or out
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusSensorInventoryTest, DeviceStatusSensorInventoryTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EXPECT_TRUE(algoMgr_->CheckSensorTypeId(SENSOR_TYPE_ID_ACCELEROMETER));
+    EXPECT_FALSE(algoMgr_->CheckSensorTypeId(SENSOR_TYPE_ID_GYROSCOPE));
+    EXPECT_TRUE(algoMgr_->CheckSensorTypeId(SENSOR_TYPE_ID_ACCELEROMETER));
+    EXPECT_EQ(provider_->nQueries, 1);
+
+    provider_->sensors.clear();
+    EXPECT_TRUE(algoMgr_->CheckSensorTypeId(SENSOR_TYPE_ID_ACCELEROMETER));
+    algoMgr_->OnSensorPlug();
+    EXPECT_FALSE(algoMgr_->CheckSensorTypeId(SENSOR_TYPE_ID_ACCELEROMETER));
+    EXPECT_EQ(provider_->nQueries, 2);
+    EXPECT_EQ(algoMgr_->Enable(Type::TYPE_ABSOLUTE_STILL), RET_ERR);
+    EXPECT_EQ(provider_->nActivations, 0);
+
+    provider_->sensors.insert(SENSOR_TYPE_ID_ACCELEROMETER);
+    algoMgr_->OnSensorPlug();
+    ASSERT_EQ(algoMgr_->Enable(Type::TYPE_ABSOLUTE_STILL), RET_OK);
+    EXPECT_EQ(provider_->nQueries, 3);
+    EXPECT_EQ(provider_->nActivations, 1);
+    EXPECT_EQ(algoMgr_->Disable(Type::TYPE_ABSOLUTE_STILL), RET_OK);
+    EXPECT_EQ(provider_->nDeactivations, 1);
+}
+
+/**
+ * @tc.name: DeviceStatusSensorInventoryTest003
+ * @tc.desc: test a failed activation is not counted and reloads the inventory
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusSensorInventoryTest, DeviceStatusSensorInventoryTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    SensorInventory inventory(provider_);
+    EXPECT_TRUE(inventory.HasSensor(SENSOR_TYPE_ID_ACCELEROMETER));
+    provider_->sensors.clear();
+    EXPECT_FALSE(inventory.Acquire(SENSOR_TYPE_ID_ACCELEROMETER));
+    EXPECT_FALSE(inventory.Release(SENSOR_TYPE_ID_ACCELEROMETER));
+    EXPECT_FALSE(inventory.HasSensor(SENSOR_TYPE_ID_ACCELEROMETER));
+    EXPECT_EQ(provider_->nQueries, 2);
+    EXPECT_EQ(provider_->nDeactivations, 0);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DEVICE_STATUS_SENSOR_ENABLE
\ No newline at end of file
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DEVICESTATUS_NOTIFIER_TEST_H
+#define DEVICESTATUS_NOTIFIER_TEST_H
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_callback_stub.h"
+#include "devicestatus_notifier.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+class DeviceStatusNotifierTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    // Records the changes it receives; while the gate is closed, every
+    // change blocks the delivering thread.
+    class TestCallback : public DeviceStatusCallbackStub {
+    public:
+        explicit TestCallback(bool gateOpen = true) : gateOpen_(gateOpen) {}
+        void OnDeviceStatusChanged(const Data &value) override;
+        void OpenGate();
+        bool WaitFor(size_t nChanges);
+        std::vector<Data> GetChanges();
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool gateOpen_ { true };
+        std::vector<Data> changes_;
+    };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DEVICESTATUS_NOTIFIER_TEST_H
\ No newline at end of file
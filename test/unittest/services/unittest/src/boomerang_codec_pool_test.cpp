@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "boomerang_codec_pool_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "BoomerangCodecPoolTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t PIXEL_MAP_SIZE { 4 };
+constexpr int32_t MAX_WAIT_TIMES { 500 };
+constexpr std::chrono::milliseconds WAIT_INTERVAL { 2 };
+const std::string METADATA { "boomerang metadata" };
+
+// The codec is a pair of plain function pointers, so the fake keeps its
+// state in globals. Calls block while the gate is closed.
+class FakeCodec {
+public:
+    static void Reset(bool gateOpen)
+    {
+        std::lock_guard guard(mutex_);
+        gateOpen_ = gateOpen;
+        nRunning_ = 0;
+        nCalls_ = 0;
+    }
+
+    static void OpenGate()
+    {
+        std::lock_guard guard(mutex_);
+        gateOpen_ = true;
+        cv_.notify_all();
+    }
+
+    static void Encode(std::shared_ptr<Media::PixelMap> &pixelMap, const std::string &content,
+        std::shared_ptr<Media::PixelMap> &resultPixelMap)
+    {
+        Pass();
+        resultPixelMap = pixelMap;
+    }
+
+    static void Decode(std::shared_ptr<Media::PixelMap> &pixelMap, std::string &content)
+    {
+        Pass();
+        content = METADATA;
+    }
+
+    static int32_t GetRunning()
+    {
+        std::lock_guard guard(mutex_);
+        return nRunning_;
+    }
+
+    static int32_t GetCalls()
+    {
+        std::lock_guard guard(mutex_);
+        return nCalls_;
+    }
+
+private:
+    static void Pass()
+    {
+        std::unique_lock lock(mutex_);
+        ++nRunning_;
+        ++nCalls_;
+        cv_.wait(lock, [] { return gateOpen_; });
+        --nRunning_;
+    }
+
+    static inline std::mutex mutex_;
+    static inline std::condition_variable cv_;
+    static inline bool gateOpen_ { true };
+    static inline int32_t nRunning_ { 0 };
+    static inline int32_t nCalls_ { 0 };
+};
+
+const BoomerangCodec FAKE_CODEC { &FakeCodec::Encode, &FakeCodec::Decode };
+
+template<typename Predicate>
+bool WaitFor(Predicate predicate)
+{
+    for (int32_t times = 0; times < MAX_WAIT_TIMES; ++times) {
+        if (predicate()) {
+            return true;
+        }
+        std::this_thread::sleep_for(WAIT_INTERVAL);
+    }
+    return predicate();
+}
+} // namespace
+
+void BoomerangCodecPoolTest::SetUpTestCase() {}
+
+void BoomerangCodecPoolTest::TearDownTestCase() {}
+
+void BoomerangCodecPoolTest::SetUp()
+{
+    FakeCodec::Reset(true);
+}
+
+void BoomerangCodecPoolTest::TearDown()
+{
+    FakeCodec::OpenGate();
+}
+
+std::shared_ptr<Media::PixelMap> BoomerangCodecPoolTest::CreatePixelMap()
+{
+    Media::InitializationOptions options;
+    options.size = { PIXEL_MAP_SIZE, PIXEL_MAP_SIZE };
+    options.pixelFormat = Media::PixelFormat::BGRA_8888;
+    return Media::PixelMap::Create(options);
+}
+
+/**
+ * @tc.name: BoomerangCodecPoolTest001
+ * @tc.desc: Results of encoding and decoding are handed to the completions
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BoomerangCodecPoolTest, BoomerangCodecPoolTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    BoomerangCodecPool pool(FAKE_CODEC);
+    auto pixelMap = CreatePixelMap();
+    ASSERT_NE(pixelMap, nullptr);
+    std::atomic<bool> encoded { false };
+    std::atomic<bool> decoded { false };
+    EXPECT_EQ(pool.SubmitEncode(pixelMap, METADATA, [&](std::shared_ptr<Media::PixelMap> resultPixelMap) {
+        encoded = (resultPixelMap == pixelMap);
+    }), RET_OK);
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, [&](const std::string &metadata) {
+        decoded = (metadata == METADATA);
+    }), RET_OK);
+    EXPECT_TRUE(WaitFor([&] { return (encoded && decoded); }));
+    EXPECT_TRUE(WaitFor([&] { return (pool.GetMetrics().nCompleted == 2); }));
+    EXPECT_EQ(pool.SubmitEncode(nullptr, METADATA, nullptr), RET_ERR);
+}
+
+/**
+ * @tc.name: BoomerangCodecPoolTest002
+ * @tc.desc: Without an algorithm, encoding returns the original image and decoding returns no metadata
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BoomerangCodecPoolTest, BoomerangCodecPoolTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    BoomerangCodecPool pool(BoomerangCodec {});
+    auto pixelMap = CreatePixelMap();
+    ASSERT_NE(pixelMap, nullptr);
+    std::atomic<bool> encoded { false };
+    std::atomic<bool> decoded { false };
+    EXPECT_EQ(pool.SubmitEncode(pixelMap, METADATA, [&](std::shared_ptr<Media::PixelMap> resultPixelMap) {
+        encoded = (resultPixelMap == pixelMap);
+    }), RET_OK);
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, [&](const std::string &metadata) {
+        decoded = metadata.empty();
+    }), RET_OK);
+    EXPECT_TRUE(WaitFor([&] { return (encoded && decoded); }));
+    std::string metadata;
+    pool.Decode(pixelMap, metadata);
+    EXPECT_TRUE(metadata.empty());
+}
+
+/**
+ * @tc.name: BoomerangCodecPoolTest003
+ * @tc.desc: Jobs submitted while the queue is full are rejected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BoomerangCodecPoolTest, BoomerangCodecPoolTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeCodec::Reset(false);
+    BoomerangCodecPoolOptions options;
+    options.nWorkers = 1;
+    options.queueCapacity = 2;
+    BoomerangCodecPool pool(FAKE_CODEC, options);
+    auto pixelMap = CreatePixelMap();
+    ASSERT_NE(pixelMap, nullptr);
+    std::atomic<int32_t> nDone { 0 };
+    auto done = [&nDone](const std::string &metadata) {
+        ++nDone;
+    };
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_OK);
+    EXPECT_TRUE(WaitFor([] { return (FakeCodec::GetRunning() == 1); }));
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_OK);
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_OK);
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_ERR);
+    EXPECT_EQ(pool.GetMetrics().nRejected, 1);
+
+    FakeCodec::OpenGate();
+    EXPECT_TRUE(WaitFor([&nDone] { return (nDone == 3); }));
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_OK);
+    EXPECT_TRUE(WaitFor([&nDone] { return (nDone == 4); }));
+}
+
+/**
+ * @tc.name: BoomerangCodecPoolTest004
+ * @tc.desc: No more codec calls than allowed run at the same time
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BoomerangCodecPoolTest, BoomerangCodecPoolTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeCodec::Reset(false);
+    BoomerangCodecPoolOptions options;
+    options.nWorkers = 4;
+    options.maxConcurrentCalls = 2;
+    BoomerangCodecPool pool(FAKE_CODEC, options);
+    auto pixelMap = CreatePixelMap();
+    ASSERT_NE(pixelMap, nullptr);
+    std::atomic<int32_t> nDone { 0 };
+    for (int32_t index = 0; index < 4; ++index) {
+        EXPECT_EQ(pool.SubmitDecode(pixelMap, [&nDone](const std::string &metadata) {
+            ++nDone;
+        }), RET_OK);
+    }
+    EXPECT_TRUE(WaitFor([] { return (FakeCodec::GetRunning() == 2); }));
+    std::this_thread::sleep_for(WAIT_INTERVAL * 10);
+    EXPECT_EQ(FakeCodec::GetRunning(), 2);
+
+    FakeCodec::OpenGate();
+    EXPECT_TRUE(WaitFor([&nDone] { return (nDone == 4); }));
+    EXPECT_EQ(FakeCodec::GetCalls(), 4);
+    EXPECT_EQ(pool.GetMetrics().peakRunning, 2);
+}
+
+/**
+ * @tc.name: BoomerangCodecPoolTest005
+ * @tc.desc: Stopping the pool discards pending jobs and rejects new ones
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BoomerangCodecPoolTest, BoomerangCodecPoolTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FakeCodec::Reset(false);
+    BoomerangCodecPoolOptions options;
+    options.nWorkers = 1;
+    BoomerangCodecPool pool(FAKE_CODEC, options);
+    auto pixelMap = CreatePixelMap();
+    ASSERT_NE(pixelMap, nullptr);
+    std::atomic<int32_t> nDone { 0 };
+    auto done = [&nDone](const std::string &metadata) {
+        ++nDone;
+    };
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_OK);
+    EXPECT_TRUE(WaitFor([] { return (FakeCodec::GetRunning() == 1); }));
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_OK);
+    pool.Stop();
+    EXPECT_EQ(pool.GetMetrics().depth, 0);
+    EXPECT_EQ(pool.SubmitDecode(pixelMap, done), RET_ERR);
+
+    FakeCodec::OpenGate();
+    EXPECT_TRUE(WaitFor([&nDone] { return (nDone == 1); }));
+    EXPECT_EQ(FakeCodec::GetCalls(), 1);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
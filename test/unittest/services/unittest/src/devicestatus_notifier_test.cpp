@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "devicestatus_notifier_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DeviceStatusNotifierTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr std::chrono::seconds WAIT_TIMEOUT { 2 };
+constexpr int32_t MAX_WAIT_TIMES { 500 };
+constexpr std::chrono::milliseconds WAIT_INTERVAL { 2 };
+constexpr size_t QUEUE_DEPTH { 4 };
+constexpr size_t N_CHANGES { 64 };
+
+Data MakeData(Type type, OnChangedValue value)
+{
+    Data data;
+    data.type = type;
+    data.value = value;
+    return data;
+}
+} // namespace
+
+void DeviceStatusNotifierTest::TestCallback::OnDeviceStatusChanged(const Data &value)
+{
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return gateOpen_; });
+    changes_.push_back(value);
+    cv_.notify_all();
+}
+
+void DeviceStatusNotifierTest::TestCallback::OpenGate()
+{
+    std::lock_guard guard(mutex_);
+    gateOpen_ = true;
+    cv_.notify_all();
+}
+
+bool DeviceStatusNotifierTest::TestCallback::WaitFor(size_t nChanges)
+{
+    std::unique_lock lock(mutex_);
+    return cv_.wait_for(lock, WAIT_TIMEOUT, [this, nChanges] { return (changes_.size() >= nChanges); });
+}
+
+std::vector<Data> DeviceStatusNotifierTest::TestCallback::GetChanges()
+{
+    std::lock_guard guard(mutex_);
+    return changes_;
+}
+
+void DeviceStatusNotifierTest::SetUpTestCase() {}
+
+void DeviceStatusNotifierTest::TearDownTestCase() {}
+
+void DeviceStatusNotifierTest::SetUp() {}
+
+void DeviceStatusNotifierTest::TearDown() {}
+
+/**
+ * @tc.name: DeviceStatusNotifierTest001
+ * @tc.desc: Changes reach every subscriber of their type, filtered by the activity event
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceStatusNotifierTest, DeviceStatusNotifierTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusNotifier notifier;
+    sptr<TestCallback> first = sptr<TestCallback>::MakeSptr();
+    sptr<TestCallback> second = sptr<TestCallback>::MakeSptr();
+    EXPECT_FALSE(notifier.Notify(MakeData(TYPE_STILL, VALUE_ENTER)));
+
+    notifier.Subscribe(TYPE_STILL, ENTER, first);
+    notifier.Subscribe(TYPE_STILL, ENTER, second);
+    EXPECT_TRUE(notifier.Notify(MakeData(TYPE_STILL, VALUE_EXIT)));
+    EXPECT_TRUE(notifier.Notify(MakeData(TYPE_STILL, VALUE_ENTER)));
+    EXPECT_FALSE(notifier.Notify(MakeData(TYPE_LID_OPEN, VALUE_ENTER)));
+    ASSERT_TRUE(first->WaitFor(1));
+    ASSERT_TRUE(second->WaitFor(1));
+    std::this_thread::sleep_for(WAIT_INTERVAL * 10);
+    EXPECT_EQ(first->GetChanges().size(), 1);
+    EXPECT_EQ(first->GetChanges().front().value, VALUE_ENTER);
+
+    ListenerMetrics metrics;
+    EXPECT_TRUE(notifier.GetMetrics(second, metrics));
+    EXPECT_EQ(metrics.nDelivered, 1);
+    EXPECT_EQ(metrics.nDropped, 0);
+}
+
+/**
+ * @tc.name: DeviceStatusNotifierTest002
+ * @tc.desc: A client that does not return holds up nobody else, and its queue stays bounded
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceStatusNotifierTest, DeviceStatusNotifierTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusNotifier notifier(DEFAULT_NOTIFIER_WORKERS, QUEUE_DEPTH);
+    sptr<TestCallback> slow = sptr<TestCallback>::MakeSptr(false);
+    sptr<TestCallback> fast = sptr<TestCallback>::MakeSptr();
+    notifier.Subscribe(TYPE_STILL, ENTER_EXIT, slow);
+    notifier.Subscribe(TYPE_STILL, ENTER_EXIT, fast);
+
+    constexpr size_t nChanges { QUEUE_DEPTH * 2 };
+    for (size_t index = 0; index < nChanges; ++index) {
+        Data data = MakeData(TYPE_STILL, VALUE_ENTER);
+        data.movement = static_cast<double>(index);
+        EXPECT_TRUE(notifier.Notify(data));
+        EXPECT_TRUE(fast->WaitFor(index + 1));
+    }
+    ListenerMetrics metrics;
+    EXPECT_TRUE(notifier.GetMetrics(slow, metrics));
+    EXPECT_LE(metrics.depth, QUEUE_DEPTH);
+    EXPECT_GT(metrics.nDropped, 0);
+
+    slow->OpenGate();
+    EXPECT_TRUE(slow->WaitFor(QUEUE_DEPTH));
+    for (int32_t times = 0; (times < MAX_WAIT_TIMES) &&
+        (slow->GetChanges().back().movement != static_cast<double>(nChanges - 1)); ++times) {
+        std::this_thread::sleep_for(WAIT_INTERVAL);
+    }
+    EXPECT_EQ(slow->GetChanges().back().movement, static_cast<double>(nChanges - 1));
+    EXPECT_LT(slow->GetChanges().size(), nChanges);
+}
+
+/**
+ * @tc.name: DeviceStatusNotifierTest003
+ * @tc.desc: A client that stops taking changes is handed to the stale handler for every type it subscribes
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceStatusNotifierTest, DeviceStatusNotifierTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusNotifier notifier(DEFAULT_NOTIFIER_WORKERS, QUEUE_DEPTH);
+    std::atomic<int32_t> nStale { 0 };
+    notifier.SetStaleHandler([&](Type type, sptr<IRemoteDevStaCallback> callback) {
+        ++nStale;
+        notifier.Unsubscribe(type, callback);
+    });
+    sptr<TestCallback> stuck = sptr<TestCallback>::MakeSptr(false);
+    notifier.Subscribe(TYPE_STILL, ENTER_EXIT, stuck);
+    notifier.Subscribe(TYPE_LID_OPEN, ENTER_EXIT, stuck);
+
+    for (size_t index = 0; index < N_CHANGES; ++index) {
+        notifier.Notify(MakeData(TYPE_STILL, VALUE_ENTER));
+    }
+    for (int32_t times = 0; (times < MAX_WAIT_TIMES) && (nStale < 2); ++times) {
+        std::this_thread::sleep_for(WAIT_INTERVAL);
+    }
+    EXPECT_EQ(nStale, 2);
+    EXPECT_FALSE(notifier.Notify(MakeData(TYPE_STILL, VALUE_ENTER)));
+    EXPECT_FALSE(notifier.Notify(MakeData(TYPE_LID_OPEN, VALUE_ENTER)));
+    stuck->OpenGate();
+}
+
+/**
+ * @tc.name: DeviceStatusNotifierTest004
+ * @tc.desc: Unsubscribed clients receive nothing further
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceStatusNotifierTest, DeviceStatusNotifierTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusNotifier notifier;
+    sptr<TestCallback> callback = sptr<TestCallback>::MakeSptr();
+    notifier.Subscribe(TYPE_STILL, ENTER_EXIT, callback);
+    notifier.Subscribe(TYPE_STILL, ENTER_EXIT, callback);
+    EXPECT_TRUE(notifier.Notify(MakeData(TYPE_STILL, VALUE_ENTER)));
+    EXPECT_TRUE(callback->WaitFor(1));
+
+    notifier.Unsubscribe(TYPE_STILL, callback);
+    EXPECT_FALSE(notifier.Notify(MakeData(TYPE_STILL, VALUE_EXIT)));
+    ListenerMetrics metrics;
+    EXPECT_FALSE(notifier.GetMetrics(callback, metrics));
+    std::this_thread::sleep_for(WAIT_INTERVAL * 10);
+    EXPECT_EQ(callback->GetChanges().size(), 1);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "circle_stream_buffer.h"
+#include "devicestatus_define.h"
+#include "net_packet.h"
+#include "net_packet_view.h"
+#include "stream_buffer_pool.h"
+
+#undef LOG_TAG
+#define LOG_TAG "StreamBufferTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr size_t LARGE_PAYLOAD_SIZE { 3 * MAX_PACKET_BUF_SIZE };
+constexpr size_t SMALL_PAYLOAD_SIZE { 100 };
+const std::string STR_INFO { "abc12345" };
+const std::string STR_PREFIX_SHORT { "abc" };
+} // namespace
+
+class StreamBufferTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: StreamBufferTest001
+ * @tc.desc: Payloads larger than MAX_STREAM_BUF_SIZE grow the buffer and read back intact.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, StreamBufferTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::vector<char> payload(LARGE_PAYLOAD_SIZE);
+    for (size_t index = 0; index < payload.size(); ++index) {
+        payload[index] = static_cast<char>(index);
+    }
+    StreamBuffer buf;
+    int32_t head = 1;
+    ASSERT_TRUE(buf.Write(head));
+    ASSERT_TRUE(buf.Write(payload.data(), payload.size()));
+    EXPECT_EQ(buf.Size(), sizeof(head) + payload.size());
+
+    int32_t readHead = 0;
+    std::vector<char> readPayload(LARGE_PAYLOAD_SIZE);
+    ASSERT_TRUE(buf.Read(readHead));
+    ASSERT_TRUE(buf.Read(readPayload.data(), readPayload.size()));
+    EXPECT_EQ(readHead, head);
+    EXPECT_EQ(readPayload, payload);
+    EXPECT_TRUE(buf.empty());
+}
+
+/**
+ * @tc.name: StreamBufferTest002
+ * @tc.desc: Strings stay terminated after the buffer is cleaned and reused.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, StreamBufferTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StreamBuffer buf;
+    buf << STR_INFO << STR_INFO;
+    buf.Clean();
+    buf << STR_PREFIX_SHORT;
+    std::string str;
+    ASSERT_TRUE(buf.Read(str));
+    EXPECT_EQ(str, STR_PREFIX_SHORT);
+    EXPECT_FALSE(buf.Read(str));
+}
+
+/**
+ * @tc.name: StreamBufferTest003
+ * @tc.desc: Copies of a packet own their storage.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, StreamBufferTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    NetPacket pkt(MessageId::COORDINATION_MESSAGE);
+    std::vector<char> payload(LARGE_PAYLOAD_SIZE, 'a');
+    ASSERT_TRUE(pkt.Write(payload.data(), payload.size()));
+    NetPacket copy(pkt);
+    pkt.Clean();
+    ASSERT_EQ(copy.Size(), payload.size());
+    EXPECT_EQ(copy.GetMsgId(), MessageId::COORDINATION_MESSAGE);
+    EXPECT_EQ(std::string(copy.Data(), copy.Size()), std::string(payload.data(), payload.size()));
+
+    StreamBuffer wire;
+    ASSERT_TRUE(copy.MakeData(wire));
+    EXPECT_EQ(wire.Size(), static_cast<size_t>(copy.GetPacketLength()));
+}
+
+/**
+ * @tc.name: StreamBufferTest004
+ * @tc.desc: Writes beyond MAX_STREAM_BUF_CAPACITY are rejected.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, StreamBufferTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StreamBuffer buf;
+    std::vector<char> payload(MAX_STREAM_BUF_CAPACITY, 'b');
+    ASSERT_TRUE(buf.Write(payload.data(), payload.size()));
+    EXPECT_EQ(buf.GetAvailableBufSize(), 0);
+    EXPECT_FALSE(buf.Write(payload.data(), 1));
+    EXPECT_TRUE(buf.ChkRWError());
+}
+
+/**
+ * @tc.name: StreamBufferTest005
+ * @tc.desc: CircleStreamBuffer compacts consumed data before growing.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, StreamBufferTest005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    CircleStreamBuffer circBuf;
+    std::vector<char> payload(SMALL_PAYLOAD_SIZE, 'c');
+    std::vector<char> readPayload(SMALL_PAYLOAD_SIZE);
+    constexpr size_t rounds = 1000;
+    for (size_t round = 0; round < rounds; ++round) {
+        ASSERT_TRUE(circBuf.Write(payload.data(), payload.size()));
+        ASSERT_TRUE(circBuf.Read(readPayload.data(), readPayload.size()));
+        EXPECT_EQ(readPayload, payload);
+    }
+    EXPECT_LE(circBuf.GetCapacity(), static_cast<int32_t>(MAX_PACKET_BUF_SIZE));
+}
+
+/**
+ * @tc.name: StreamBufferTest006
+ * @tc.desc: Released blocks are recycled by the next acquisition of the same size class.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, StreamBufferTest006, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    size_t capacity = 0;
+    char *block = StreamBufferPool::Acquire(SMALL_PAYLOAD_SIZE, capacity);
+    ASSERT_NE(block, nullptr);
+    EXPECT_GE(capacity, SMALL_PAYLOAD_SIZE);
+    StreamBufferPool::Release(block, capacity);
+
+    size_t capacity1 = 0;
+    char *block1 = StreamBufferPool::Acquire(SMALL_PAYLOAD_SIZE, capacity1);
+    EXPECT_EQ(block1, block);
+    EXPECT_EQ(capacity1, capacity);
+    StreamBufferPool::Release(block1, capacity1);
+}
+
+/**
+ * @tc.name: NetPacketViewTest001
+ * @tc.desc: A view reads a framed packet in place and a copy of it owns its storage.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, NetPacketViewTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    NetPacket pkt(MessageId::COORDINATION_MESSAGE);
+    int32_t value = 10;
+    pkt << value << STR_INFO;
+    CircleStreamBuffer circBuf;
+    ASSERT_TRUE(pkt.MakeData(circBuf));
+
+    const PackHead *head = reinterpret_cast<const PackHead *>(circBuf.ReadBuf());
+    const char *payload = circBuf.ReadBuf() + sizeof(PackHead);
+    NetPacketView view(head->idMsg, payload, static_cast<size_t>(head->size));
+    EXPECT_EQ(view.Data(), payload);
+    EXPECT_EQ(view.GetMsgId(), MessageId::COORDINATION_MESSAGE);
+    EXPECT_EQ(view.GetPacketLength(), pkt.GetPacketLength());
+
+    NetPacket copy(view);
+    EXPECT_NE(copy.Data(), payload);
+
+    int32_t readValue = 0;
+    std::string str;
+    view >> readValue >> str;
+    EXPECT_FALSE(view.ChkRWError());
+    EXPECT_EQ(readValue, value);
+    EXPECT_EQ(str, STR_INFO);
+    EXPECT_FALSE(view.Write(value));
+
+    readValue = 0;
+    copy >> readValue >> str;
+    EXPECT_FALSE(copy.ChkRWError());
+    EXPECT_EQ(readValue, value);
+    EXPECT_EQ(str, STR_INFO);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "stream_send_queue.h"
+
+#undef LOG_TAG
+#define LOG_TAG "StreamSendQueueTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t SOCKET_BUFFER_SIZE { 4096 };
+constexpr size_t PACKET_SIZE { 1000 };
+constexpr size_t MAX_PACKETS { 1000 };
+} // namespace
+
+class StreamSendQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp();
+    void TearDown();
+
+    std::vector<char> MakePacket(size_t seq) const;
+    size_t FillSocket(StreamSendQueue &queue);
+    std::vector<char> ReceiveAll();
+
+    int32_t sockFds_[2] { -1, -1 };
+};
+
+void StreamSendQueueTest::SetUp()
+{
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockFds_), 0);
+    int32_t bufSize = SOCKET_BUFFER_SIZE;
+    ::setsockopt(sockFds_[0], SOL_SOCKET, SO_SNDBUF, &bufSize, sizeof(bufSize));
+    ::setsockopt(sockFds_[1], SOL_SOCKET, SO_RCVBUF, &bufSize, sizeof(bufSize));
+}
+
+void StreamSendQueueTest::TearDown()
+{
+    for (auto &fd : sockFds_) {
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+}
+
+std::vector<char> StreamSendQueueTest::MakePacket(size_t seq) const
+{
+    return std::vector<char>(PACKET_SIZE, static_cast<char>(seq));
+}
+
+size_t StreamSendQueueTest::FillSocket(StreamSendQueue &queue)
+{
+    size_t nSent = 0;
+    while ((queue.GetDepth() == 0) && (nSent < MAX_PACKETS)) {
+        auto packet = MakePacket(nSent);
+        if (!queue.Send(sockFds_[0], packet.data(), packet.size())) {
+            break;
+        }
+        ++nSent;
+    }
+    return nSent;
+}
+
+std::vector<char> StreamSendQueueTest::ReceiveAll()
+{
+    std::vector<char> received;
+    char buf[SOCKET_BUFFER_SIZE];
+    for (;;) {
+        ssize_t count = ::recv(sockFds_[1], buf, sizeof(buf), MSG_DONTWAIT);
+        if (count <= 0) {
+            break;
+        }
+        received.insert(received.end(), buf, buf + count);
+    }
+    return received;
+}
+
+/**
+ * @tc.name: StreamSendQueueTest001
+ * @tc.desc: Packets go straight to the socket while it has room.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamSendQueueTest, StreamSendQueueTest001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StreamSendQueue queue;
+    auto packet = MakePacket(1);
+    EXPECT_TRUE(queue.Send(sockFds_[0], packet.data(), packet.size()));
+    EXPECT_EQ(queue.GetDepth(), 0);
+    EXPECT_EQ(queue.GetPendingBytes(), 0);
+    EXPECT_EQ(ReceiveAll(), packet);
+}
+
+/**
+ * @tc.name: StreamSendQueueTest002
+ * @tc.desc: A full socket queues packets, enables EPOLLOUT once, and Flush delivers them in order.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamSendQueueTest, StreamSendQueueTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StreamSendQueue queue;
+    std::vector<bool> watches;
+    queue.SetWatcher([&watches](bool enable) {
+        watches.push_back(enable);
+    });
+    size_t nSent = FillSocket(queue);
+    ASSERT_LT(nSent, MAX_PACKETS);
+    for (size_t index = 0; index < 3; ++index) {
+        auto packet = MakePacket(nSent++);
+        EXPECT_TRUE(queue.Send(sockFds_[0], packet.data(), packet.size()));
+    }
+    EXPECT_EQ(queue.GetDepth(), 4);
+    ASSERT_EQ(watches.size(), 1);
+    EXPECT_TRUE(watches.front());
+
+    std::vector<char> received;
+    while (queue.GetDepth() > 0) {
+        auto chunk = ReceiveAll();
+        received.insert(received.end(), chunk.begin(), chunk.end());
+        EXPECT_TRUE(queue.Flush(sockFds_[0]));
+    }
+    auto chunk = ReceiveAll();
+    received.insert(received.end(), chunk.begin(), chunk.end());
+    ASSERT_EQ(received.size(), nSent * PACKET_SIZE);
+    for (size_t seq = 0; seq < nSent; ++seq) {
+        EXPECT_EQ(received[seq * PACKET_SIZE], static_cast<char>(seq));
+        EXPECT_EQ(received[seq * PACKET_SIZE + PACKET_SIZE - 1], static_cast<char>(seq));
+    }
+    ASSERT_EQ(watches.size(), 2);
+    EXPECT_FALSE(watches.back());
+    EXPECT_EQ(queue.GetPendingBytes(), 0);
+    EXPECT_EQ(queue.GetDroppedCount(), 0);
+}
+
+/**
+ * @tc.name: StreamSendQueueTest003
+ * @tc.desc: Packets beyond the queue limit are dropped whole and counted.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamSendQueueTest, StreamSendQueueTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StreamSendQueue queue;
+    queue.SetWatcher([](bool) {});
+    FillSocket(queue);
+    bool sent = true;
+    size_t depth = 0;
+    for (size_t index = 0; (index < MAX_PACKETS) && sent; ++index) {
+        depth = queue.GetDepth();
+        auto packet = MakePacket(index);
+        sent = queue.Send(sockFds_[0], packet.data(), packet.size());
+    }
+    EXPECT_FALSE(sent);
+    EXPECT_EQ(queue.GetDroppedCount(), 1);
+    EXPECT_EQ(queue.GetDepth(), depth);
+}
+
+/**
+ * @tc.name: StreamSendQueueTest004
+ * @tc.desc: Flush to a closed peer fails and drops the queued packets.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamSendQueueTest, StreamSendQueueTest004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StreamSendQueue queue;
+    queue.SetWatcher([](bool) {});
+    FillSocket(queue);
+    ASSERT_EQ(queue.GetDepth(), 1);
+    ::close(sockFds_[1]);
+    sockFds_[1] = -1;
+    EXPECT_FALSE(queue.Flush(sockFds_[0]));
+    EXPECT_EQ(queue.GetDepth(), 0);
+    EXPECT_EQ(queue.GetDroppedCount(), 1);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
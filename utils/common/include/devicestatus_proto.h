@@ -27,6 +27,7 @@ inline constexpr int32_t MEMCPY_SEC_FUN_FAIL { 4 };
 inline constexpr int32_t PARAM_INPUT_INVALID { 5 };
 inline constexpr int32_t MAX_STREAM_BUF_SIZE { 2048 };
 inline constexpr size_t MAX_PACKET_BUF_SIZE { MAX_STREAM_BUF_SIZE };
+inline constexpr int32_t MAX_STREAM_BUF_CAPACITY { 65535 };
 inline constexpr int32_t ONCE_PROCESS_NETPACKET_LIMIT { 100 };
 inline constexpr int32_t INVALID_FD { 6 };
 inline constexpr int32_t INVALID_PID { 7 };
@@ -77,6 +78,11 @@ enum class MessageId : int32_t {
     DSOFTBUS_COOPERATE_WITH_OPTIONS,
     DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS,
     DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS_FINISHED,
+    DSOFTBUS_MOUSE_LOCATION_STREAM,
+    DSOFTBUS_INPUT_POINTER_EVENT_COMPACT,
+    DSOFTBUS_INPUT_EVENT_SCHEMA,
+    DSOFTBUS_INPUT_EVENT_BATCH,
+    DSOFTBUS_HEART_BEAT_ACK,
     MAX_MESSAGE_ID,
 };
 
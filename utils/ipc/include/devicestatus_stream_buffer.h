@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -36,7 +36,7 @@ public:
     DISALLOW_MOVE(StreamBuffer);
     explicit StreamBuffer(const StreamBuffer &buf);
     virtual StreamBuffer &operator=(const StreamBuffer &buffer);
-    virtual ~StreamBuffer() = default;
+    virtual ~StreamBuffer();
 
     size_t Size() const;
     int32_t ResidualSize() const;
@@ -66,6 +66,8 @@ public:
 
 protected:
     bool Clone(const StreamBuffer &buf);
+    bool Reserve(size_t size);
+    int32_t GetCapacity() const;
 
 protected:
     enum class ErrorStatus {
@@ -78,7 +80,8 @@ protected:
     int32_t wCount_ { 0 };
     int32_t rPos_ { 0 };
     int32_t wPos_ { 0 };
-    char szBuff_[MAX_STREAM_BUF_SIZE + 1] {};
+    char *szBuff_ { nullptr };
+    size_t capacity_ { 0 };
 };
 
 template<typename T>
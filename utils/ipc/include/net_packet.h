@@ -31,13 +31,13 @@ using PACKHEAD = struct PackHead {
 
 namespace OHOS {
 namespace Msdp {
-class NetPacket final : public StreamBuffer {
+class NetPacket : public StreamBuffer {
 public:
     explicit NetPacket(MessageId msgId);
     NetPacket(const NetPacket &pkt);
     NetPacket &operator = (const NetPacket &pkt);
     DISALLOW_MOVE(NetPacket);
-    ~NetPacket();
+    virtual ~NetPacket();
 
     bool MakeData(StreamBuffer &buf) const;
     int32_t GetPacketLength() const
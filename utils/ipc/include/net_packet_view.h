@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NET_PACKET_VIEW_H
+#define NET_PACKET_VIEW_H
+
+#include "net_packet.h"
+
+#undef LOG_TAG
+#define LOG_TAG "NetPacketView"
+
+namespace OHOS {
+namespace Msdp {
+/**
+ * Read-only packet whose payload stays in the receive buffer it was framed from.
+ *
+ * The view is only valid while the receive buffer is untouched, i.e. for the duration of
+ * the packet callback. A handler that needs the packet afterwards copies it into a
+ * NetPacket, which then owns its storage.
+ */
+class NetPacketView final : public NetPacket {
+public:
+    NetPacketView(MessageId msgId, const char *data, size_t size);
+    DISALLOW_COPY_AND_MOVE(NetPacketView);
+    ~NetPacketView();
+
+    using NetPacket::Write;
+    bool Write(const char *buf, size_t size) override;
+};
+} // namespace Msdp
+} // namespace OHOS
+#endif // NET_PACKET_VIEW_H
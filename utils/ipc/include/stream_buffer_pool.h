@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STREAM_BUFFER_POOL_H
+#define STREAM_BUFFER_POOL_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+/**
+ * Per-thread slab pool for stream buffer storage.
+ *
+ * Blocks are grouped into power-of-two size classes. A released block is kept on the free
+ * list of the releasing thread, up to a fixed number per class, and handed out again by the
+ * next Acquire of the same class. Requests larger than the biggest class bypass the pool.
+ */
+class StreamBufferPool final {
+public:
+    DISALLOW_COPY_AND_MOVE(StreamBufferPool);
+
+    static char* Acquire(size_t size, size_t &capacity);
+    static void Release(char *block, size_t capacity);
+
+private:
+    StreamBufferPool() = default;
+    ~StreamBufferPool();
+
+    static StreamBufferPool* GetInstance();
+    static size_t GetSizeClass(size_t size);
+
+    static inline constexpr size_t MIN_BLOCK_SHIFT { 8 };
+    static inline constexpr size_t N_SIZE_CLASSES { 9 };
+    static inline constexpr size_t MAX_CACHED_BLOCKS { 8 };
+
+    std::array<std::vector<char*>, N_SIZE_CLASSES> freeLists_;
+};
+} // namespace Msdp
+} // namespace OHOS
+#endif // STREAM_BUFFER_POOL_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STREAM_SEND_QUEUE_H
+#define STREAM_SEND_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+/**
+ * Outbound queue of a stream socket session.
+ *
+ * Send never blocks: bytes the socket can not take right away are queued, small packets are
+ * merged into shared chunks, and the watcher is asked to enable EPOLLOUT. Flush, called when
+ * the socket becomes writable, hands as many chunks as possible to a single sendmsg and asks
+ * the watcher to disable EPOLLOUT once the queue is drained. A packet that would grow the
+ * queue beyond its byte limit is dropped as a whole and counted.
+ */
+class StreamSendQueue final {
+public:
+    using WritableWatcher = std::function<void(bool enable)>;
+
+    StreamSendQueue() = default;
+    ~StreamSendQueue() = default;
+    DISALLOW_COPY_AND_MOVE(StreamSendQueue);
+
+    void SetWatcher(WritableWatcher watcher);
+    bool Send(int32_t fd, const char *buf, size_t size);
+    bool Flush(int32_t fd);
+    void Clear();
+
+    size_t GetDepth() const;
+    size_t GetPendingBytes() const;
+    uint64_t GetDroppedCount() const;
+
+private:
+    struct Chunk {
+        std::vector<char> data;
+        size_t nPackets { 0 };
+    };
+
+    bool FlushLocked(int32_t fd);
+    void Enqueue(const char *buf, size_t size);
+    void Consume(size_t count);
+    void DropAllLocked();
+    void WatchWritable(bool enable);
+
+    mutable std::mutex mutex_;
+    std::deque<Chunk> chunks_;
+    size_t headOffset_ { 0 };
+    size_t pendingBytes_ { 0 };
+    size_t depth_ { 0 };
+    bool watching_ { false };
+    WritableWatcher watcher_ { nullptr };
+    std::atomic<uint64_t> dropped_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // STREAM_SEND_QUEUE_H
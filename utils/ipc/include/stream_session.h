@@ -27,6 +27,7 @@
 
 #include "net_packet.h"
 #include "devicestatus_proto.h"
+#include "stream_send_queue.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -41,6 +42,7 @@ public:
 
     bool SendMsg(const char *buf, size_t size) const;
     bool SendMsg(NetPacket &pkt) const;
+    bool FlushPendingMsgs();
     void Close();
 
     int32_t GetPid() const
@@ -63,10 +65,26 @@ public:
         tokenType_ = type;
     }
 
+    void SetWritableWatcher(StreamSendQueue::WritableWatcher watcher)
+    {
+        sendQueue_.SetWatcher(watcher);
+    }
+
+    size_t GetSendQueueDepth() const
+    {
+        return sendQueue_.GetDepth();
+    }
+
+    uint64_t GetDroppedCount() const
+    {
+        return sendQueue_.GetDroppedCount();
+    }
+
 protected:
     int32_t fd_ { -1 };
     const int32_t pid_ { -1 };
     int32_t tokenType_ { TokenType::TOKEN_INVALID };
+    mutable StreamSendQueue sendQueue_;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
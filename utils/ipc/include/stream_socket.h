@@ -31,6 +31,7 @@
 
 #include "circle_stream_buffer.h"
 #include "net_packet.h"
+#include "net_packet_view.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -40,7 +41,7 @@ public:
     StreamSocket();
     DISALLOW_COPY_AND_MOVE(StreamSocket);
     virtual ~StreamSocket();
-    using PacketCallBackFun = std::function<void(NetPacket&)>;
+    using PacketCallBackFun = std::function<void(NetPacketView&)>;
 
     int32_t EpollCreate();
     int32_t EpollCtl(int32_t fd, int32_t op, struct epoll_event &event);
@@ -36,12 +36,10 @@ void CircleStreamBuffer::CopyDataToBegin()
 bool CircleStreamBuffer::CheckWrite(size_t size)
 {
     int32_t bufferSize = static_cast<int32_t>(size);
-    int32_t availableSize = GetAvailableBufSize();
-    if (bufferSize > availableSize && rPos_ > 0) {
+    if ((rPos_ > 0) && (wPos_ + bufferSize > GetCapacity())) {
         CopyDataToBegin();
-        availableSize = GetAvailableBufSize();
     }
-    return (availableSize >= bufferSize);
+    return (GetAvailableBufSize() >= bufferSize);
 }
 
 bool CircleStreamBuffer::Write(const char *buf, size_t size)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,8 +16,10 @@
 #include "devicestatus_stream_buffer.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "devicestatus_define.h"
+#include "stream_buffer_pool.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -28,10 +30,19 @@ StreamBuffer::StreamBuffer(const StreamBuffer &buf)
 
 StreamBuffer &StreamBuffer::operator=(const StreamBuffer &buffer)
 {
-    Clone(buffer);
+    if (this != &buffer) {
+        Clone(buffer);
+    }
     return *this;
 }
 
+StreamBuffer::~StreamBuffer()
+{
+    StreamBufferPool::Release(szBuff_, capacity_);
+    szBuff_ = nullptr;
+    capacity_ = 0;
+}
+
 void StreamBuffer::Reset()
 {
     wPos_ = 0;
@@ -44,11 +55,33 @@ void StreamBuffer::Reset()
 void StreamBuffer::Clean()
 {
     Reset();
-    errno_t ret = memset_sp(&szBuff_, sizeof(szBuff_), 0, sizeof(szBuff_));
-    if (ret != EOK) {
-        FI_HILOGE("Call memset_s failed");
-        return;
+}
+
+bool StreamBuffer::Reserve(size_t size)
+{
+    // Keep one spare byte past the end, CircleStreamBuffer::CopyDataToBegin() touches it.
+    size_t required = size + 1;
+    if (required <= capacity_) {
+        return true;
+    }
+    size_t capacity = 0;
+    char *block = StreamBufferPool::Acquire(std::max(required, capacity_ * 2), capacity);
+    if (block == nullptr) {
+        FI_HILOGE("Failed to allocate buffer, size:%{public}zu", required);
+        return false;
+    }
+    if ((szBuff_ != nullptr) && (wPos_ > 0)) {
+        errno_t ret = memcpy_sp(block, capacity, szBuff_, static_cast<size_t>(wPos_));
+        if (ret != EOK) {
+            FI_HILOGE("Failed to call memcpy_sp, errCode:%{public}d", MEMCPY_SEC_FUN_FAIL);
+            StreamBufferPool::Release(block, capacity);
+            return false;
+        }
     }
+    StreamBufferPool::Release(szBuff_, capacity_);
+    szBuff_ = block;
+    capacity_ = capacity;
+    return true;
 }
 
 bool StreamBuffer::SeekReadPos(int32_t n)
@@ -75,9 +108,16 @@ bool StreamBuffer::Read(std::string &buf)
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_READ;
         return false;
     }
-    buf = ReadBuf();
-    rPos_ = rPos_ + static_cast<int32_t>(buf.length()) + 1;
-    return (buf.length() > 0);
+    size_t residualSize = static_cast<size_t>(ResidualSize());
+    size_t length = ::strnlen(ReadBuf(), residualSize);
+    if (length >= residualSize) {
+        FI_HILOGE("String is not terminated, errCode:%{public}d", STREAM_BUF_READ_FAIL);
+        rwErrorStatus_ = ErrorStatus::ERROR_STATUS_READ;
+        return false;
+    }
+    buf.assign(ReadBuf(), length);
+    rPos_ = rPos_ + static_cast<int32_t>(length) + 1;
+    return (length > 0);
 }
 
 bool StreamBuffer::Write(const StreamBuffer &buf)
@@ -139,13 +179,17 @@ bool StreamBuffer::Write(const char *buf, size_t size)
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
         return false;
     }
-    if (wPos_ + static_cast<int32_t>(size) > MAX_STREAM_BUF_SIZE) {
+    if (size > static_cast<size_t>(GetAvailableBufSize())) {
         FI_HILOGE("The write length exceeds buffer, wIdx:%{public}d, size:%{public}zu, maxBufSize:%{public}d, "
-            "errCode:%{public}d", wPos_, size, MAX_STREAM_BUF_SIZE, MEM_OUT_OF_BOUNDS);
+            "errCode:%{public}d", wPos_, size, MAX_STREAM_BUF_CAPACITY, MEM_OUT_OF_BOUNDS);
+        rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
+        return false;
+    }
+    if ((static_cast<size_t>(wPos_) + size >= capacity_) && !Reserve(static_cast<size_t>(wPos_) + size)) {
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
         return false;
     }
-    errno_t ret = memcpy_sp(&szBuff_[wPos_], GetAvailableBufSize(), buf, size);
+    errno_t ret = memcpy_sp(&szBuff_[wPos_], capacity_ - static_cast<size_t>(wPos_), buf, size);
     if (ret != EOK) {
         FI_HILOGE("Failed to call memcpy_sp, errCode:%{public}d", MEMCPY_SEC_FUN_FAIL);
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
@@ -178,7 +222,12 @@ bool StreamBuffer::ChkRWError() const
 
 int32_t StreamBuffer::GetAvailableBufSize() const
 {
-    return ((wPos_ >= MAX_STREAM_BUF_SIZE) ? 0 : (MAX_STREAM_BUF_SIZE - wPos_));
+    return ((wPos_ >= MAX_STREAM_BUF_CAPACITY) ? 0 : (MAX_STREAM_BUF_CAPACITY - wPos_));
+}
+
+int32_t StreamBuffer::GetCapacity() const
+{
+    return ((capacity_ > 0) ? static_cast<int32_t>(capacity_ - 1) : 0);
 }
 
 const std::string &StreamBuffer::GetErrorStatusRemark() const
@@ -199,12 +248,13 @@ const std::string &StreamBuffer::GetErrorStatusRemark() const
 
 const char *StreamBuffer::Data() const
 {
-    return &szBuff_[0];
+    static const char emptyBuff[1] {};
+    return ((szBuff_ != nullptr) ? &szBuff_[0] : &emptyBuff[0]);
 }
 
 const char *StreamBuffer::ReadBuf() const
 {
-    return &szBuff_[rPos_];
+    return &Data()[rPos_];
 }
 
 bool StreamBuffer::Clone(const StreamBuffer &buf)
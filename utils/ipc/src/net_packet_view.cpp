@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "net_packet_view.h"
+
+#include "devicestatus_define.h"
+
+namespace OHOS {
+namespace Msdp {
+NetPacketView::NetPacketView(MessageId msgId, const char *data, size_t size)
+    : NetPacket(msgId)
+{
+    if ((data != nullptr) && (size > 0)) {
+        szBuff_ = const_cast<char *>(data);
+        wPos_ = static_cast<int32_t>(size);
+    }
+}
+
+NetPacketView::~NetPacketView()
+{
+    // The storage belongs to the receive buffer.
+    szBuff_ = nullptr;
+}
+
+bool NetPacketView::Write(const char *buf, size_t size)
+{
+    FI_HILOGE("Write to read-only packet, size:%{public}zu", size);
+    rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
+    return false;
+}
+} // namespace Msdp
+} // namespace OHOS
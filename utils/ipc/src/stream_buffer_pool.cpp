@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stream_buffer_pool.h"
+
+#include <new>
+
+namespace OHOS {
+namespace Msdp {
+namespace {
+// Set once the pool of the current thread is destroyed, so that buffers outliving it
+// (e.g. static objects released at process exit) fall back to plain allocation.
+thread_local bool g_poolDestroyed { false };
+} // namespace
+
+StreamBufferPool::~StreamBufferPool()
+{
+    for (auto &freeList : freeLists_) {
+        for (char *block : freeList) {
+            delete[] block;
+        }
+        freeList.clear();
+    }
+    g_poolDestroyed = true;
+}
+
+StreamBufferPool* StreamBufferPool::GetInstance()
+{
+    if (g_poolDestroyed) {
+        return nullptr;
+    }
+    thread_local StreamBufferPool instance;
+    return &instance;
+}
+
+size_t StreamBufferPool::GetSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    while ((sizeClass < N_SIZE_CLASSES) && ((size_t(1) << (MIN_BLOCK_SHIFT + sizeClass)) < size)) {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+char* StreamBufferPool::Acquire(size_t size, size_t &capacity)
+{
+    size_t sizeClass = GetSizeClass(size);
+    if (sizeClass >= N_SIZE_CLASSES) {
+        capacity = size;
+        return new (std::nothrow) char[capacity];
+    }
+    capacity = (size_t(1) << (MIN_BLOCK_SHIFT + sizeClass));
+    StreamBufferPool *pool = GetInstance();
+    if ((pool != nullptr) && !pool->freeLists_[sizeClass].empty()) {
+        char *block = pool->freeLists_[sizeClass].back();
+        pool->freeLists_[sizeClass].pop_back();
+        return block;
+    }
+    return new (std::nothrow) char[capacity];
+}
+
+void StreamBufferPool::Release(char *block, size_t capacity)
+{
+    if (block == nullptr) {
+        return;
+    }
+    size_t sizeClass = GetSizeClass(capacity);
+    StreamBufferPool *pool = GetInstance();
+    if ((pool == nullptr) || (sizeClass >= N_SIZE_CLASSES) ||
+        ((size_t(1) << (MIN_BLOCK_SHIFT + sizeClass)) != capacity) ||
+        (pool->freeLists_[sizeClass].size() >= MAX_CACHED_BLOCKS)) {
+        delete[] block;
+        return;
+    }
+    pool->freeLists_[sizeClass].push_back(block);
+}
+} // namespace Msdp
+} // namespace OHOS
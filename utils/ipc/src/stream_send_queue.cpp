@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stream_send_queue.h"
+
+#include <algorithm>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "StreamSendQueue"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr size_t MAX_PENDING_BYTES { 64 * 1024 };
+constexpr size_t MAX_CHUNK_SIZE { 4096 };
+constexpr size_t MAX_IOV_COUNT { 16 };
+} // namespace
+
+void StreamSendQueue::SetWatcher(WritableWatcher watcher)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    watcher_ = watcher;
+}
+
+bool StreamSendQueue::Send(int32_t fd, const char *buf, size_t size)
+{
+    CHKPF(buf);
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!chunks_.empty() && (watcher_ == nullptr) && !FlushLocked(fd)) {
+        return false;
+    }
+    if (chunks_.empty()) {
+        ssize_t count = -1;
+        do {
+            count = ::send(fd, buf, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+        } while ((count < 0) && (errno == EINTR));
+        if (count < 0) {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                FI_HILOGE("send failed, fd:%{public}d, errno:%{public}d", fd, errno);
+                return false;
+            }
+            count = 0;
+        }
+        if (static_cast<size_t>(count) == size) {
+            return true;
+        }
+        // The rest of a partially sent packet must follow, whatever the queue limit.
+        Enqueue(buf + count, size - static_cast<size_t>(count));
+        WatchWritable(true);
+        return true;
+    }
+    if (pendingBytes_ + size > MAX_PENDING_BYTES) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        FI_HILOGW("Send queue is full, fd:%{public}d, pending:%{public}zu, packet dropped", fd, pendingBytes_);
+        return false;
+    }
+    Enqueue(buf, size);
+    return true;
+}
+
+bool StreamSendQueue::Flush(int32_t fd)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return FlushLocked(fd);
+}
+
+void StreamSendQueue::Clear()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    DropAllLocked();
+}
+
+size_t StreamSendQueue::GetDepth() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return depth_;
+}
+
+size_t StreamSendQueue::GetPendingBytes() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return pendingBytes_;
+}
+
+uint64_t StreamSendQueue::GetDroppedCount() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+bool StreamSendQueue::FlushLocked(int32_t fd)
+{
+    while (!chunks_.empty()) {
+        struct iovec iov[MAX_IOV_COUNT] {};
+        size_t nIov = 0;
+        size_t offset = headOffset_;
+
+        for (auto iter = chunks_.begin(); (iter != chunks_.end()) && (nIov < MAX_IOV_COUNT); ++iter, ++nIov) {
+            iov[nIov].iov_base = iter->data.data() + offset;
+            iov[nIov].iov_len = iter->data.size() - offset;
+            offset = 0;
+        }
+        struct msghdr msg {};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = nIov;
+
+        ssize_t count = ::sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                WatchWritable(true);
+                return true;
+            }
+            FI_HILOGE("sendmsg failed, fd:%{public}d, errno:%{public}d", fd, errno);
+            DropAllLocked();
+            return false;
+        }
+        Consume(static_cast<size_t>(count));
+    }
+    WatchWritable(false);
+    return true;
+}
+
+void StreamSendQueue::Enqueue(const char *buf, size_t size)
+{
+    if (!chunks_.empty() && (chunks_.back().data.size() + size <= MAX_CHUNK_SIZE)) {
+        Chunk &tail = chunks_.back();
+        tail.data.insert(tail.data.end(), buf, buf + size);
+        ++tail.nPackets;
+    } else {
+        chunks_.push_back(Chunk { std::vector<char>(buf, buf + size), 1 });
+    }
+    pendingBytes_ += size;
+    ++depth_;
+}
+
+void StreamSendQueue::Consume(size_t count)
+{
+    while ((count > 0) && !chunks_.empty()) {
+        Chunk &head = chunks_.front();
+        size_t remaining = head.data.size() - headOffset_;
+        if (count < remaining) {
+            headOffset_ += count;
+            pendingBytes_ -= count;
+            return;
+        }
+        count -= remaining;
+        pendingBytes_ -= remaining;
+        depth_ -= std::min(depth_, head.nPackets);
+        headOffset_ = 0;
+        chunks_.pop_front();
+    }
+}
+
+void StreamSendQueue::DropAllLocked()
+{
+    dropped_.fetch_add(depth_, std::memory_order_relaxed);
+    chunks_.clear();
+    headOffset_ = 0;
+    pendingBytes_ = 0;
+    depth_ = 0;
+    WatchWritable(false);
+}
+
+void StreamSendQueue::WatchWritable(bool enable)
+{
+    if (watching_ == enable) {
+        return;
+    }
+    watching_ = enable;
+    if (watcher_ != nullptr) {
+        watcher_(enable);
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -52,35 +52,15 @@ bool StreamSession::SendMsg(const char *buf, size_t size) const
         FI_HILOGE("The fd_ is less than 0");
         return false;
     }
+    return sendQueue_.Send(fd_, buf, size);
+}
 
-    int32_t idx = 0;
-    int32_t retryCount = 0;
-    const int32_t bufSize = static_cast<int32_t>(size);
-    int32_t remSize = bufSize;
-    while (remSize > 0 && retryCount < SEND_RETRY_LIMIT) {
-        retryCount += 1;
-        ssize_t count = send(fd_, &buf[idx], remSize, MSG_DONTWAIT | MSG_NOSIGNAL);
-        if (count < 0) {
-            if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
-                usleep(SEND_RETRY_SLEEP_TIME);
-                FI_HILOGW("Continue for errno EAGAIN|EINTR|EWOULDBLOCK, errno:%{public}d", errno);
-                continue;
-            }
-            FI_HILOGE("Send return failed, error:%{public}d, fd:%{public}d", errno, fd_);
-            return false;
-        }
-        idx += count;
-        remSize -= count;
-        if (remSize > 0) {
-            usleep(SEND_RETRY_SLEEP_TIME);
-        }
-    }
-    if (retryCount >= SEND_RETRY_LIMIT || remSize != 0) {
-        FI_HILOGE("Send too many times:%{public}d/%{public}d, size:%{public}d/%{public}d, fd:%{public}d",
-            retryCount, SEND_RETRY_LIMIT, idx, bufSize, fd_);
+bool StreamSession::FlushPendingMsgs()
+{
+    if (fd_ < 0) {
         return false;
     }
-    return true;
+    return sendQueue_.Flush(fd_);
 }
 
 void StreamSession::Close()
@@ -93,6 +73,7 @@ void StreamSession::Close()
         }
         fd_ = -1;
     }
+    sendQueue_.Clear();
 }
 
 bool StreamSession::SendMsg(NetPacket &pkt) const
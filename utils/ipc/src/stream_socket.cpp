@@ -94,12 +94,7 @@ void StreamSocket::OnReadPackets(CircleStreamBuffer &circBuf, StreamSocket::Pack
         if (head->size > dataSize) {
             break;
         }
-        NetPacket pkt(head->idMsg);
-        if ((head->size > 0) && (!pkt.Write(&buf[headSize], head->size))) {
-            FI_HILOGW("Error writing data in the NetPacket, it will be retried next time, messageid:%{public}d, "
-                "size:%{public}d", head->idMsg, head->size);
-            break;
-        }
+        NetPacketView pkt(head->idMsg, &buf[headSize], static_cast<size_t>(head->size));
         if (!circBuf.SeekReadPos(pkt.GetPacketLength())) {
             FI_HILOGW("Set read position error, and this error cannot be recovered, and the buffer will be reset, "
                 "packetSize:%{public}d, residualSize:%{public}d", pkt.GetPacketLength(), residualSize);
@@ -27,6 +27,8 @@ namespace DeviceStatus {
 class JsonParser {
 public:
     explicit JsonParser(const char *jsonStr);
+    // Parses @jsonLen bytes at @jsonStr, which need not be null-terminated.
+    JsonParser(const char *jsonStr, size_t jsonLen);
     ~JsonParser();
     JsonParser(const JsonParser&) = delete;
     JsonParser& operator=(const JsonParser&) = delete;
@@ -34,6 +34,12 @@ JsonParser::JsonParser(const char *jsonStr)
     CHKPV(json_);
 }
 
+JsonParser::JsonParser(const char *jsonStr, size_t jsonLen)
+{
+    json_ = cJSON_ParseWithLength(jsonStr, jsonLen);
+    CHKPV(json_);
+}
+
 JsonParser::~JsonParser()
 {
     if (json_ != nullptr) {